@@ -29,8 +29,9 @@ int main(int argc, const char* argv[]) {
     }
 
     // Create a graph with weights and biases from .npy files.
-    const wnn::ContextOptions options =
+    wnn::ContextOptions options =
         utils::CreateContextOptions(mobilevetv2.mDevicePreference, mobilevetv2.mPowerPreference);
+    options.sparseInference = mobilevetv2.mSparsity > 0;
     wnn::Context context = CreateCppContext(&options);
     context.SetUncapturedErrorCallback(
         [](WNNErrorType type, char const* message, void* userData) {
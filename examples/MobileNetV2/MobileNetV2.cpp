@@ -45,6 +45,27 @@ const wnn::Operand MobileNetV2::BuildConstantFromNpy(const wnn::GraphBuilder& bu
     return utils::BuildConstant(builder, data.shape, data.data<float>(), data.num_bytes());
 }
 
+const wnn::Operand MobileNetV2::BuildWeightsFromNpy(const wnn::GraphBuilder& builder,
+                                                    const std::string& path,
+                                                    int32_t axis) {
+    cnpy::NpyArray data = cnpy::npy_load(path);
+    // The 1x1 conv2d weights are pruned for sparse inference.
+    const std::vector<int32_t>& shape = data.shape;
+    const bool pointwise = shape.size() == 4 && (mLayout == "nchw" ? shape[2] * shape[3] == 1
+                                                                   : shape[1] * shape[2] == 1);
+    if (mSparsity > 0 && pointwise) {
+        utils::PruneWeights(data.data<float>(), data.num_vals, mSparsity);
+    }
+    if (mWeightsType != "int8") {
+        mConstants.push_back(data.data_holder);
+        return utils::BuildConstant(builder, data.shape, data.data<float>(), data.num_bytes());
+    }
+    SHARED_DATA_TYPE quantizedData(new std::vector<char>(data.num_vals));
+    mConstants.push_back(quantizedData);
+    return utils::BuildQuantizedConstant(builder, data.shape, data.data<float>(), axis,
+                                         reinterpret_cast<int8_t*>(quantizedData->data()));
+}
+
 const wnn::Operand MobileNetV2::BuildConv(const wnn::GraphBuilder& builder,
                                           const wnn::Operand& input,
                                           int32_t convIndex,
@@ -54,7 +75,13 @@ const wnn::Operand MobileNetV2::BuildConv(const wnn::GraphBuilder& builder,
     std::string prefix = mLayout == "nchw" ? mWeightsPath + "conv_" : mWeightsPath + "Const_";
     std::string suffix = mLayout == "nchw" ? "_weight.npy" : ".npy";
     const std::string weightsPath = prefix + std::to_string(convIndex) + suffix;
-    const wnn::Operand convWeights = BuildConstantFromNpy(builder, weightsPath);
+    const wnn::Conv2dFilterOperandLayout filterLayout =
+        options != nullptr ? options->filterLayout : wnn::Conv2dFilterOperandLayout::Oihw;
+    const int32_t outputChannelAxis = filterLayout == wnn::Conv2dFilterOperandLayout::Hwio ||
+                                              filterLayout == wnn::Conv2dFilterOperandLayout::Ihwo
+                                          ? 3
+                                          : 0;
+    const wnn::Operand convWeights = BuildWeightsFromNpy(builder, weightsPath, outputChannelAxis);
 
     prefix = mLayout == "nchw" ? mWeightsPath + "conv_" : mWeightsPath + "MobilenetV2_";
     if (mLayout == "nchw") {
@@ -100,7 +127,7 @@ const wnn::Operand MobileNetV2::BuildConvBatchNorm(const wnn::GraphBuilder& buil
         subNameIndex != -1 ? "_linearbottleneck" + std::to_string(subNameIndex) : "";
     std::string prefix = mWeightsPath + "mobilenetv20_features" + subName;
     const std::string weightsPath = prefix + "_conv" + std::to_string(nameIndex) + "_weight.npy";
-    const wnn::Operand convWeights = BuildConstantFromNpy(builder, weightsPath);
+    const wnn::Operand convWeights = BuildWeightsFromNpy(builder, weightsPath);
     prefix.append("_batchnorm" + std::to_string(nameIndex));
     const std::string meanPath = prefix + "_running_mean.npy";
     const wnn::Operand mean = BuildConstantFromNpy(builder, meanPath);
@@ -134,7 +161,7 @@ const wnn::Operand MobileNetV2::BuildGemm(const wnn::GraphBuilder& builder,
                                           int32_t gemmIndex) {
     std::string suffix = mLayout == "nchw" ? "_weight.npy" : "_kernel.npy";
     const std::string weightsPath = mWeightsPath + "gemm_" + std::to_string(gemmIndex) + suffix;
-    const wnn::Operand gemmWeights = BuildConstantFromNpy(builder, weightsPath);
+    const wnn::Operand gemmWeights = BuildWeightsFromNpy(builder, weightsPath);
     const std::string biasPath = mWeightsPath + "gemm_" + std::to_string(gemmIndex) + "_bias.npy";
     const wnn::Operand gemmBias = BuildConstantFromNpy(builder, biasPath);
     wnn::GemmOptions gemmOptions;
@@ -28,6 +28,12 @@ class MobileNetV2 : public ExampleBase {
     const wnn::Operand LoadBatchNormNchw(const wnn::GraphBuilder& builder, bool softmax = true);
     const wnn::Operand BuildConstantFromNpy(const wnn::GraphBuilder& builder,
                                             const std::string& path);
+    // Builds the conv2d or gemm weights, which are quantized to int8 along the output channel
+    // axis if the int8 weights type is specified. The 1x1 conv2d weights are pruned if the
+    // sparsity is specified.
+    const wnn::Operand BuildWeightsFromNpy(const wnn::GraphBuilder& builder,
+                                           const std::string& path,
+                                           int32_t axis = 0);
     const wnn::Operand BuildConv(const wnn::GraphBuilder& builder,
                                  const wnn::Operand& input,
                                  int32_t convIndex,
@@ -44,6 +44,19 @@ const wnn::Operand ResNet::BuildConstantFromNpy(const wnn::GraphBuilder& builder
     return utils::BuildConstant(builder, data.shape, data.data<float>(), data.num_bytes());
 }
 
+const wnn::Operand ResNet::BuildWeightsFromNpy(const wnn::GraphBuilder& builder,
+                                               const std::string& path,
+                                               int32_t axis) {
+    if (mWeightsType != "int8") {
+        return BuildConstantFromNpy(builder, path);
+    }
+    const cnpy::NpyArray data = cnpy::npy_load(path);
+    SHARED_DATA_TYPE quantizedData(new std::vector<char>(data.num_vals));
+    mConstants.push_back(quantizedData);
+    return utils::BuildQuantizedConstant(builder, data.shape, data.data<float>(), axis,
+                                         reinterpret_cast<int8_t*>(quantizedData->data()));
+}
+
 const wnn::Operand ResNet::BuildNchwConv(const wnn::GraphBuilder& builder,
                                          const wnn::Operand& input,
                                          const std::string& name,
@@ -56,7 +69,7 @@ const wnn::Operand ResNet::BuildNchwConv(const wnn::GraphBuilder& builder,
         prefix += "conv" + name;
     }
     const std::string weightsPath = prefix + "_weight.npy";
-    const wnn::Operand convWeights = BuildConstantFromNpy(builder, weightsPath);
+    const wnn::Operand convWeights = BuildWeightsFromNpy(builder, weightsPath);
     const wnn::Conv2dOptions* conv2dOptions = options != nullptr ? options->AsPtr() : nullptr;
     return builder.Conv2d(input, convWeights, conv2dOptions);
 }
@@ -78,7 +91,7 @@ const wnn::Operand ResNet::BuildNhwcConv(const wnn::GraphBuilder& builder,
         prefix += "conv" + nameIndices[2];
     }
     const std::string weightsPath = prefix + "_weights.npy";
-    const wnn::Operand convWeights = BuildConstantFromNpy(builder, weightsPath);
+    const wnn::Operand convWeights = BuildWeightsFromNpy(builder, weightsPath);
     const std::string biasPath = prefix + "_Conv2D_bias.npy";
     const wnn::Operand convBias = BuildConstantFromNpy(builder, biasPath);
     if (!mFused) {
@@ -158,7 +171,7 @@ const wnn::Operand ResNet::BuildGemm(const wnn::GraphBuilder& builder,
                                      const std::string& name) {
     std::string prefix = mWeightsPath + "dense" + name;
     std::string weightsPath = prefix + "_weight.npy";
-    const wnn::Operand weights = BuildConstantFromNpy(builder, weightsPath);
+    const wnn::Operand weights = BuildWeightsFromNpy(builder, weightsPath);
     std::string biasPath = prefix + "_bias.npy";
     const wnn::Operand bias = BuildConstantFromNpy(builder, biasPath);
     wnn::GemmOptions gemmOptions;
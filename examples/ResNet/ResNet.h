@@ -27,6 +27,11 @@ class ResNet : public ExampleBase {
     const wnn::Operand LoadNhwc(const wnn::GraphBuilder& builder, bool softmax = true);
     const wnn::Operand BuildConstantFromNpy(const wnn::GraphBuilder& builder,
                                             const std::string& path);
+    // Builds the conv2d or gemm weights, which are quantized to int8 along the output channel
+    // axis if the int8 weights type is specified.
+    const wnn::Operand BuildWeightsFromNpy(const wnn::GraphBuilder& builder,
+                                           const std::string& path,
+                                           int32_t axis = 0);
     const wnn::Operand BuildNchwConv(const wnn::GraphBuilder& builder,
                                      const wnn::Operand& input,
                                      const std::string& name,
@@ -19,6 +19,8 @@
 #include "webnn/native/NamedInputs.h"
 #include "webnn/native/NamedOperands.h"
 #include "webnn/native/NamedOutputs.h"
+#include "webnn/utils/RingBufferCommandBuffer.h"
+#include "webnn/utils/SharedMemory.h"
 #include "webnn/utils/TerribleCommandBuffer.h"
 #include "webnn/wire/WireClient.h"
 #include "webnn/wire/WireServer.h"
@@ -37,7 +39,9 @@
 enum class CmdBufType {
     None,
     Terrible,
-    // TODO(cwallez@chromium.org): double terrible cmdbuf
+    // The server runs on its own thread and the commands go through ring buffers in shared
+    // memory.
+    RingBuffer,
 };
 
 #if defined(WEBNN_ENABLE_WIRE)
@@ -49,13 +53,62 @@ static webnn::wire::WireServer* wireServer = nullptr;
 static webnn::wire::WireClient* wireClient = nullptr;
 static utils::TerribleCommandBuffer* c2sBuf = nullptr;
 static utils::TerribleCommandBuffer* s2cBuf = nullptr;
+// The ring buffers and their memory live until the process exits since the server thread
+// is never joined.
+static utils::RingBufferCommandSerializer* c2sRingSerializer = nullptr;
+static utils::RingBufferCommandReceiver* c2sRingReceiver = nullptr;
+static utils::RingBufferCommandSerializer* s2cRingSerializer = nullptr;
+static utils::RingBufferCommandReceiver* s2cRingReceiver = nullptr;
+constexpr size_t kRingBufferCapacity = 4 * 1024 * 1024;
+constexpr uint32_t kRingBufferComputeThreadCount = 2;
+
+static utils::RingBuffer* CreateRingBuffer() {
+    utils::SharedMemory* memory =
+        utils::SharedMemory::Create(utils::RingBuffer::GetRequiredSize(kRingBufferCapacity))
+            .release();
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    utils::RingBuffer* ring = new utils::RingBuffer(memory->GetData(), memory->GetSize());
+    ring->Initialize();
+    return ring;
+}
+
+void SetWireTransport(const std::string& transport) {
+#if defined(WEBNN_ENABLE_WIRE)
+    if (transport == "terrible") {
+        cmdBufType = CmdBufType::Terrible;
+    } else if (transport == "ring") {
+        cmdBufType = CmdBufType::RingBuffer;
+    } else {
+        dawn::ErrorLog() << "Invalid wire transport " << transport;
+    }
+#endif  // defined(WEBNN_ENABLE_WIRE)
+}
+
+static bool useNullBackend = false;
+
+void SetBackend(const std::string& backend) {
+    if (backend == "null") {
+        useNullBackend = true;
+    } else if (backend == "default") {
+        useNullBackend = false;
+    } else {
+        dawn::ErrorLog() << "Invalid backend " << backend;
+    }
+}
+
+bool IsNullBackend() {
+    return useNullBackend;
+}
 
 static wnn::Instance clientInstance;
 static std::unique_ptr<webnn::native::Instance> nativeInstance;
 wnn::Context CreateCppContext(wnn::ContextOptions const* options) {
     nativeInstance = std::make_unique<webnn::native::Instance>();
     WebnnProcTable backendProcs = webnn::native::GetProcs();
-    WNNContext backendContext = nativeInstance->CreateContext(options);
+    WNNContext backendContext = useNullBackend ? nativeInstance->CreateTestContext(options)
+                                               : nativeInstance->CreateContext(options);
     if (backendContext == nullptr) {
         return wnn::Context();
     }
@@ -69,28 +122,65 @@ wnn::Context CreateCppContext(wnn::ContextOptions const* options) {
             context = backendContext;
             break;
 
-        case CmdBufType::Terrible: {
-            c2sBuf = new utils::TerribleCommandBuffer();
-            s2cBuf = new utils::TerribleCommandBuffer();
+        case CmdBufType::Terrible:
+        case CmdBufType::RingBuffer: {
+            webnn::wire::CommandSerializer* c2sSerializer;
+            webnn::wire::CommandSerializer* s2cSerializer;
+            utils::RingBuffer* c2sRing = nullptr;
+            utils::RingBuffer* s2cRing = nullptr;
+            if (cmdBufType == CmdBufType::Terrible) {
+                c2sBuf = new utils::TerribleCommandBuffer();
+                s2cBuf = new utils::TerribleCommandBuffer();
+                c2sSerializer = c2sBuf;
+                s2cSerializer = s2cBuf;
+            } else {
+                c2sRing = CreateRingBuffer();
+                s2cRing = CreateRingBuffer();
+                if (c2sRing == nullptr || s2cRing == nullptr) {
+                    dawn::ErrorLog() << "Failed to create the ring buffers of the wire.";
+                    return wnn::Context();
+                }
+                c2sRingSerializer = new utils::RingBufferCommandSerializer(c2sRing);
+                s2cRingSerializer = new utils::RingBufferCommandSerializer(s2cRing);
+                c2sSerializer = c2sRingSerializer;
+                s2cSerializer = s2cRingSerializer;
+            }
 
             webnn::wire::WireServerDescriptor serverDesc = {};
             serverDesc.procs = &backendProcs;
-            serverDesc.serializer = s2cBuf;
+            serverDesc.serializer = s2cSerializer;
+            serverDesc.constantWithBuffer = webnn::native::GraphBuilderConstantWithBuffer;
+            serverDesc.namedInputsSetWithoutCopy = webnn::native::NamedInputsSetWithoutCopy;
+            // The compute threads flush the serializer, which is only safe with the ring buffers
+            // since TerribleCommandBuffer handles the commands on the flushing thread.
+            if (cmdBufType == CmdBufType::RingBuffer) {
+                serverDesc.computeThreadCount = kRingBufferComputeThreadCount;
+            }
 
             wireServer = new webnn::wire::WireServer(serverDesc);
-            c2sBuf->SetHandler(wireServer);
 
             webnn::wire::WireClientDescriptor clientDesc = {};
-            clientDesc.serializer = c2sBuf;
+            clientDesc.serializer = c2sSerializer;
 
             wireClient = new webnn::wire::WireClient(clientDesc);
             procs = webnn::wire::client::GetProcs();
-            s2cBuf->SetHandler(wireClient);
+
+            if (cmdBufType == CmdBufType::Terrible) {
+                c2sBuf->SetHandler(wireServer);
+                s2cBuf->SetHandler(wireClient);
+            } else {
+                c2sRingReceiver = new utils::RingBufferCommandReceiver(
+                    c2sRing, wireServer, []() { return wireServer->Flush(); });
+                s2cRingReceiver = new utils::RingBufferCommandReceiver(s2cRing, wireClient);
+            }
 
 #ifdef ENABLE_INJECT_CONTEXT
             auto contextReservation = wireClient->ReserveContext();
             wireServer->InjectContext(backendContext, contextReservation.id,
                                       contextReservation.generation);
+            if (c2sRingReceiver != nullptr) {
+                c2sRingReceiver->Start();
+            }
 
             context = contextReservation.context;
 #else
@@ -98,9 +188,24 @@ wnn::Context CreateCppContext(wnn::ContextOptions const* options) {
             auto instanceReservation = wireClient->ReserveInstance();
             wireServer->InjectInstance(nativeInstance->Get(), instanceReservation.id,
                                        instanceReservation.generation);
+            // The instance creates the contexts of the default backend, so the null context is
+            // injected instead.
+            if (useNullBackend) {
+                auto contextReservation = wireClient->ReserveContext();
+                wireServer->InjectContext(backendContext, contextReservation.id,
+                                          contextReservation.generation);
+                context = contextReservation.context;
+            }
+            // The objects are injected before the server thread starts.
+            if (c2sRingReceiver != nullptr) {
+                c2sRingReceiver->Start();
+            }
             // Keep the reference instread of using Acquire.
             // TODO:: make the instance in the client as singleton object.
             clientInstance = wnn::Instance(instanceReservation.instance);
+            if (useNullBackend) {
+                return wnn::Context::Acquire(context);
+            }
             return clientInstance.CreateContext(options);
 #endif
         }
@@ -114,12 +219,69 @@ wnn::Context CreateCppContext(wnn::ContextOptions const* options) {
 }
 
 void DoFlush() {
+    // The client flushes its serializer, the commands building the graphs may be serialized in
+    // place until then.
     if (cmdBufType == CmdBufType::Terrible) {
-        bool c2sSuccess = c2sBuf->Flush();
+        bool c2sSuccess = wireClient->Flush();
         bool s2cSuccess = s2cBuf->Flush();
 
         ASSERT(c2sSuccess && s2cSuccess);
+    } else if (cmdBufType == CmdBufType::RingBuffer) {
+        // Waits until the server handled the commands and completed the computes, the responses
+        // are handled meanwhile so the server never waits for a full ring. The computes are
+        // posted before the commands are handled, so they are checked after.
+        bool c2sSuccess = wireClient->Flush();
+        bool s2cSuccess = s2cRingReceiver->ProcessCommandsUntil([]() {
+            return c2sRingSerializer->IsHandled() && !wireServer->HasPendingComputes();
+        });
+
+        ASSERT(c2sSuccess && s2cSuccess);
+    }
+}
+
+bool IsWireEnabled() {
+    return cmdBufType != CmdBufType::None;
+}
+
+bool RegisterSharedMemory(uint32_t id, void* clientData, void* serverData, size_t size) {
+    if (cmdBufType != CmdBufType::None) {
+        // The server thread is idle once the commands are handled.
+        DoFlush();
+        return wireClient->RegisterSharedMemory(id, clientData, size) &&
+               wireServer->RegisterSharedMemory(id, serverData, size);
     }
+    return true;
+}
+
+void UnregisterSharedMemory(uint32_t id) {
+    if (cmdBufType != CmdBufType::None) {
+        DoFlush();
+        wireClient->UnregisterSharedMemory(id);
+        wireServer->UnregisterSharedMemory(id);
+    }
+}
+
+bool GetWireAllocatorStats(webnn::wire::DeserializeAllocatorStats* serverStats,
+                           webnn::wire::DeserializeAllocatorStats* clientStats) {
+    if (cmdBufType == CmdBufType::None) {
+        return false;
+    }
+    // The server thread is idle once the commands are handled.
+    DoFlush();
+    *serverStats = wireServer->GetDeserializeAllocatorStats();
+    *clientStats = wireClient->GetDeserializeAllocatorStats();
+    return true;
+}
+
+bool GetWireClientSerializedBytes(uint64_t* byteCount) {
+    if (cmdBufType == CmdBufType::Terrible) {
+        *byteCount = c2sBuf->GetSerializedByteCount();
+        return true;
+    } else if (cmdBufType == CmdBufType::RingBuffer) {
+        *byteCount = c2sRingSerializer->GetSerializedByteCount();
+        return true;
+    }
+    return false;
 }
 
 wnn::NamedInputs CreateCppNamedInputs() {
@@ -172,6 +334,10 @@ bool ExampleBase::ParseAndCheckExampleOptions(int argc, const char* argv[]) {
             mDevicePreference = argv[i + 1];
         } else if (strcmp("-p", argv[i]) == 0 && i + 1 < argc) {
             mPowerPreference = argv[i + 1];
+        } else if (strcmp("-w", argv[i]) == 0 && i + 1 < argc) {
+            mWeightsType = argv[i + 1];
+        } else if (strcmp("-s", argv[i]) == 0 && i + 1 < argc) {
+            mSparsity = atof(argv[i + 1]);
         }
     }
 
@@ -180,7 +346,9 @@ bool ExampleBase::ParseAndCheckExampleOptions(int argc, const char* argv[]) {
         (mDevicePreference != "gpu" && mDevicePreference != "cpu" &&
          mDevicePreference != "default") ||
         (mPowerPreference != "high-performance" && mPowerPreference != "low-power" &&
-         mPowerPreference != "default")) {
+         mPowerPreference != "default") ||
+        (mWeightsType != "float32" && mWeightsType != "int8") || mSparsity < 0 ||
+        mSparsity >= 1) {
         dawn::ErrorLog() << "Invalid options.";
         utils::ShowUsage();
         return false;
@@ -282,6 +450,71 @@ namespace utils {
         return builder.Constant(&desc, &arrayBuffer);
     }
 
+    void PruneWeights(float* value, size_t size, float sparsity) {
+        const size_t zeroCount = static_cast<size_t>(size * sparsity);
+        if (zeroCount == 0) {
+            return;
+        }
+        std::vector<float> magnitudes(size);
+        for (size_t i = 0; i < size; ++i) {
+            magnitudes[i] = std::fabs(value[i]);
+        }
+        std::nth_element(magnitudes.begin(), magnitudes.begin() + zeroCount - 1,
+                         magnitudes.end());
+        const float threshold = magnitudes[zeroCount - 1];
+        for (size_t i = 0; i < size; ++i) {
+            if (std::fabs(value[i]) <= threshold) {
+                value[i] = 0;
+            }
+        }
+    }
+
+    wnn::Operand BuildQuantizedConstant(const wnn::GraphBuilder& builder,
+                                        const std::vector<int32_t>& dimensions,
+                                        const float* value,
+                                        int32_t axis,
+                                        int8_t* quantizedValue) {
+        const uint32_t size = SizeOfShape(dimensions);
+        const uint32_t channels = dimensions[axis];
+        uint32_t innerSize = 1;
+        for (size_t i = axis + 1; i < dimensions.size(); ++i) {
+            innerSize *= dimensions[i];
+        }
+        std::vector<float> scales(channels, 0);
+        for (uint32_t i = 0; i < size; ++i) {
+            float& scale = scales[(i / innerSize) % channels];
+            scale = std::max(scale, std::fabs(value[i]));
+        }
+        for (auto& scale : scales) {
+            // Map the max absolute value of each channel to 127.
+            scale = scale == 0 ? 1.0f : scale / 127.0f;
+        }
+        for (uint32_t i = 0; i < size; ++i) {
+            const float scaled = std::round(value[i] / scales[(i / innerSize) % channels]);
+            quantizedValue[i] = static_cast<int8_t>(std::min(std::max(scaled, -127.0f), 127.0f));
+        }
+        wnn::Operand constant =
+            BuildConstant(builder, dimensions, quantizedValue, size, wnn::OperandType::Int8);
+        wnn::QuantizationParams params;
+        params.scalesCount = scales.size();
+        params.scales = scales.data();
+        params.axis = axis;
+        builder.SetQuantizationParams(constant, &params);
+        return constant;
+    }
+
+    void SetQuantizationParams(const wnn::GraphBuilder& builder,
+                               const wnn::Operand& operand,
+                               float scale,
+                               int32_t zeroPoint) {
+        wnn::QuantizationParams params;
+        params.scalesCount = 1;
+        params.scales = &scale;
+        params.zeroPointsCount = 1;
+        params.zeroPoints = &zeroPoint;
+        builder.SetQuantizationParams(operand, &params);
+    }
+
     wnn::Graph Build(const wnn::GraphBuilder& builder, const std::vector<NamedOperand>& outputs) {
         wnn::NamedOperands namedOperands = CreateCppNamedOperands();
         for (auto& output : outputs) {
@@ -435,6 +668,15 @@ namespace utils {
                      "or \"high-performance\" or "
                      "\"low-power\". The default value is \"default\"."
                   << std::endl;
+        std::cout << "    -w \"<weights type>\"     "
+                  << "Optional. Specify the type of conv2d and gemm weights: \"float32\" or "
+                     "\"int8\". The int8 weights are quantized per output channel. The default "
+                     "value is \"float32\"."
+                  << std::endl;
+        std::cout << "    -s \"<sparsity>\"         "
+                  << "Optional. Prune the 1x1 conv2d weights to the sparsity in [0, 1) and enable "
+                     "sparse inference. The default value is 0."
+                  << std::endl;
     }
 
     void PrintExexutionTime(std::vector<TIME_TYPE> executionTime) {
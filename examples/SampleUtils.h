@@ -18,6 +18,7 @@
 
 #include <webnn/webnn.h>
 #include <webnn/webnn_cpp.h>
+#include <webnn/wire/Wire.h>
 #include <condition_variable>
 #include <mutex>
 #include <vector>
@@ -50,14 +51,36 @@ class ExampleBase {
     std::vector<int32_t> mOutputShape;
     std::string mDevicePreference = "default";
     std::string mPowerPreference = "default";
+    std::string mWeightsType = "float32";
+    float mSparsity = 0;
     bool mFused = true;
 };
 
+// Selects the transport of the wire before the context is created, "terrible" hands the
+// commands synchronously to the other side and "ring" runs the server on its own thread with
+// ring buffers in between. It's ignored without the wire.
+void SetWireTransport(const std::string& transport);
+// Selects the backend before the context is created, "null" builds and computes nothing so the
+// overhead of the wire is measured alone, "default" uses the backend of the build.
+void SetBackend(const std::string& backend);
+bool IsNullBackend();
 wnn::Context CreateCppContext(wnn::ContextOptions const* options = nullptr);
 wnn::NamedInputs CreateCppNamedInputs();
 wnn::NamedOutputs CreateCppNamedOutputs();
 wnn::OperatorArray CreateCppOperatorArray();
 void DoFlush();
+// Returns true if the commands go through the wire.
+bool IsWireEnabled();
+// Registers the shared memory region mapped by the client and the server with the wire, it's
+// a no-op without the wire.
+bool RegisterSharedMemory(uint32_t id, void* clientData, void* serverData, size_t size);
+void UnregisterSharedMemory(uint32_t id);
+// Gets the stats of the deserialize allocators of the wire server and client once the commands
+// are flushed, returns false without the wire.
+bool GetWireAllocatorStats(webnn::wire::DeserializeAllocatorStats* serverStats,
+                           webnn::wire::DeserializeAllocatorStats* clientStats);
+// Gets the bytes of the commands serialized by the wire client, returns false without the wire.
+bool GetWireClientSerializedBytes(uint64_t* byteCount);
 
 bool Expected(float output, float expected);
 
@@ -94,6 +117,25 @@ namespace utils {
                                size_t size,
                                wnn::OperandType type = wnn::OperandType::Float32);
 
+    // Prunes the weights with the smallest magnitude to zero, until the ratio of zeros reaches
+    // the sparsity.
+    void PruneWeights(float* value, size_t size, float sparsity);
+
+    // Quantizes the float32 value to int8 symmetrically with one scale per slice along the axis,
+    // and builds a quantized constant from it. The `quantizedValue` receives the int8 data and
+    // must outlive the graph building.
+    wnn::Operand BuildQuantizedConstant(const wnn::GraphBuilder& builder,
+                                        const std::vector<int32_t>& dimensions,
+                                        const float* value,
+                                        int32_t axis,
+                                        int8_t* quantizedValue);
+
+    // Quantizes the operand per tensor, real_value = scale * (quantized_value - zero_point).
+    void SetQuantizationParams(const wnn::GraphBuilder& builder,
+                               const wnn::Operand& operand,
+                               float scale,
+                               int32_t zeroPoint = 0);
+
     template <typename T>
     struct Conv2dBaseOptions {
       public:
@@ -258,7 +300,7 @@ namespace utils {
         for (auto& input : inputs) {
             wnn::Input wnninput = {};
             wnninput.resource.arrayBufferView = {(void*)input.resource.data(),
-                                                 input.resource.size() * sizeof(float)};
+                                                 input.resource.size() * sizeof(T)};
             mlInputs.push_back(wnninput);
             namedInputs.Set(input.name.c_str(), &mlInputs.back());
         }
@@ -270,7 +312,7 @@ namespace utils {
         for (auto& output : outputs) {
             wnn::Resource resource = {};
             resource.arrayBufferView.buffer = output.resource.data();
-            resource.arrayBufferView.byteLength = output.resource.size() * sizeof(float);
+            resource.arrayBufferView.byteLength = output.resource.size() * sizeof(T);
             mlOutputs.push_back(resource);
             namedOutputs.Set(output.name.c_str(), &mlOutputs.back());
         }
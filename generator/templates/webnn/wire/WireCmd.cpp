@@ -310,6 +310,12 @@
                 auto memberBuffer = reinterpret_cast<const volatile {{member_transfer_type(member)}}*>(buffer);
                 DESERIALIZE_TRY(GetPtrFromBuffer(buffer, size, memberLength, &memberBuffer));
 
+                {% if member.skip_serialize %}
+                    //* The payload streamed after the command is only bytes read by the handler,
+                    //* it's referenced in place instead of being copied into the allocator.
+                    {{assert(member.type.category == "native")}}
+                    record->{{memberName}} = const_cast<const {{as_cType(member.type.name)}}*>(memberBuffer);
+                {% else %}
                 {{as_cType(member.type.name)}}* copiedMembers = nullptr;
                 DESERIALIZE_TRY(GetSpace(allocator, memberLength, &copiedMembers));
                 {% if member.annotation == "const*const*" %}
@@ -326,6 +332,7 @@
                 for (size_t i = 0; i < memberLength; ++i) {
                     {{deserialize_member(member, "memberBuffer[i]", "copiedMembers[i]")}}
                 }
+                {% endif %}
             }
         {% endfor %}
 
@@ -161,8 +161,14 @@ namespace webnn::wire::client {
                         cmd.{{as_varName(arg.name)}} = {{as_varName(arg.name)}};
                     {% endfor %}
 
-                    //* Allocate space to send the command and copy the value args over.
-                    self->client->SerializeCommand(cmd);
+                    //* Allocate space to send the command and copy the value args over. The
+                    //* commands building the graphs are coalesced until another command is sent,
+                    //* so the build command closes the batch of the graph it builds.
+                    {% if type.name.get() == "graph builder" and method.name.get() != "build" %}
+                        self->client->SerializeGraphBuilderCommand(cmd);
+                    {% else %}
+                        self->client->SerializeCommand(cmd);
+                    {% endif %}
 
                     {% if method.return_type.category == "object" %}
                         return reinterpret_cast<{{as_cType(method.return_type.name)}}>(allocation->object.get());
@@ -189,7 +195,13 @@ namespace webnn::wire::client {
             cmd.objectType = ObjectType::{{type.name.CamelCase()}};
             cmd.objectId = obj->id;
 
-            obj->client->SerializeCommand(cmd);
+            //* The operands are usually released together after the graph is built, so their
+            //* releases are coalesced with the commands of the builders.
+            {% if type.name.get() in ["operand", "operand array", "fusion operator"] %}
+                obj->client->SerializeGraphBuilderCommand(cmd);
+            {% else %}
+                obj->client->SerializeCommand(cmd);
+            {% endif %}
             obj->client->{{type.name.CamelCase()}}Allocator().Free(obj);
         }
 
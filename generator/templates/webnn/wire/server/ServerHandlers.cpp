@@ -144,4 +144,34 @@ namespace webnn::wire::server {
         return commands;
     }
 
+    //* The commands coalesced by the client while building the graphs, only the commands of the
+    //* graph builders and the releases of their objects are accepted. The data of the large
+    //* constants is sent ahead of the batches referencing it, so it's never batched. The padding
+    //* after the batched commands isn't read.
+    bool Server::HandleGraphBuilderBatch(const volatile char* commands, size_t size) {
+        while (size >= sizeof(CmdHeader) + sizeof(WireCmd)) {
+            WireCmd cmdId = *reinterpret_cast<const volatile WireCmd*>(commands + sizeof(CmdHeader));
+            bool success = false;
+            switch (cmdId) {
+                {% for command in cmd_records["command"] if command.name.get().startswith("graph builder ") and command.name.get() not in ["graph builder build", "graph builder batch", "graph builder constant data"] %}
+                    case WireCmd::{{command.name.CamelCase()}}:
+                        success = Handle{{command.name.CamelCase()}}(&commands, &size);
+                        break;
+                {% endfor %}
+                case WireCmd::DestroyObject:
+                    success = HandleDestroyObject(&commands, &size);
+                    break;
+                default:
+                    success = false;
+            }
+
+            if (!success) {
+                return false;
+            }
+            mAllocator.ResetBatchedCommand();
+        }
+
+        return size == 0;
+    }
+
 }  // namespace webnn::wire::server
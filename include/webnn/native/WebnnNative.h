@@ -55,6 +55,23 @@ namespace webnn::native {
     // Backend-agnostic API for webnn_native
     WEBNN_NATIVE_EXPORT const WebnnProcTable& GetProcs();
 
+    // Sets the input without copying its buffer, see NamedInputsBase::SetWithoutCopy. It's
+    // given to the wire server for the inputs in shared memory, it isn't part of the WebNN API.
+    WEBNN_NATIVE_EXPORT void NamedInputsSetWithoutCopy(WNNNamedInputs namedInputs,
+                                                       char const* name,
+                                                       WNNInput const* input);
+
+    // Creates a constant which uses the |byteLength| bytes at |buffer| in place instead of
+    // copying them, |release| is called with |userdata| once the constant is destroyed. It's
+    // given to the wire server to hand over the large payloads it received, it isn't part of
+    // the WebNN API.
+    WEBNN_NATIVE_EXPORT WNNOperand GraphBuilderConstantWithBuffer(WNNGraphBuilder builder,
+                                                                  WNNOperandDescriptor const* desc,
+                                                                  const void* buffer,
+                                                                  size_t byteLength,
+                                                                  void (*release)(void* userdata),
+                                                                  void* userdata);
+
 }  // namespace webnn::native
 
 #endif  // WEBNN_NATIVE_WEBNN_NATIVE_H_
@@ -43,6 +43,22 @@ namespace webnn::wire {
         virtual const volatile char* HandleCommands(const volatile char* commands, size_t size) = 0;
     };
 
+    // The statistics of the space used to deserialize the received commands. The space is
+    // reused by the following commands, so the system allocations stop growing with the
+    // command count once the capacity reaches the high water size.
+    struct WEBNN_WIRE_EXPORT DeserializeAllocatorStats {
+        // The commands received, and the commands coalesced in the graph builder batches, which
+        // aren't counted as received commands.
+        uint64_t commandCount = 0;
+        uint64_t batchedCommandCount = 0;
+        // The spaces got from the allocator, and the blocks it allocated from the system.
+        uint64_t spaceCount = 0;
+        uint64_t systemAllocationCount = 0;
+        // The bytes held for deserializing, and the most bytes used by a single command.
+        size_t capacity = 0;
+        size_t highWaterSize = 0;
+    };
+
 }  // namespace webnn::wire
 
 #endif  // WEBNN_WIRE_WIRE_H_
@@ -31,6 +31,8 @@ namespace webnn::wire {
     }  // namespace client
 
     struct WEBNN_WIRE_EXPORT WireClientDescriptor {
+        // The commands building the graphs are serialized in place into the space of the
+        // serializer until another command is sent, so it's flushed with WireClient::Flush.
         CommandSerializer* serializer;
     };
 
@@ -80,10 +82,24 @@ namespace webnn::wire {
         ReservedNamedOperands ReserveNamedOperands();
         ReservedNamedOutputs ReserveNamedOutputs();
 
+        // Registers the shared memory region mapped at |data| in this process with the id, the
+        // tensors inside a region are referenced by the commands instead of being copied into
+        // the command stream. The region must be registered with the same id on the other side
+        // of the wire and stay mapped until the objects using it are destroyed.
+        bool RegisterSharedMemory(uint32_t id, void* data, size_t size);
+        void UnregisterSharedMemory(uint32_t id);
+
+        // Closes the batch of the commands building the graphs and flushes the serializer. The
+        // serializer must not be flushed directly, the batch may still be serialized into its
+        // space.
+        bool Flush();
+
         // Disconnects the client.
         // Commands allocated after this point will not be sent.
         void Disconnect();
 
+        DeserializeAllocatorStats GetDeserializeAllocatorStats() const;
+
       private:
         std::unique_ptr<client::Client> mImpl;
     };
@@ -35,9 +35,36 @@ namespace webnn::wire {
         class MemoryTransferService;
     }  // namespace server
 
+    // Creates a constant which uses the |byteLength| bytes at |buffer| in place and calls
+    // |release| with |userdata| once it's destroyed, e.g.
+    // webnn::native::GraphBuilderConstantWithBuffer. The buffer is released by the callback of
+    // the server, so it's never freed by another module.
+    using ConstantWithBufferProc = WNNOperand (*)(WNNGraphBuilder builder,
+                                                  WNNOperandDescriptor const* desc,
+                                                  const void* buffer,
+                                                  size_t byteLength,
+                                                  void (*release)(void* userdata),
+                                                  void* userdata);
+
+    // Sets the input without copying its buffer, e.g. webnn::native::NamedInputsSetWithoutCopy.
+    using NamedInputsSetWithoutCopyProc = void (*)(WNNNamedInputs namedInputs,
+                                                   char const* name,
+                                                   WNNInput const* input);
+
     struct WEBNN_WIRE_EXPORT WireServerDescriptor {
         const WebnnProcTable* procs;
         CommandSerializer* serializer;
+        // The number of threads computing the graphs off the command handling thread, the graphs
+        // are computed while handling the commands if it's 0. Otherwise the serializer is also
+        // called and flushed by the compute threads, one thread at a time, so the responses
+        // must be flushed with WireServer::Flush.
+        uint32_t computeThreadCount = 0;
+        // Optional, the server hands the data of the large constants it received over to the
+        // graph builders with it. The procs copy the data otherwise.
+        ConstantWithBufferProc constantWithBuffer = nullptr;
+        // Optional, the server sets the inputs in shared memory in place with it. The procs copy
+        // the data otherwise, so the client may write the region once the set is handled.
+        NamedInputsSetWithoutCopyProc namedInputsSetWithoutCopy = nullptr;
     };
 
     class WEBNN_WIRE_EXPORT WireServer : public CommandHandler {
@@ -62,6 +89,23 @@ namespace webnn::wire {
         bool InjectNamedOperands(WNNNamedOperands namedOperands, uint32_t id, uint32_t generation);
         bool InjectNamedOutputs(WNNNamedOutputs namedOutputs, uint32_t id, uint32_t generation);
 
+        // Registers the shared memory region mapped at |data| in this process with the id, the
+        // tensors inside a region are referenced by the commands instead of being copied into
+        // the command stream. The region must be registered with the same id on the other side
+        // of the wire and stay mapped until the objects using it are destroyed. The inputs set
+        // in place must not be written until the computes using them are done.
+        bool RegisterSharedMemory(uint32_t id, void* data, size_t size);
+        void UnregisterSharedMemory(uint32_t id);
+
+        // Flushes the responses serialized by the command handling thread.
+        bool Flush();
+        // Returns true until the results of the computes posted to the compute threads are
+        // flushed.
+        bool HasPendingComputes() const;
+
+        // Not synchronized with the command handling thread, call it between HandleCommands.
+        DeserializeAllocatorStats GetDeserializeAllocatorStats() const;
+
       private:
         std::unique_ptr<server::Server> mImpl;
     };
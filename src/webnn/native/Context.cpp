@@ -32,6 +32,11 @@ namespace webnn::native {
     {
         if (options != nullptr) {
             mContextOptions = *options;
+            // The options may be released after the context is created.
+            if (options->cacheDirectory != nullptr) {
+                mCacheDirectory = options->cacheDirectory;
+                mContextOptions.cacheDirectory = mCacheDirectory.c_str();
+            }
         }
         mRootErrorScope = AcquireRef(new ErrorScope());
         mCurrentErrorScope = mRootErrorScope.Get();
@@ -84,10 +89,12 @@ namespace webnn::native {
         if (ConsumedError(ValidateErrorFilter(filter))) {
             return;
         }
+        std::lock_guard<std::recursive_mutex> lock(mErrorScopeMutex);
         mCurrentErrorScope = AcquireRef(new ErrorScope(filter, mCurrentErrorScope.Get()));
     }
 
     bool ContextBase::PopErrorScope(wnn::ErrorCallback callback, void* userdata) {
+        std::lock_guard<std::recursive_mutex> lock(mErrorScopeMutex);
         if (DAWN_UNLIKELY(mCurrentErrorScope.Get() == mRootErrorScope.Get())) {
             return false;
         }
@@ -98,6 +105,7 @@ namespace webnn::native {
     }
 
     void ContextBase::SetUncapturedErrorCallback(wnn::ErrorCallback callback, void* userdata) {
+        std::lock_guard<std::recursive_mutex> lock(mErrorScopeMutex);
         mRootErrorScope->SetCallback(callback, userdata);
     }
 
@@ -112,6 +120,7 @@ namespace webnn::native {
 
         // Still forward device loss and internal errors to the error scopes so they
         // all reject.
+        std::lock_guard<std::recursive_mutex> lock(mErrorScopeMutex);
         mCurrentErrorScope->HandleError(ToWNNErrorType(error->GetType()), ss.str().c_str());
     }
 
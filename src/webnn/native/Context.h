@@ -20,6 +20,9 @@
 #include "webnn/native/ErrorScope.h"
 #include "webnn/native/webnn_platform.h"
 
+#include <mutex>
+#include <string>
+
 #if defined(WEBNN_ENABLE_GPU_BUFFER)
 #    include <webgpu/webgpu.h>
 #endif
@@ -73,10 +76,15 @@ namespace webnn::native {
 
         void HandleError(std::unique_ptr<ErrorData> error);
 
+        // The graphs may be computed off the thread of the context, e.g. by the workers of the
+        // wire server, so the error scopes are guarded. It's recursive since the callbacks may
+        // call back into the context.
+        std::recursive_mutex mErrorScopeMutex;
         Ref<ErrorScope> mRootErrorScope;
         Ref<ErrorScope> mCurrentErrorScope;
 
         ContextOptions mContextOptions;
+        std::string mCacheDirectory;
 #if defined(WEBNN_ENABLE_GPU_BUFFER)
         WGPUDevice mWGPUDevice;
 #endif
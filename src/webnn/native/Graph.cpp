@@ -147,7 +147,15 @@ namespace webnn::native {
                                  void* userdata) {
         if (inputs == nullptr || outputs == nullptr) {
             callback(WNNErrorType_Validation, "named inputs or outputs is empty.", userdata);
+            return;
         }
+        ComputeAsyncImpl(inputs, outputs, callback, userdata);
+    }
+
+    void GraphBase::ComputeAsyncImpl(NamedInputsBase* inputs,
+                                     NamedOutputsBase* outputs,
+                                     WNNComputeAsyncCallback callback,
+                                     void* userdata) {
         MaybeError maybeError = ComputeImpl(inputs, outputs);
         if (maybeError.IsError()) {
             std::unique_ptr<ErrorData> errorData = maybeError.AcquireError();
@@ -158,6 +166,29 @@ namespace webnn::native {
         }
     }
 
+    void GraphBase::Bind(uint32_t index, NamedInputsBase* inputs, NamedOutputsBase* outputs) {
+        GetContext()->ConsumedError(BindImpl(index, inputs, outputs));
+    }
+
+    void GraphBase::ComputeBound(uint32_t index) {
+        GetContext()->ConsumedError(ComputeBoundImpl(index));
+    }
+
+    MaybeError GraphBase::BindImpl(uint32_t index,
+                                   NamedInputsBase* inputs,
+                                   NamedOutputsBase* outputs) {
+        DAWN_INVALID_IF(inputs == nullptr || outputs == nullptr,
+                        "named inputs or outputs is empty.");
+        mBindings[index] = std::make_pair(inputs, outputs);
+        return {};
+    }
+
+    MaybeError GraphBase::ComputeBoundImpl(uint32_t index) {
+        auto binding = mBindings.find(index);
+        DAWN_INVALID_IF(binding == mBindings.end(), "The buffer set isn't bound.");
+        return ComputeImpl(binding->second.first.Get(), binding->second.second.Get());
+    }
+
     GraphBase::GraphBase(ContextBase* context, ObjectBase::ErrorTag tag)
         : ObjectBase(context, tag) {
     }
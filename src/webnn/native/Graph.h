@@ -15,11 +15,15 @@
 #ifndef WEBNN_NATIVE_GRAPH_H_
 #define WEBNN_NATIVE_GRAPH_H_
 
+#include <map>
+
 #include "common/RefCounted.h"
 #include "webnn/native/Context.h"
 #include "webnn/native/Error.h"
 #include "webnn/native/Forward.h"
 #include "webnn/native/GraphBuilder.h"
+#include "webnn/native/NamedInputs.h"
+#include "webnn/native/NamedOutputs.h"
 #include "webnn/native/ObjectBase.h"
 #include "webnn/native/Operand.h"
 #include "webnn/native/webnn_platform.h"
@@ -87,6 +91,10 @@ namespace webnn::native {
                           NamedOutputsBase* outputs,
                           WNNComputeAsyncCallback callback,
                           void* userdata);
+        // Binds the inputs and outputs as the buffer set of the index, the buffer set is
+        // selected by index to compute without checking the buffers again.
+        void Bind(uint32_t index, NamedInputsBase* inputs, NamedOutputsBase* outputs);
+        void ComputeBound(uint32_t index);
 
         GraphBase(ContextBase* context, ObjectBase::ErrorTag tag);
         static GraphBase* MakeError(ContextBase* context);
@@ -94,6 +102,19 @@ namespace webnn::native {
       private:
         virtual MaybeError CompileImpl() = 0;
         virtual MaybeError ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) = 0;
+        // The backends which can't run the compute in the background compute synchronously and
+        // call the callback before returning.
+        virtual void ComputeAsyncImpl(NamedInputsBase* inputs,
+                                      NamedOutputsBase* outputs,
+                                      WNNComputeAsyncCallback callback,
+                                      void* userdata);
+        // The backends which don't override them compute the bound buffer sets as usual.
+        virtual MaybeError BindImpl(uint32_t index,
+                                    NamedInputsBase* inputs,
+                                    NamedOutputsBase* outputs);
+        virtual MaybeError ComputeBoundImpl(uint32_t index);
+
+        std::map<uint32_t, std::pair<Ref<NamedInputsBase>, Ref<NamedOutputsBase>>> mBindings;
     };
 }  // namespace webnn::native
 
@@ -117,6 +117,14 @@ namespace webnn::native {
         VALIDATE_FOR_OPERAND(new op::Constant(this, desc, arrayBuffer));
     }
 
+    OperandBase* GraphBuilderBase::Constant(OperandDescriptor const* desc,
+                                            const void* buffer,
+                                            size_t byteLength,
+                                            void (*release)(void* userdata),
+                                            void* userdata) {
+        VALIDATE_FOR_OPERAND(new op::Constant(this, desc, buffer, byteLength, release, userdata));
+    }
+
     OperandBase* GraphBuilderBase::ConstantWithGpuBuffer(OperandDescriptor const* desc,
                                                          GpuBufferView const* gpuBuffer) {
 #if defined(WEBNN_ENABLE_GPU_BUFFER)
@@ -298,6 +306,11 @@ namespace webnn::native {
         VALIDATE_FOR_OPERAND(new op::Reshape(this, input, new_shape, new_shape_count));
     }
 
+    void GraphBuilderBase::SetQuantizationParams(OperandBase* operand,
+                                                 QuantizationParams const* params) {
+        GetContext()->ConsumedError(operand->SetQuantizationParams(params));
+    }
+
     OperandBase* GraphBuilderBase::Sigmoid(OperandBase* input) {
         VALIDATE_FOR_OPERAND(new op::Unary(this, op::UnaryOpType::kSigmoid, input));
     }
@@ -92,6 +92,7 @@ namespace webnn::native {
         FusionOperatorBase* ReluOperator();
         OperandBase* Resample2d(OperandBase*, Resample2dOptions const* options);
         OperandBase* Reshape(OperandBase*, int32_t const*, size_t);
+        void SetQuantizationParams(OperandBase*, QuantizationParams const* params);
         OperandBase* Sigmoid(OperandBase*);
         FusionOperatorBase* SigmoidOperator();
         OperandBase* Sin(OperandBase*);
@@ -115,6 +116,15 @@ namespace webnn::native {
 
         GraphBase* Build(NamedOperandsBase const* namedOperands);
 
+        // Not part of the WebNN API, the constant uses the |byteLength| bytes at |buffer| in
+        // place and calls |release| with |userdata| once it's destroyed. The wire server hands
+        // over the payloads it received this way.
+        OperandBase* Constant(OperandDescriptor const* desc,
+                              const void* buffer,
+                              size_t byteLength,
+                              void (*release)(void* userdata),
+                              void* userdata);
+
       private:
         ResultOrError<Ref<GraphBase>> BuildImpl(NamedOperandsBase const* namedOperands);
 
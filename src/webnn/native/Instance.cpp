@@ -185,7 +185,11 @@ namespace webnn::native {
     }
 
     ContextBase* InstanceBase::CreateTestContext(const ContextOptions* options) {
-        ASSERT(mBackends.find(wnn::BackendType::Null) != mBackends.end());
+        // The null backend is only built with webnn_enable_null.
+        if (mBackends.find(wnn::BackendType::Null) == mBackends.end()) {
+            dawn::ErrorLog() << "The null backend isn't enabled.";
+            return nullptr;
+        }
         return mBackends[wnn::BackendType::Null]->CreateContext(options);
     }
 
@@ -18,6 +18,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "common/Log.h"
 #include "webnn/native/webnn_platform.h"
@@ -46,11 +47,20 @@ namespace webnn::native {
             // Input data type is Arrary Buffer View.
             const ArrayBufferView arrayBufferView = input->resource.arrayBufferView;
             if (arrayBufferView.buffer != nullptr) {
-                std::unique_ptr<char> buffer(new char[arrayBufferView.byteLength]);
-                memcpy(buffer.get(), arrayBufferView.buffer, arrayBufferView.byteLength);
+                // The copy stays unlike the one of the constants handed over by the wire
+                // server: the data is read in place from the command buffer, which is reused
+                // after the command, while the computes posted to the workers and the bound
+                // buffer sets read the inputs later. The storage of the name is reused, so the
+                // steady state doesn't allocate. A size change may move the storage, the graphs
+                // compare the buffers on compute and set the bound buffer sets up again.
+                std::vector<char>& buffer = mInputsBuffer[std::string(name)];
+                buffer.resize(arrayBufferView.byteLength);
+                const char* data =
+                    static_cast<const char*>(arrayBufferView.buffer) + arrayBufferView.byteOffset;
+                memcpy(buffer.data(), data, arrayBufferView.byteLength);
 
-                mInputs[std::string(name)].resource.arrayBufferView.buffer = buffer.get();
-                mInputsBuffer.push_back(std::move(buffer));
+                mInputs[std::string(name)].resource.arrayBufferView.buffer = buffer.data();
+                mInputs[std::string(name)].resource.arrayBufferView.byteOffset = 0;
             } else if (input->resource.gpuBufferView.buffer != nullptr) {
 #    if defined(WEBNN_ENABLE_GPU_BUFFER)
                 GpuBufferView gpuBufferView = input->resource.gpuBufferView;
@@ -62,14 +72,18 @@ namespace webnn::native {
                 UNREACHABLE();
 #    endif
             }
-            std::vector<int32_t> dimensions;
-            dimensions.assign(input->dimensions, input->dimensions + input->dimensionsCount);
-            // Prevent destroy from allocator memory after hanlding the command.
-            mInputs[std::string(name)].dimensions = dimensions.data();
-            mInputsDimensions.push_back(std::move(dimensions));
+            SetDimensions(name, input);
 #endif  // defined(WEBNN_ENABLE_WIRE)
         }
 
+        // Sets the input to its buffer in place, the buffer must not change until the computes
+        // using the input are done. The wire server sets the inputs in shared memory with it,
+        // which Set would copy once more.
+        void SetWithoutCopy(char const* name, const Input* input) {
+            mInputs[std::string(name)] = *input;
+            SetDimensions(name, input);
+        }
+
         Input Get(char const* name) const {
             if (mInputs.find(std::string(name)) == mInputs.end()) {
                 return Input();
@@ -83,10 +97,17 @@ namespace webnn::native {
         }
 
       private:
+        void SetDimensions(char const* name, const Input* input) {
+            std::vector<int32_t>& dimensions = mInputsDimensions[std::string(name)];
+            dimensions.assign(input->dimensions, input->dimensions + input->dimensionsCount);
+            // Prevent destroy from allocator memory after hanlding the command.
+            mInputs[std::string(name)].dimensions = dimensions.data();
+        }
+
         // The tempary memory in Allocator will be released after handling the command, so the
         // buffer and dimensions pointer need to be copied to use in GraphComputeCmd.
-        std::vector<std::unique_ptr<char>> mInputsBuffer;
-        std::vector<std::vector<int32_t>> mInputsDimensions;
+        std::unordered_map<std::string, std::vector<char>> mInputsBuffer;
+        std::unordered_map<std::string, std::vector<int32_t>> mInputsDimensions;
 
         std::unordered_map<std::string, Input> mInputs;
     };
@@ -50,13 +50,15 @@ namespace webnn::native {
 #else
                 UNREACHABLE();
 #endif
-            } else {
+            } else if (resource->arrayBufferView.buffer == nullptr) {
 #if defined(WEBNN_ENABLE_WIRE)
-                // malloc a memory to host the result of computing.
-                std::unique_ptr<char> buffer(new char[resource->arrayBufferView.byteLength]);
+                // malloc a memory to host the result of computing, the output in shared memory
+                // is written directly. The memory of the name is reused by the following sets.
+                std::vector<char>& buffer = mOutputsBuffer[std::string(name)];
+                buffer.resize(resource->arrayBufferView.byteOffset +
+                              resource->arrayBufferView.byteLength);
                 // Prevent destroy from allocator memory after hanlding the command.
-                mOutputs[std::string(name)].arrayBufferView.buffer = buffer.get();
-                mOutputsBuffer.push_back(std::move(buffer));
+                mOutputs[std::string(name)].arrayBufferView.buffer = buffer.data();
 #endif  // defined(WEBNN_ENABLE_WIRE)
             }
         }
@@ -83,7 +85,7 @@ namespace webnn::native {
       private:
         // The tempary memory in Allocator will be released after handling the command, so malloc
         // the same size memory to hold the result from GraphComputeCmd.
-        std::vector<std::unique_ptr<char>> mOutputsBuffer;
+        std::unordered_map<std::string, std::vector<char>> mOutputsBuffer;
 
         std::unordered_map<std::string, Resource> mOutputs;
     };
@@ -30,6 +30,47 @@ namespace webnn::native {
         : ObjectBase(graphBuilder->GetContext(), tag) {
     }
 
+    MaybeError OperandBase::SetQuantizationParams(QuantizationParams const* params) {
+        DAWN_INVALID_IF(IsError(), "The operand is an error object.");
+        DAWN_INVALID_IF(params == nullptr, "The quantization params are null.");
+        DAWN_INVALID_IF(mType != wnn::OperandType::Int8 && mType != wnn::OperandType::Uint8 &&
+                            mType != wnn::OperandType::Int32,
+                        "Only int8, uint8 and int32 operands can be quantized.");
+        DAWN_INVALID_IF(params->scalesCount == 0, "The quantization scales are empty.");
+        DAWN_INVALID_IF(params->zeroPointsCount != 0 &&
+                            params->zeroPointsCount != params->scalesCount,
+                        "The count of zero points must be equal to the count of scales.");
+        if (params->scalesCount > 1) {
+            int32_t rank = mShape.size();
+            DAWN_INVALID_IF(params->axis < 0 || params->axis >= rank,
+                            "The quantization axis is out of range.");
+            DAWN_INVALID_IF(static_cast<int32_t>(params->scalesCount) != mShape[params->axis],
+                            "The count of scales must be equal to the size of quantization axis.");
+        }
+        for (uint32_t i = 0; i < params->scalesCount; ++i) {
+            DAWN_INVALID_IF(!(params->scales[i] > 0.0f),
+                            "The quantization scale must be positive.");
+        }
+        if (mType != wnn::OperandType::Int32) {
+            int32_t minValue = mType == wnn::OperandType::Uint8 ? 0 : -128;
+            int32_t maxValue = mType == wnn::OperandType::Uint8 ? 255 : 127;
+            for (uint32_t i = 0; i < params->zeroPointsCount; ++i) {
+                DAWN_INVALID_IF(
+                    params->zeroPoints[i] < minValue || params->zeroPoints[i] > maxValue,
+                    "The zero point is out of the range of operand type.");
+            }
+        }
+
+        mScales.assign(params->scales, params->scales + params->scalesCount);
+        if (params->zeroPointsCount != 0) {
+            mZeroPoints.assign(params->zeroPoints, params->zeroPoints + params->zeroPointsCount);
+        } else {
+            mZeroPoints.assign(params->scalesCount, 0);
+        }
+        mQuantizationAxis = params->scalesCount > 1 ? params->axis : 0;
+        return {};
+    }
+
     // static
     OperandBase* OperandBase::MakeError(GraphBuilderBase* GraphBuilder) {
         return new OperandBase(GraphBuilder, ObjectBase::kError);
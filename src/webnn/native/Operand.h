@@ -50,6 +50,25 @@ namespace webnn::native {
             mShape = std::move(shape);
         }
 
+        // The operand is quantized if at least one scale is set. A single scale means
+        // per-tensor quantization, otherwise there is one scale per slice along the axis.
+        bool IsQuantized() const {
+            return !mScales.empty();
+        }
+        bool IsPerChannelQuantized() const {
+            return mScales.size() > 1;
+        }
+        const std::vector<float>& Scales() const {
+            return mScales;
+        }
+        const std::vector<int32_t>& ZeroPoints() const {
+            return mZeroPoints;
+        }
+        int32_t QuantizationAxis() const {
+            return mQuantizationAxis;
+        }
+        MaybeError SetQuantizationParams(QuantizationParams const* params);
+
         static OperandBase* MakeError(GraphBuilderBase* modelBuilder);
 
       private:
@@ -62,6 +81,10 @@ namespace webnn::native {
         wnn::OperandType mType;
         // The operand dimensions
         std::vector<int32_t> mShape;
+        // The quantization parameters, real_value = scale * (quantized_value - zero_point).
+        std::vector<float> mScales;
+        std::vector<int32_t> mZeroPoints;
+        int32_t mQuantizationAxis = 0;
     };
 }  // namespace webnn::native
 
@@ -0,0 +1,130 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/native/Sha256.h"
+
+#include <cstring>
+
+namespace webnn::native {
+
+    namespace {
+        // FIPS 180-4, section 4.2.2.
+        constexpr uint32_t kRoundConstants[64] = {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+            0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+            0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+            0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+            0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+            0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+            0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+            0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+            0xc67178f2,
+        };
+
+        uint32_t RotateRight(uint32_t x, uint32_t n) {
+            return (x >> n) | (x << (32 - n));
+        }
+
+        void ProcessBlock(const uint8_t* block, uint32_t state[8]) {
+            uint32_t w[64];
+            for (size_t i = 0; i < 16; ++i) {
+                w[i] = (uint32_t(block[i * 4]) << 24) | (uint32_t(block[i * 4 + 1]) << 16) |
+                       (uint32_t(block[i * 4 + 2]) << 8) | uint32_t(block[i * 4 + 3]);
+            }
+            for (size_t i = 16; i < 64; ++i) {
+                uint32_t s0 =
+                    RotateRight(w[i - 15], 7) ^ RotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                uint32_t s1 =
+                    RotateRight(w[i - 2], 17) ^ RotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+
+            uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+            uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+            for (size_t i = 0; i < 64; ++i) {
+                uint32_t s1 = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+                uint32_t ch = (e & f) ^ (~e & g);
+                uint32_t t1 = h + s1 + ch + kRoundConstants[i] + w[i];
+                uint32_t s0 = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+                uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+                uint32_t t2 = s0 + maj;
+                h = g;
+                g = f;
+                f = e;
+                e = d + t1;
+                d = c;
+                c = b;
+                b = a;
+                a = t1 + t2;
+            }
+            state[0] += a;
+            state[1] += b;
+            state[2] += c;
+            state[3] += d;
+            state[4] += e;
+            state[5] += f;
+            state[6] += g;
+            state[7] += h;
+        }
+    }  // anonymous namespace
+
+    std::array<uint8_t, 32> Sha256(const void* data, size_t size) {
+        uint32_t state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t processed = 0;
+        for (; processed + 64 <= size; processed += 64) {
+            ProcessBlock(bytes + processed, state);
+        }
+
+        // The message is padded with a bit 1, zeros and the bit length in big endian.
+        uint8_t tail[128] = {};
+        size_t tailSize = size - processed;
+        if (tailSize > 0) {
+            memcpy(tail, bytes + processed, tailSize);
+        }
+        tail[tailSize] = 0x80;
+        size_t paddedSize = tailSize + 9 <= 64 ? 64 : 128;
+        uint64_t bitLength = static_cast<uint64_t>(size) * 8;
+        for (size_t i = 0; i < 8; ++i) {
+            tail[paddedSize - 1 - i] = static_cast<uint8_t>(bitLength >> (i * 8));
+        }
+        for (size_t offset = 0; offset < paddedSize; offset += 64) {
+            ProcessBlock(tail + offset, state);
+        }
+
+        std::array<uint8_t, 32> digest;
+        for (size_t i = 0; i < 8; ++i) {
+            digest[i * 4] = static_cast<uint8_t>(state[i] >> 24);
+            digest[i * 4 + 1] = static_cast<uint8_t>(state[i] >> 16);
+            digest[i * 4 + 2] = static_cast<uint8_t>(state[i] >> 8);
+            digest[i * 4 + 3] = static_cast<uint8_t>(state[i]);
+        }
+        return digest;
+    }
+
+    std::string Sha256Hex(const void* data, size_t size) {
+        constexpr char kHexDigits[] = "0123456789abcdef";
+        std::array<uint8_t, 32> digest = Sha256(data, size);
+        std::string hex;
+        hex.reserve(digest.size() * 2);
+        for (uint8_t byte : digest) {
+            hex.push_back(kHexDigits[byte >> 4]);
+            hex.push_back(kHexDigits[byte & 0xf]);
+        }
+        return hex;
+    }
+
+}  // namespace webnn::native
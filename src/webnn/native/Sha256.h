@@ -0,0 +1,33 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_SHA256_H_
+#define WEBNN_NATIVE_SHA256_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace webnn::native {
+
+    // The SHA-256 digest of the data, used to key caches by content.
+    std::array<uint8_t, 32> Sha256(const void* data, size_t size);
+
+    // The SHA-256 digest of the data as a lowercase hexadecimal string.
+    std::string Sha256Hex(const void* data, size_t size);
+
+}  // namespace webnn::native
+
+#endif  // WEBNN_NATIVE_SHA256_H_
@@ -20,6 +20,7 @@
 #include "common/Assert.h"
 #include "webnn/native/GraphBuilder.h"
 #include "webnn/native/Instance.h"
+#include "webnn/native/NamedInputs.h"
 
 #if defined(_WIN32)
 #    include <crtdbg.h>
@@ -84,4 +85,23 @@ namespace webnn::native {
         return GetProcsAutogen();
     }
 
+    void NamedInputsSetWithoutCopy(WNNNamedInputs namedInputs,
+                                   char const* name,
+                                   WNNInput const* input) {
+        reinterpret_cast<NamedInputsBase*>(namedInputs)
+            ->SetWithoutCopy(name, reinterpret_cast<const Input*>(input));
+    }
+
+    WNNOperand GraphBuilderConstantWithBuffer(WNNGraphBuilder builder,
+                                              WNNOperandDescriptor const* desc,
+                                              const void* buffer,
+                                              size_t byteLength,
+                                              void (*release)(void* userdata),
+                                              void* userdata) {
+        auto self = reinterpret_cast<GraphBuilderBase*>(builder);
+        OperandBase* operand = self->Constant(reinterpret_cast<const OperandDescriptor*>(desc),
+                                              buffer, byteLength, release, userdata);
+        return reinterpret_cast<WNNOperand>(operand);
+    }
+
 }  // namespace webnn::native
@@ -14,8 +14,12 @@
 
 #include "webnn/native/mlas/GraphMLAS.h"
 
+#include <core/platform/threadpool.h>
 #include <mlas.h>
 
+#include <math.h>
+#include <algorithm>
+#include <limits>
 #include <numeric>
 
 #include "common/Assert.h"
@@ -63,13 +67,35 @@ namespace webnn::native::mlas {
             : mType(type), mDimensions(dims), mBuffer(nullptr), mBlockedLayout(blockedLayout) {
         }
 
+        // A view of the source memory with other dimensions, such as the output of reshape.
+        explicit Memory(const Ref<Memory>& source, const std::vector<int32_t>& dims)
+            : mType(source->GetType()),
+              mDimensions(dims),
+              mBuffer(nullptr),
+              mByteLength(source->GetByteLength()),
+              mBlockedLayout(false),
+              mSource(source) {
+            DAWN_ASSERT(!source->IsBlockedLayout());
+        }
+
         ~Memory() {
-            if (mBuffer) {
+            if (mBuffer && mOwnsBuffer) {
                 AlignedFree(mBuffer);
             }
         };
 
         bool Allocate() {
+            if (!ComputeByteLength()) {
+                return false;
+            }
+            mBuffer = AlignedAlloc(mByteLength);
+            mOwnsBuffer = true;
+            return mBuffer != nullptr;
+        }
+
+        // Computes the byte length without allocating, the buffer is placed in the arena of the
+        // graph by SetBuffer.
+        bool ComputeByteLength() {
             size_t elementNum = std::accumulate(mDimensions.begin(), mDimensions.end(), (size_t)1,
                                                 std::multiplies<size_t>{});
             size_t elementSize;
@@ -96,8 +122,27 @@ namespace webnn::native::mlas {
                     return false;
             }
             mByteLength = elementNum * elementSize;
-            mBuffer = AlignedAlloc(mByteLength);
-            return mBuffer != nullptr;
+            return true;
+        }
+
+        void SetBuffer(void* buffer) {
+            DAWN_ASSERT(mBuffer == nullptr && mSource.Get() == nullptr);
+            mBuffer = buffer;
+            mOwnsBuffer = false;
+        }
+
+        // Makes the memory a view of the source memory with the same dimensions and layout, such
+        // as the output of the add whose sum is accumulated into the other addend by conv2d.
+        void SetSource(const Ref<Memory>& source) {
+            DAWN_ASSERT(mBuffer == nullptr && mSource.Get() == nullptr);
+            DAWN_ASSERT(source->GetDimensions() == mDimensions &&
+                        source->IsBlockedLayout() == mBlockedLayout);
+            mSource = source;
+        }
+
+        // Returns the memory which owns the buffer of a view.
+        Memory* GetRoot() {
+            return mSource.Get() ? mSource->GetRoot() : this;
         }
 
         wnn::OperandType GetType() {
@@ -107,7 +152,7 @@ namespace webnn::native::mlas {
             return mDimensions;
         }
         void* GetBuffer() {
-            return mBuffer;
+            return mSource.Get() ? mSource->GetBuffer() : mBuffer;
         }
         size_t GetByteLength() {
             return mByteLength;
@@ -122,14 +167,160 @@ namespace webnn::native::mlas {
         void* mBuffer;
         size_t mByteLength;
         bool mBlockedLayout;
+        bool mOwnsBuffer = false;
+        Ref<Memory> mSource;
     };
 
+    namespace {
+        size_t GetElementNum(const std::vector<int32_t>& dimensions) {
+            return std::accumulate(dimensions.begin(), dimensions.end(), (size_t)1,
+                                   std::multiplies<size_t>{});
+        }
+
+        // Returns the index of the operand matrix used by each matrix of the output, the batch
+        // dimensions of the operand are broadcast to the batch dimensions of the output.
+        std::vector<size_t> GetBatchIndices(const std::vector<int32_t>& outputBatchShape,
+                                            const std::vector<int32_t>& batchShape) {
+            const size_t rank = outputBatchShape.size();
+            DAWN_ASSERT(rank >= batchShape.size());
+            const size_t skippedAxes = rank - batchShape.size();
+            std::vector<size_t> indices(GetElementNum(outputBatchShape));
+            for (size_t i = 0; i < indices.size(); ++i) {
+                size_t remaining = i, index = 0, stride = 1;
+                for (size_t axis = rank; axis-- > skippedAxes;) {
+                    size_t coordinate = remaining % outputBatchShape[axis];
+                    remaining /= outputBatchShape[axis];
+                    size_t dimension = batchShape[axis - skippedAxes];
+                    index += (dimension == 1 ? 0 : coordinate) * stride;
+                    stride *= dimension;
+                }
+                indices[i] = index;
+            }
+            return indices;
+        }
+
+        // The padded channels of the blocked memory are computed too and read by the following
+        // nchwc convolutions with zero weights. They stay finite for the ops which map finite
+        // operands to finite values, but div and pow map the zero padding to NaN or infinity,
+        // which poisons the outputs of the convolutions.
+        bool KeepsPaddingFinite(op::BinaryOpType opType) {
+            switch (opType) {
+                case op::BinaryOpType::kAdd:
+                case op::BinaryOpType::kSub:
+                case op::BinaryOpType::kMul:
+                case op::BinaryOpType::kMax:
+                case op::BinaryOpType::kMin:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        // Gets the shape [N, C / blockSize, H, W, blockSize] of the operand to be computed with
+        // the blocked memory, returns false if the broadcasting can't be done in blocked layout.
+        bool GetNchwcShape(const OperandBase* operand,
+                           const Ref<Memory>& memory,
+                           int32_t channels,
+                           std::vector<int64_t>* shape) {
+            const int64_t blockSize = MlasNchwcGetBlockSize();
+            if (memory->IsBlockedLayout()) {
+                if (operand->Shape()[1] != channels) {
+                    return false;
+                }
+                std::vector<int32_t> dims = memory->GetDimensions();
+                *shape = {dims[0], dims[1] / blockSize, dims[2], dims[3], blockSize};
+                return true;
+            }
+            std::vector<int32_t> dims = operand->Shape();
+            if (dims.size() > 4) {
+                return false;
+            }
+            dims.insert(dims.begin(), 4 - dims.size(), 1);
+            if (dims[2] != 1 || dims[3] != 1) {
+                return false;
+            }
+            if (dims[1] == 1) {
+                *shape = {dims[0], 1, 1, 1, 1};
+                return true;
+            }
+            // The channels are contiguous in both layouts if the spatial size is 1, but the
+            // padded channels of the blocked memory can't be read from the nchw memory.
+            if (dims[1] == channels && channels % blockSize == 0) {
+                *shape = {dims[0], channels / blockSize, 1, 1, blockSize};
+                return true;
+            }
+            return false;
+        }
+
+        // The activations which MlasActivation applies in place, so they can be fused into the
+        // epilogue of gemm.
+        bool GetFusibleActivation(const op::Unary* unary, MLAS_ACTIVATION* activation) {
+            switch (unary->GetType()) {
+                case op::UnaryOpType::kRelu:
+                    activation->ActivationKind = MlasReluActivation;
+                    return true;
+                case op::UnaryOpType::kLeakyRelu:
+                    activation->ActivationKind = MlasLeakyReluActivation;
+                    activation->Parameters.LeakyRelu.alpha =
+                        reinterpret_cast<const op::LeakyRelu*>(unary)->GetAlpha();
+                    return true;
+                case op::UnaryOpType::kSigmoid:
+                    activation->ActivationKind = MlasLogisticActivation;
+                    return true;
+                case op::UnaryOpType::kTanh:
+                    activation->ActivationKind = MlasTanhActivation;
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        // The activation fused by the options of conv2d and convTranspose2d.
+        MaybeError GetFusedActivation(FusionOperatorBase* fusion, MLAS_ACTIVATION* activation) {
+            activation->ActivationKind = MlasIdentityActivation;
+            if (fusion == nullptr) {
+                return {};
+            }
+            switch (fusion->GetFusionType()) {
+                case FusionType::Clamp:
+                    activation->ActivationKind = MlasClipActivation;
+                    activation->Parameters.Clip.minimum =
+                        reinterpret_cast<op::FusionClamp*>(fusion)->GetMinValue();
+                    activation->Parameters.Clip.maximum =
+                        reinterpret_cast<op::FusionClamp*>(fusion)->GetMaxValue();
+                    break;
+                case FusionType::HardSwish:
+                    activation->ActivationKind = MlasHardSigmoidActivation;
+                    activation->Parameters.HardSigmoid.alpha = 1.0 / 6.0;
+                    activation->Parameters.HardSigmoid.beta = 0.5;
+                    break;
+                case FusionType::Relu:
+                    activation->ActivationKind = MlasReluActivation;
+                    break;
+                case FusionType::Sigmoid:
+                    activation->ActivationKind = MlasLogisticActivation;
+                    break;
+                case FusionType::LeakyRelu:
+                    activation->ActivationKind = MlasLeakyReluActivation;
+                    activation->Parameters.LeakyRelu.alpha =
+                        reinterpret_cast<op::FusionLeakyRelu*>(fusion)->GetAlpha();
+                    break;
+                default:
+                    return DAWN_INTERNAL_ERROR("Unsupported fused activation");
+            }
+            return {};
+        }
+    }  // anonymous namespace
+
     class Kernel : public RefCounted {
       public:
         Kernel() = default;
         virtual ~Kernel() = default;
 
         virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) = 0;
+        // The memories accessed by the kernel, the graph places the intermediate memories by
+        // the kernels using them.
+        virtual std::vector<Memory*> GetMemories() = 0;
     };
 
     class Clamp : public Kernel {
@@ -149,6 +340,10 @@ namespace webnn::native::mlas {
             MlasActivation(&mActivation, output, nullptr, 1, mElementNum, mElementNum);
         }
 
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mOutput.Get()};
+        }
+
       private:
         Ref<Memory> mInput;
         Ref<Memory> mOutput;
@@ -193,6 +388,10 @@ namespace webnn::native::mlas {
             }
         }
 
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mOutput.Get()};
+        }
+
       private:
         op::UnaryOpType mOpType;
         Ref<Memory> mInput;
@@ -201,6 +400,302 @@ namespace webnn::native::mlas {
         MLAS_ACTIVATION mActivation;
     };
 
+    class Binary : public Kernel {
+      public:
+        // The shapes of a and b have the same rank as the output shape, the dimensions are
+        // either the same as the output or 1 to be broadcast.
+        Binary(op::BinaryOpType opType,
+               const Ref<Memory>& a,
+               const Ref<Memory>& b,
+               const Ref<Memory>& output,
+               const std::vector<int64_t>& aShape,
+               const std::vector<int64_t>& bShape,
+               const std::vector<int64_t>& outputShape)
+            : mOpType(opType), mA(a), mB(b), mOutput(output) {
+            DAWN_ASSERT(aShape.size() == outputShape.size() &&
+                        bShape.size() == outputShape.size());
+            // Merge the adjacent axes which are broadcast in the same way, so the innermost
+            // axis is as long as possible for the vectorized loop.
+            int lastBroadcast = -1;
+            for (size_t i = 0; i < outputShape.size(); ++i) {
+                if (outputShape[i] == 1) {
+                    continue;
+                }
+                int broadcast = (aShape[i] == 1 ? 1 : 0) | (bShape[i] == 1 ? 2 : 0);
+                if (broadcast == lastBroadcast) {
+                    mDimensions.back() *= outputShape[i];
+                } else {
+                    mDimensions.push_back(outputShape[i]);
+                    mABroadcast.push_back(broadcast & 1);
+                    mBBroadcast.push_back(broadcast & 2);
+                }
+                lastBroadcast = broadcast;
+            }
+            if (mDimensions.empty()) {
+                mDimensions = {1};
+                mABroadcast = {false};
+                mBBroadcast = {false};
+            }
+            mAStrides.resize(mDimensions.size());
+            mBStrides.resize(mDimensions.size());
+            size_t aStride = 1, bStride = 1;
+            for (size_t i = mDimensions.size(); i-- > 0;) {
+                mAStrides[i] = mABroadcast[i] ? 0 : aStride;
+                mBStrides[i] = mBBroadcast[i] ? 0 : bStride;
+                aStride *= mABroadcast[i] ? 1 : mDimensions[i];
+                bStride *= mBBroadcast[i] ? 1 : mDimensions[i];
+            }
+        }
+
+        virtual ~Binary() = default;
+
+        virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
+            switch (mOpType) {
+                case op::BinaryOpType::kAdd:
+                    Compute(threadPool, [](float a, float b) { return a + b; });
+                    break;
+                case op::BinaryOpType::kSub:
+                    Compute(threadPool, [](float a, float b) { return a - b; });
+                    break;
+                case op::BinaryOpType::kMul:
+                    Compute(threadPool, [](float a, float b) { return a * b; });
+                    break;
+                case op::BinaryOpType::kDiv:
+                    Compute(threadPool, [](float a, float b) { return a / b; });
+                    break;
+                case op::BinaryOpType::kMax:
+                    Compute(threadPool, [](float a, float b) { return a > b ? a : b; });
+                    break;
+                case op::BinaryOpType::kMin:
+                    Compute(threadPool, [](float a, float b) { return a < b ? a : b; });
+                    break;
+                case op::BinaryOpType::kPower:
+                    Compute(threadPool, [](float a, float b) { return powf(a, b); });
+                    break;
+                default:
+                    DAWN_UNREACHABLE();
+            }
+#if (VERBOSE)
+            dawn::InfoLog() << "Binary";
+            dawn::InfoLog() << "    op type: " << mOpType;
+            dawn::InfoLog() << "    a: " << mA->GetBuffer() << " b: " << mB->GetBuffer()
+                            << " output: " << mOutput->GetBuffer();
+            dawn::InfoLog() << "    inner size: " << mDimensions.back();
+#endif
+        }
+
+        virtual std::vector<Memory*> GetMemories() {
+            return {mA.Get(), mB.Get(), mOutput.Get()};
+        }
+
+      private:
+        // The number of elements computed by a task of the thread pool.
+        static constexpr size_t kBlockSize = 16384;
+
+        template <typename Op>
+        static void ComputeBlock(const float* a,
+                                 bool aBroadcast,
+                                 const float* b,
+                                 bool bBroadcast,
+                                 float* output,
+                                 size_t size,
+                                 Op op) {
+            // The loops are kept simple to be vectorized by the compiler.
+            if (!aBroadcast && !bBroadcast) {
+                for (size_t i = 0; i < size; ++i) {
+                    output[i] = op(a[i], b[i]);
+                }
+            } else if (!aBroadcast) {
+                const float value = b[0];
+                for (size_t i = 0; i < size; ++i) {
+                    output[i] = op(a[i], value);
+                }
+            } else if (!bBroadcast) {
+                const float value = a[0];
+                for (size_t i = 0; i < size; ++i) {
+                    output[i] = op(value, b[i]);
+                }
+            } else {
+                std::fill(output, output + size, op(a[0], b[0]));
+            }
+        }
+
+        template <typename Op>
+        void Compute(MLAS_THREADPOOL* threadPool, Op op) {
+            const float* a = reinterpret_cast<const float*>(mA->GetBuffer());
+            const float* b = reinterpret_cast<const float*>(mB->GetBuffer());
+            float* output = reinterpret_cast<float*>(mOutput->GetBuffer());
+            const size_t outerRank = mDimensions.size() - 1;
+            const size_t innerSize = mDimensions.back();
+            const size_t blockCount = (innerSize + kBlockSize - 1) / kBlockSize;
+            size_t rowCount = 1;
+            for (size_t i = 0; i < outerRank; ++i) {
+                rowCount *= mDimensions[i];
+            }
+            // Each task computes a block of an innermost row.
+            onnxruntime::concurrency::ThreadPool::TryParallelFor(
+                threadPool, static_cast<std::ptrdiff_t>(rowCount * blockCount),
+                static_cast<double>(std::min(innerSize, kBlockSize)),
+                [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+                    for (std::ptrdiff_t task = first; task < last; ++task) {
+                        size_t row = task / blockCount;
+                        size_t start = (task % blockCount) * kBlockSize;
+                        size_t size = std::min(kBlockSize, innerSize - start);
+                        size_t aOffset = 0, bOffset = 0;
+                        for (size_t i = outerRank, remaining = row; i-- > 0;) {
+                            size_t coordinate = remaining % mDimensions[i];
+                            remaining /= mDimensions[i];
+                            aOffset += coordinate * mAStrides[i];
+                            bOffset += coordinate * mBStrides[i];
+                        }
+                        aOffset += start * mAStrides.back();
+                        bOffset += start * mBStrides.back();
+                        ComputeBlock(a + aOffset, mABroadcast.back(), b + bOffset,
+                                     mBBroadcast.back(), output + row * innerSize + start, size,
+                                     op);
+                    }
+                });
+        }
+
+        op::BinaryOpType mOpType;
+        Ref<Memory> mA;
+        Ref<Memory> mB;
+        Ref<Memory> mOutput;
+        // The collapsed output dimensions and the strides of a and b, the stride of the
+        // broadcast axis is 0.
+        std::vector<size_t> mDimensions;
+        std::vector<bool> mABroadcast;
+        std::vector<bool> mBBroadcast;
+        std::vector<size_t> mAStrides;
+        std::vector<size_t> mBStrides;
+    };
+
+    class Concat : public Kernel {
+      public:
+        // Each of the `outerSize` rows of the output is the concatenation of a row of every
+        // input, the rows of the inputs have `inputSizes` elements.
+        Concat(const std::vector<Ref<Memory>>& inputs,
+               const Ref<Memory>& output,
+               size_t outerSize,
+               const std::vector<size_t>& inputSizes)
+            : mInputs(inputs), mOutput(output), mOuterSize(outerSize), mInputSizes(inputSizes) {
+            DAWN_ASSERT(mInputs.size() == mInputSizes.size());
+        }
+
+        virtual ~Concat() = default;
+
+        virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
+            float* output = reinterpret_cast<float*>(mOutput->GetBuffer());
+            const size_t outputSize =
+                std::accumulate(mInputSizes.begin(), mInputSizes.end(), (size_t)0);
+            for (size_t i = 0, offset = 0; i < mInputs.size(); offset += mInputSizes[i++]) {
+                const float* input = reinterpret_cast<const float*>(mInputs[i]->GetBuffer());
+                for (size_t row = 0; row < mOuterSize; ++row) {
+                    memcpy(output + row * outputSize + offset, input + row * mInputSizes[i],
+                           mInputSizes[i] * sizeof(float));
+                }
+            }
+#if (VERBOSE)
+            dawn::InfoLog() << "Concat";
+            dawn::InfoLog() << "    input count: " << mInputs.size() << " output: " << output;
+#endif
+        }
+
+        virtual std::vector<Memory*> GetMemories() {
+            std::vector<Memory*> memories = {mOutput.Get()};
+            for (auto& input : mInputs) {
+                memories.push_back(input.Get());
+            }
+            return memories;
+        }
+
+      private:
+        std::vector<Ref<Memory>> mInputs;
+        Ref<Memory> mOutput;
+        size_t mOuterSize;
+        std::vector<size_t> mInputSizes;
+    };
+
+    class ConcatNchwc : public Kernel {
+      public:
+        // Concatenates the blocked inputs along the channel axis, the channels of an input may
+        // be padded to the block size.
+        ConcatNchwc(const std::vector<Ref<Memory>>& inputs,
+                    const Ref<Memory>& output,
+                    const std::vector<size_t>& channels,
+                    size_t batchCount,
+                    size_t spatialSize)
+            : mInputs(inputs),
+              mOutput(output),
+              mChannels(channels),
+              mBatchCount(batchCount),
+              mSpatialSize(spatialSize) {
+            DAWN_ASSERT(mInputs.size() == mChannels.size());
+        }
+
+        virtual ~ConcatNchwc() = default;
+
+        virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
+            const size_t blockSize = MlasNchwcGetBlockSize();
+            const size_t blockLength = mSpatialSize * blockSize;
+            float* output = reinterpret_cast<float*>(mOutput->GetBuffer());
+            const size_t outputBlocks = mOutput->GetDimensions()[1] / blockSize;
+            const size_t outputChannels =
+                std::accumulate(mChannels.begin(), mChannels.end(), (size_t)0);
+            for (size_t n = 0; n < mBatchCount; ++n) {
+                float* outputBatch = output + n * outputBlocks * blockLength;
+                // The memory is shared with other tensors, the padded channels of the last
+                // block are zeroed since the consumers read them.
+                if (outputChannels % blockSize != 0) {
+                    memset(outputBatch + (outputBlocks - 1) * blockLength, 0,
+                           blockLength * sizeof(float));
+                }
+                for (size_t i = 0, offset = 0; i < mInputs.size(); offset += mChannels[i++]) {
+                    const size_t inputBlocks = mInputs[i]->GetDimensions()[1] / blockSize;
+                    const float* inputBatch =
+                        reinterpret_cast<const float*>(mInputs[i]->GetBuffer()) +
+                        n * inputBlocks * blockLength;
+                    if (offset % blockSize == 0) {
+                        // The whole blocks are copied, the padded channels are overwritten by
+                        // the next input.
+                        memcpy(outputBatch + offset / blockSize * blockLength, inputBatch,
+                               inputBlocks * blockLength * sizeof(float));
+                        continue;
+                    }
+                    // The channels are shifted across the blocks.
+                    for (size_t c = 0; c < mChannels[i]; ++c) {
+                        const float* src =
+                            inputBatch + c / blockSize * blockLength + c % blockSize;
+                        float* dst = outputBatch + (offset + c) / blockSize * blockLength +
+                                     (offset + c) % blockSize;
+                        for (size_t j = 0; j < mSpatialSize; ++j) {
+                            dst[j * blockSize] = src[j * blockSize];
+                        }
+                    }
+                }
+            }
+#if (VERBOSE)
+            dawn::InfoLog() << "ConcatNchwc";
+            dawn::InfoLog() << "    input count: " << mInputs.size() << " output: " << output;
+#endif
+        }
+
+        virtual std::vector<Memory*> GetMemories() {
+            std::vector<Memory*> memories = {mOutput.Get()};
+            for (auto& input : mInputs) {
+                memories.push_back(input.Get());
+            }
+            return memories;
+        }
+
+      private:
+        std::vector<Ref<Memory>> mInputs;
+        Ref<Memory> mOutput;
+        std::vector<size_t> mChannels;
+        size_t mBatchCount;
+        size_t mSpatialSize;
+    };
+
     class ReorderInput : public Kernel {
       public:
         ReorderInput(const Ref<Memory>& input,
@@ -226,6 +721,10 @@ namespace webnn::native::mlas {
             MlasReorderInputNchw(input, output, mInputChannels, mInputSize);
         }
 
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mOutput.Get()};
+        }
+
       private:
         Ref<Memory> mInput;
         Ref<Memory> mOutput;
@@ -255,6 +754,10 @@ namespace webnn::native::mlas {
             MlasReorderOutputNchw(mOutputShape.data(), input, output);
         }
 
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mOutput.Get()};
+        }
+
       private:
         Ref<Memory> mInput;
         Ref<Memory> mOutput;
@@ -294,7 +797,8 @@ namespace webnn::native::mlas {
 
         virtual ~Conv2d() = default;
 
-        bool Prepare(MLAS_THREADPOOL* threadPool = nullptr) {
+        // Returns the element count of the working buffer, which is placed in the arena.
+        size_t Prepare(MLAS_THREADPOOL* threadPool = nullptr) {
             DAWN_ASSERT(!nchwcConv);
             size_t workingBufferSize;
             size_t dimensions = 2;
@@ -308,15 +812,7 @@ namespace webnn::native::mlas {
                             mDilationShape.data(), mPadding.data(), mStrideShape.data(),
                             outputShape.data(), outputChannels / mGroupCount, &mActivation,
                             &workingBufferSize, threadPool);
-            if (workingBufferSize > 0) {
-                mWorkingBuffer =
-                    AcquireRef(new Memory(wnn::OperandType::Float32, {int32_t(workingBufferSize)}));
-                if (!mWorkingBuffer->Allocate()) {
-                    dawn::ErrorLog() << "Failed to allocate working buffer";
-                    return false;
-                }
-            }
-            return true;
+            return workingBufferSize;
         }
 
         virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
@@ -351,6 +847,11 @@ namespace webnn::native::mlas {
 #endif
         }
 
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mFilter.Get(), mBias.Get(), mWorkingBuffer.Get(),
+                    mOutput.Get()};
+        }
+
       private:
         friend class Graph;
         bool nchwcConv;
@@ -392,23 +893,448 @@ namespace webnn::native::mlas {
               mDilationShape(dilationShape),
               mPadding(padding),
               mStrideShape(strideShape),
-              mOutputShape(outputShape) {
+              mOutputShape(outputShape) {
+        }
+
+        virtual ~Pool2d() = default;
+
+        virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
+            const float* input = reinterpret_cast<const float*>(mInput->GetBuffer());
+            float* output = reinterpret_cast<float*>(mOutput->GetBuffer());
+            MlasNchwcPool(mKind, mInputShape.data(), mGlobal ? nullptr : mKernelShape.data(),
+                          mGlobal ? nullptr : mDilationShape.data(),
+                          mGlobal ? nullptr : mPadding.data(),
+                          mGlobal ? nullptr : mStrideShape.data(), mOutputShape.data(), input,
+                          output, threadPool);
+#if (VERBOSE)
+            dawn::InfoLog() << "MlasNchwcPool";
+            dawn::InfoLog() << "    kind: " << mKind;
+            dawn::InfoLog() << "    global: " << mGlobal;
+            dawn::InfoLog() << "    input: " << input << " output: " << output;
+            dawn::InfoLog() << "    input shape: [" << mInputShape[0] << ", " << mInputShape[1]
+                            << ", " << mInputShape[2] << ", " << mInputShape[3] << "]";
+            dawn::InfoLog() << "    kernel shape: [" << mKernelShape[0] << ", " << mKernelShape[1]
+                            << "]";
+            dawn::InfoLog() << "    output shape: [" << mOutputShape[0] << ", " << mOutputShape[1]
+                            << ", " << mOutputShape[2] << ", " << mOutputShape[3] << "]";
+#endif
+        }
+
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mOutput.Get()};
+        }
+
+      private:
+        friend class Graph;
+        MLAS_POOLING_KIND mKind;
+        bool mGlobal;
+        Ref<Memory> mInput;
+        Ref<Memory> mOutput;
+        std::vector<int64_t> mInputShape;
+        std::vector<int64_t> mKernelShape;
+        std::vector<int64_t> mDilationShape;
+        std::vector<int64_t> mPadding;
+        std::vector<int64_t> mStrideShape;
+        std::vector<int64_t> mOutputShape;
+    };
+
+    class Gemm : public Kernel {
+      public:
+        // Computes output = alpha * A * B + beta * C for each matrix of the output. The
+        // matrices of A and B are selected by the batch indices, C is broadcast to [M, N].
+        Gemm(const Ref<Memory>& a,
+             const Ref<Memory>& b,
+             const Ref<Memory>& c,
+             const Ref<Memory>& output,
+             bool aTranspose,
+             bool bTranspose,
+             size_t m,
+             size_t n,
+             size_t k,
+             float alpha,
+             float beta,
+             const std::vector<size_t>& aBatchIndices,
+             const std::vector<size_t>& bBatchIndices)
+            : mA(a),
+              mB(b),
+              mC(c),
+              mOutput(output),
+              mATranspose(aTranspose),
+              mBTranspose(bTranspose),
+              mM(m),
+              mN(n),
+              mK(k),
+              mAlpha(alpha),
+              mBeta(beta),
+              mABatchIndices(aBatchIndices),
+              mBBatchIndices(bBatchIndices),
+              mPackedBSize(0) {
+            DAWN_ASSERT(mABatchIndices.size() == mBBatchIndices.size());
+            DAWN_ASSERT(mC.Get() == nullptr || mABatchIndices.size() == 1);
+            mActivation.ActivationKind = MlasIdentityActivation;
+        }
+
+        virtual ~Gemm() = default;
+
+        // Packs the constant B into the layout of the MLAS sgemm kernel, so the packing isn't
+        // repeated in every compute.
+        bool PackB() {
+            mPackedBSize = MlasGemmPackBSize(mN, mK);
+            if (mPackedBSize == 0) {
+                // The platform has no packed sgemm kernel.
+                return true;
+            }
+            size_t matrixCount = mB->GetByteLength() / (mK * mN * sizeof(float));
+            Ref<Memory> packedB = AcquireRef(new Memory(
+                wnn::OperandType::Uint8, {static_cast<int32_t>(mPackedBSize * matrixCount)}));
+            if (!packedB->Allocate()) {
+                dawn::ErrorLog() << "Failed to allocate packed B";
+                return false;
+            }
+            const float* b = reinterpret_cast<const float*>(mB->GetBuffer());
+            int8_t* packed = reinterpret_cast<int8_t*>(packedB->GetBuffer());
+            for (size_t i = 0; i < matrixCount; ++i) {
+                MlasGemmPackB(mBTranspose ? CblasTrans : CblasNoTrans, mN, mK, b + i * mK * mN,
+                              mBTranspose ? mK : mN, packed + i * mPackedBSize);
+            }
+            mB = packedB;
+            return true;
+        }
+
+        virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
+            const float* a = reinterpret_cast<const float*>(mA->GetBuffer());
+            const void* b = mB->GetBuffer();
+            float* output = reinterpret_cast<float*>(mOutput->GetBuffer());
+            const size_t batchCount = mABatchIndices.size();
+            if (mC.Get()) {
+                BroadcastC(output);
+            }
+            std::vector<MLAS_SGEMM_DATA_PARAMS> params(batchCount);
+            for (size_t i = 0; i < batchCount; ++i) {
+                params[i].A = a + mABatchIndices[i] * mM * mK;
+                params[i].lda = mATranspose ? mM : mK;
+                if (mPackedBSize > 0) {
+                    params[i].B = reinterpret_cast<const float*>(
+                        static_cast<const int8_t*>(b) + mBBatchIndices[i] * mPackedBSize);
+                    params[i].BIsPacked = true;
+                } else {
+                    params[i].B = static_cast<const float*>(b) + mBBatchIndices[i] * mK * mN;
+                    params[i].ldb = mBTranspose ? mK : mN;
+                }
+                params[i].C = output + i * mM * mN;
+                params[i].ldc = mN;
+                params[i].alpha = mAlpha;
+                params[i].beta = mC.Get() ? mBeta : 0.0f;
+            }
+            // MLAS partitions the work over the thread pool by the size of the problem, the small
+            // matrices are computed in the calling thread.
+            MlasGemmBatch(mATranspose ? CblasTrans : CblasNoTrans,
+                          mBTranspose && mPackedBSize == 0 ? CblasTrans : CblasNoTrans, mM, mN,
+                          mK, params.data(), batchCount, threadPool);
+            if (mActivation.ActivationKind != MlasIdentityActivation) {
+                size_t elementNum = batchCount * mM * mN;
+                MlasActivation(&mActivation, output, nullptr, 1, elementNum, elementNum);
+            }
+#if (VERBOSE)
+            dawn::InfoLog() << "MlasGemmBatch";
+            dawn::InfoLog() << "    a: " << a << " output: " << output;
+            dawn::InfoLog() << "    m: " << mM << " n: " << mN << " k: " << mK;
+            dawn::InfoLog() << "    batch count: " << batchCount;
+            dawn::InfoLog() << "    packed b: " << (mPackedBSize > 0);
+            dawn::InfoLog() << "    activation: " << mActivation.ActivationKind;
+#endif
+        }
+
+        virtual std::vector<Memory*> GetMemories() {
+            return {mA.Get(), mB.Get(), mC.Get(), mOutput.Get()};
+        }
+
+      private:
+        friend class Graph;
+
+        void BroadcastC(float* output) {
+            const float* c = reinterpret_cast<const float*>(mC->GetBuffer());
+            std::vector<int32_t> cShape = mC->GetDimensions();
+            const size_t rank = cShape.size();
+            const size_t cRows = rank >= 2 ? cShape[rank - 2] : 1;
+            const size_t cColumns = rank >= 1 ? cShape[rank - 1] : 1;
+            for (size_t i = 0; i < mM; ++i) {
+                float* row = output + i * mN;
+                const float* cRow = c + (cRows == 1 ? 0 : i * cColumns);
+                if (cColumns == 1) {
+                    std::fill(row, row + mN, cRow[0]);
+                } else {
+                    memcpy(row, cRow, mN * sizeof(float));
+                }
+            }
+        }
+
+        Ref<Memory> mA;
+        Ref<Memory> mB;
+        Ref<Memory> mC;
+        Ref<Memory> mOutput;
+        bool mATranspose;
+        bool mBTranspose;
+        size_t mM;
+        size_t mN;
+        size_t mK;
+        float mAlpha;
+        float mBeta;
+        std::vector<size_t> mABatchIndices;
+        std::vector<size_t> mBBatchIndices;
+        size_t mPackedBSize;
+        MLAS_ACTIVATION mActivation;
+    };
+
+    class Resample2d : public Kernel {
+      public:
+        // Resamples the two adjacent axes of the input viewed as [outer, height, width, inner],
+        // the blocked memory is resampled with the channel block as the inner axis. The
+        // coordinates are mapped with half pixel centers.
+        Resample2d(const Ref<Memory>& input,
+                   const Ref<Memory>& output,
+                   wnn::InterpolationMode mode,
+                   size_t outerSize,
+                   size_t innerSize,
+                   size_t inputHeight,
+                   size_t inputWidth,
+                   size_t outputHeight,
+                   size_t outputWidth)
+            : mInput(input),
+              mOutput(output),
+              mMode(mode),
+              mOuterSize(outerSize),
+              mInnerSize(innerSize),
+              mInputHeight(inputHeight),
+              mInputWidth(inputWidth),
+              mOutputHeight(outputHeight),
+              mOutputWidth(outputWidth) {
+            ComputeCoordinates(inputHeight, outputHeight, &mHeightIndices, &mHeightWeights);
+            ComputeCoordinates(inputWidth, outputWidth, &mWidthIndices, &mWidthWeights);
+        }
+
+        virtual ~Resample2d() = default;
+
+        virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
+            const float* input = reinterpret_cast<const float*>(mInput->GetBuffer());
+            float* output = reinterpret_cast<float*>(mOutput->GetBuffer());
+            const size_t inputRowSize = mInputWidth * mInnerSize;
+            const size_t outputRowSize = mOutputWidth * mInnerSize;
+            const size_t inputPlaneSize = mInputHeight * inputRowSize;
+            const double cost = static_cast<double>(outputRowSize) *
+                                (mMode == wnn::InterpolationMode::Linear ? 4 : 1);
+            // Each output row is computed from at most two input rows of the same plane.
+            onnxruntime::concurrency::ThreadPool::TryParallelFor(
+                threadPool, mOuterSize * mOutputHeight, cost,
+                [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+                    for (std::ptrdiff_t row = first; row < last; ++row) {
+                        const size_t outer = row / mOutputHeight;
+                        const size_t y = row % mOutputHeight;
+                        const float* plane = input + outer * inputPlaneSize;
+                        float* dst = output + row * outputRowSize;
+                        if (mMode == wnn::InterpolationMode::NearestNeighbor) {
+                            ComputeNearestRow(plane + mHeightIndices[y] * inputRowSize, dst);
+                        } else {
+                            ComputeLinearRow(plane + mHeightIndices[y] * inputRowSize,
+                                             plane + mHeightIndices[y + mOutputHeight] *
+                                                         inputRowSize,
+                                             mHeightWeights[y], dst);
+                        }
+                    }
+                });
+#if (VERBOSE)
+            dawn::InfoLog() << "Resample2d";
+            dawn::InfoLog() << "    input: " << input << " output: " << output;
+            dawn::InfoLog() << "    mode: " << static_cast<uint32_t>(mMode);
+            dawn::InfoLog() << "    input size: [" << mInputHeight << ", " << mInputWidth << "]";
+            dawn::InfoLog() << "    output size: [" << mOutputHeight << ", " << mOutputWidth
+                            << "]";
+#endif
+        }
+
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mOutput.Get()};
+        }
+
+      private:
+        // The nearest index of an output coordinate is kept in the first half of the indices,
+        // the linear mode keeps the second input index in the other half with the weight of it.
+        void ComputeCoordinates(size_t inputSize,
+                                size_t outputSize,
+                                std::vector<size_t>* indices,
+                                std::vector<float>* weights) {
+            const float scale = static_cast<float>(outputSize) / inputSize;
+            indices->resize(2 * outputSize);
+            weights->resize(outputSize);
+            for (size_t i = 0; i < outputSize; ++i) {
+                float coordinate = (i + 0.5f) / scale;
+                if (mMode == wnn::InterpolationMode::NearestNeighbor) {
+                    (*indices)[i] = std::min(static_cast<size_t>(coordinate), inputSize - 1);
+                    continue;
+                }
+                coordinate = std::min(std::max(coordinate - 0.5f, 0.0f), inputSize - 1.0f);
+                const size_t index = static_cast<size_t>(coordinate);
+                (*indices)[i] = index;
+                (*indices)[i + outputSize] = std::min(index + 1, inputSize - 1);
+                (*weights)[i] = coordinate - index;
+            }
+        }
+
+        void ComputeNearestRow(const float* src, float* dst) {
+            for (size_t x = 0; x < mOutputWidth; ++x) {
+                memcpy(dst + x * mInnerSize, src + mWidthIndices[x] * mInnerSize,
+                       mInnerSize * sizeof(float));
+            }
+        }
+
+        void ComputeLinearRow(const float* top, const float* bottom, float dy, float* dst) {
+            for (size_t x = 0; x < mOutputWidth; ++x) {
+                const size_t left = mWidthIndices[x] * mInnerSize;
+                const size_t right = mWidthIndices[x + mOutputWidth] * mInnerSize;
+                const float dx = mWidthWeights[x];
+                float* out = dst + x * mInnerSize;
+                // The inner loop runs over the channel block of the blocked memory.
+                for (size_t i = 0; i < mInnerSize; ++i) {
+                    const float upper = top[left + i] + (top[right + i] - top[left + i]) * dx;
+                    const float lower =
+                        bottom[left + i] + (bottom[right + i] - bottom[left + i]) * dx;
+                    out[i] = upper + (lower - upper) * dy;
+                }
+            }
+        }
+
+        Ref<Memory> mInput;
+        Ref<Memory> mOutput;
+        wnn::InterpolationMode mMode;
+        size_t mOuterSize;
+        size_t mInnerSize;
+        size_t mInputHeight;
+        size_t mInputWidth;
+        size_t mOutputHeight;
+        size_t mOutputWidth;
+        std::vector<size_t> mHeightIndices;
+        std::vector<float> mHeightWeights;
+        std::vector<size_t> mWidthIndices;
+        std::vector<float> mWidthWeights;
+    };
+
+    class UpsampleNchwc : public Kernel {
+      public:
+        // The nearest upsampling of the blocked memory by the integral scales.
+        UpsampleNchwc(const Ref<Memory>& input,
+                      const Ref<Memory>& output,
+                      const std::vector<int64_t>& inputShape,
+                      const std::vector<int64_t>& scales)
+            : mInput(input), mOutput(output), mInputShape(inputShape), mScales(scales) {
+        }
+
+        virtual ~UpsampleNchwc() = default;
+
+        virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
+            const float* input = reinterpret_cast<const float*>(mInput->GetBuffer());
+            float* output = reinterpret_cast<float*>(mOutput->GetBuffer());
+            MlasNchwcUpsampleNearest(mInputShape.data(), mScales.data(), input, output);
+#if (VERBOSE)
+            dawn::InfoLog() << "MlasNchwcUpsampleNearest";
+            dawn::InfoLog() << "    input: " << input << " output: " << output;
+            dawn::InfoLog() << "    input shape: [" << mInputShape[0] << ", " << mInputShape[1]
+                            << ", " << mInputShape[2] << ", " << mInputShape[3] << "]";
+            dawn::InfoLog() << "    scales: [" << mScales[0] << ", " << mScales[1] << "]";
+#endif
+        }
+
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mOutput.Get()};
+        }
+
+      private:
+        Ref<Memory> mInput;
+        Ref<Memory> mOutput;
+        std::vector<int64_t> mInputShape;
+        std::vector<int64_t> mScales;
+    };
+
+    class ConvTranspose2d : public Kernel {
+      public:
+        // The transposed convolution is computed per group as the gemm of the transposed
+        // filter and the input into the column buffer, which is then accumulated into the
+        // output by col2im. The bias and the activation are applied by MlasActivation.
+        ConvTranspose2d(const Ref<Memory>& input,
+                        const Ref<Memory>& filter,
+                        const Ref<Memory>& bias,
+                        const Ref<Memory>& output,
+                        const Ref<Memory>& columnBuffer,
+                        const std::vector<int64_t>& inputShape,
+                        const std::vector<int64_t>& kernelShape,
+                        const std::vector<int64_t>& dilationShape,
+                        const std::vector<int64_t>& padding,
+                        const std::vector<int64_t>& strideShape,
+                        const std::vector<int64_t>& outputShape,
+                        size_t groupCount,
+                        MLAS_ACTIVATION activation)
+            : mInput(input),
+              mFilter(filter),
+              mBias(bias),
+              mOutput(output),
+              mColumnBuffer(columnBuffer),
+              mInputShape(inputShape),
+              mKernelShape(kernelShape),
+              mDilationShape(dilationShape),
+              mPadding(padding),
+              mStrideShape(strideShape),
+              mOutputShape(outputShape),
+              mGroupCount(groupCount),
+              mActivation(activation) {
         }
 
-        virtual ~Pool2d() = default;
+        virtual ~ConvTranspose2d() = default;
 
         virtual void Compute(MLAS_THREADPOOL* threadPool = nullptr) {
             const float* input = reinterpret_cast<const float*>(mInput->GetBuffer());
+            const float* filter = reinterpret_cast<const float*>(mFilter->GetBuffer());
+            const float* bias =
+                mBias.Get() ? reinterpret_cast<const float*>(mBias->GetBuffer()) : nullptr;
             float* output = reinterpret_cast<float*>(mOutput->GetBuffer());
-            MlasNchwcPool(mKind, mInputShape.data(), mGlobal ? nullptr : mKernelShape.data(),
-                          mGlobal ? nullptr : mDilationShape.data(),
-                          mGlobal ? nullptr : mPadding.data(),
-                          mGlobal ? nullptr : mStrideShape.data(), mOutputShape.data(), input,
-                          output, threadPool);
+            float* column = reinterpret_cast<float*>(mColumnBuffer->GetBuffer());
+            const size_t batchCount = mInputShape[0];
+            const size_t groupInputChannels = mInputShape[1] / mGroupCount;
+            const size_t groupOutputChannels = mOutputShape[1] / mGroupCount;
+            const size_t inputSize = mInputShape[2] * mInputShape[3];
+            const size_t outputSize = mOutputShape[2] * mOutputShape[3];
+            const size_t kernelSize = mKernelShape[0] * mKernelShape[1];
+            const size_t columnRows = groupOutputChannels * kernelSize;
+            memset(output, 0, mOutput->GetByteLength());
+            for (size_t n = 0; n < batchCount; ++n) {
+                for (size_t g = 0; g < mGroupCount; ++g) {
+                    MLAS_SGEMM_DATA_PARAMS params;
+                    params.A = filter + g * groupInputChannels * columnRows;
+                    params.lda = columnRows;
+                    params.B = input + (n * mGroupCount + g) * groupInputChannels * inputSize;
+                    params.ldb = inputSize;
+                    params.C = column;
+                    params.ldc = inputSize;
+                    params.alpha = 1.0f;
+                    params.beta = 0.0f;
+                    MlasGemmBatch(CblasTrans, CblasNoTrans, columnRows, inputSize,
+                                  groupInputChannels, &params, 1, threadPool);
+                    float* groupOutput =
+                        output + (n * mGroupCount + g) * groupOutputChannels * outputSize;
+                    // The output channels are accumulated independently.
+                    onnxruntime::concurrency::ThreadPool::TryParallelFor(
+                        threadPool, groupOutputChannels,
+                        static_cast<double>(kernelSize * inputSize),
+                        [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+                            for (std::ptrdiff_t c = first; c < last; ++c) {
+                                Col2Im(column + c * kernelSize * inputSize,
+                                       groupOutput + c * outputSize);
+                            }
+                        });
+                }
+                MlasActivation(&mActivation, output + n * mOutputShape[1] * outputSize, bias,
+                               mOutputShape[1], outputSize, outputSize);
+            }
 #if (VERBOSE)
-            dawn::InfoLog() << "MlasNchwcPool";
-            dawn::InfoLog() << "    kind: " << mKind;
-            dawn::InfoLog() << "    global: " << mGlobal;
+            dawn::InfoLog() << "ConvTranspose2d";
             dawn::InfoLog() << "    input: " << input << " output: " << output;
             dawn::InfoLog() << "    input shape: [" << mInputShape[0] << ", " << mInputShape[1]
                             << ", " << mInputShape[2] << ", " << mInputShape[3] << "]";
@@ -416,21 +1342,59 @@ namespace webnn::native::mlas {
                             << "]";
             dawn::InfoLog() << "    output shape: [" << mOutputShape[0] << ", " << mOutputShape[1]
                             << ", " << mOutputShape[2] << ", " << mOutputShape[3] << "]";
+            dawn::InfoLog() << "    group count: " << mGroupCount;
+            dawn::InfoLog() << "    activation: " << mActivation.ActivationKind;
 #endif
         }
 
+        virtual std::vector<Memory*> GetMemories() {
+            return {mInput.Get(), mFilter.Get(), mBias.Get(), mColumnBuffer.Get(),
+                    mOutput.Get()};
+        }
+
       private:
-        friend class Graph;
-        MLAS_POOLING_KIND mKind;
-        bool mGlobal;
+        // Accumulates the columns of an output channel, the rows of the columns are the kernel
+        // positions and each row holds the contributions of all input positions.
+        void Col2Im(const float* column, float* output) {
+            const int64_t inputHeight = mInputShape[2];
+            const int64_t inputWidth = mInputShape[3];
+            const int64_t outputHeight = mOutputShape[2];
+            const int64_t outputWidth = mOutputShape[3];
+            for (int64_t ky = 0; ky < mKernelShape[0]; ++ky) {
+                for (int64_t kx = 0; kx < mKernelShape[1]; ++kx) {
+                    for (int64_t iy = 0; iy < inputHeight; ++iy) {
+                        const int64_t oy =
+                            iy * mStrideShape[0] - mPadding[0] + ky * mDilationShape[0];
+                        if (oy < 0 || oy >= outputHeight) {
+                            column += inputWidth;
+                            continue;
+                        }
+                        for (int64_t ix = 0; ix < inputWidth; ++ix) {
+                            const int64_t ox =
+                                ix * mStrideShape[1] - mPadding[2] + kx * mDilationShape[1];
+                            if (ox >= 0 && ox < outputWidth) {
+                                output[oy * outputWidth + ox] += column[ix];
+                            }
+                        }
+                        column += inputWidth;
+                    }
+                }
+            }
+        }
+
         Ref<Memory> mInput;
+        Ref<Memory> mFilter;
+        Ref<Memory> mBias;
         Ref<Memory> mOutput;
+        Ref<Memory> mColumnBuffer;
         std::vector<int64_t> mInputShape;
         std::vector<int64_t> mKernelShape;
         std::vector<int64_t> mDilationShape;
         std::vector<int64_t> mPadding;
         std::vector<int64_t> mStrideShape;
         std::vector<int64_t> mOutputShape;
+        size_t mGroupCount;
+        MLAS_ACTIVATION mActivation;
     };
 
     Graph::Graph(Context* context) : GraphBase(context) {
@@ -447,6 +1411,7 @@ namespace webnn::native::mlas {
         }
         memcpy(memory->GetBuffer(), constant->GetBuffer(), constant->GetByteLength());
         mMemoryMap.insert(std::make_pair(operand, memory));
+        mConstants.insert(operand);
 #if (VERBOSE)
         dawn::InfoLog() << "add constant memory: " << memory.Get();
 #endif
@@ -467,26 +1432,71 @@ namespace webnn::native::mlas {
         return {};
     }
 
-    MaybeError Graph::AddOutput(std::string_view name, const OperandBase* output) {
-        DAWN_ASSERT(mMemoryMap.find(output) != mMemoryMap.end());
-        Ref<Memory> memory = mMemoryMap.at(output);
+    Ref<Memory> Graph::GetMemory(const OperandBase* operand) {
+        DAWN_ASSERT(mMemoryMap.find(operand) != mMemoryMap.end());
+        mOperandUses[operand]++;
+        return mMemoryMap.at(operand);
+    }
+
+    MaybeError Graph::AddIntermediateMemory(const Ref<Memory>& memory) {
+        if (!memory->ComputeByteLength()) {
+            return DAWN_INTERNAL_ERROR("Failed to compute the size of memory.");
+        }
+        mIntermediateMemories.push_back(memory);
+        return {};
+    }
+
+    ResultOrError<Ref<Memory>> Graph::ReorderToNchw(const OperandBase* operand,
+                                                    Ref<Memory> memory) {
+        if (!memory->IsBlockedLayout()) {
+            return std::move(memory);
+        }
+        // The consumers which need nchw layout share one reorder.
+        if (mNchwMemoryMap.find(operand) != mNchwMemoryMap.end()) {
+            return mNchwMemoryMap.at(operand);
+        }
+        // ReorderOutput
+        const size_t rank = operand->Shape().size();
+        if (rank != 4) {
+            return DAWN_INTERNAL_ERROR("NCHWc memory layout only supports rank 4.");
+        }
+        int32_t channels = operand->Shape()[1];
+        DAWN_ASSERT(channels <= memory->GetDimensions()[1]);
+        Ref<Memory> nchwMemory = AcquireRef(new Memory(operand->Type(), operand->Shape()));
+        DAWN_TRY(AddIntermediateMemory(nchwMemory));
+        std::vector<int64_t> outputShape = {operand->Shape()[0], operand->Shape()[1],
+                                            operand->Shape()[2], operand->Shape()[3]};
+        mKernels.push_back(AcquireRef(new ReorderOutput(memory, nchwMemory, outputShape)));
+        mNchwMemoryMap.insert(std::make_pair(operand, nchwMemory));
+        return std::move(nchwMemory);
+    }
+
+    ResultOrError<Ref<Memory>> Graph::ReorderToNchwc(const OperandBase* operand,
+                                                     Ref<Memory> memory) {
         if (memory->IsBlockedLayout()) {
-            // ReorderOutput
-            const size_t rank = output->Shape().size();
-            if (rank != 4) {
-                return DAWN_INTERNAL_ERROR("NCHWc memory layout only supports rank 4.");
-            }
-            int32_t channels = output->Shape()[1];
-            DAWN_ASSERT(channels <= memory->GetDimensions()[1]);
-            Ref<Memory> nchwMemory = AcquireRef(new Memory(output->Type(), output->Shape()));
-            if (!nchwMemory->Allocate()) {
-                return DAWN_INTERNAL_ERROR("Failed to allocate output memory.");
-            }
-            std::vector<int64_t> outputShape = {output->Shape()[0], output->Shape()[1],
-                                                output->Shape()[2], output->Shape()[3]};
-            mKernels.push_back(AcquireRef(new ReorderOutput(memory, nchwMemory, outputShape)));
-            memory = nchwMemory;
+            return std::move(memory);
+        }
+        // The consumers which need blocked layout share one reorder.
+        if (mNchwcMemoryMap.find(operand) != mNchwcMemoryMap.end()) {
+            return mNchwcMemoryMap.at(operand);
         }
+        const std::vector<int32_t> shape = operand->Shape();
+        DAWN_ASSERT(shape.size() == 4);
+        const size_t blockSize = MlasNchwcGetBlockSize();
+        std::vector<int32_t> nchwcShape = {
+            shape[0], static_cast<int32_t>((shape[1] + blockSize - 1) & ~(blockSize - 1)),
+            shape[2], shape[3]};
+        Ref<Memory> nchwcMemory = AcquireRef(new Memory(operand->Type(), nchwcShape, true));
+        DAWN_TRY(AddIntermediateMemory(nchwcMemory));
+        size_t inputSize = shape[2] * shape[3];
+        mKernels.push_back(AcquireRef(new ReorderInput(memory, nchwcMemory, shape[1], inputSize)));
+        mNchwcMemoryMap.insert(std::make_pair(operand, nchwcMemory));
+        return std::move(nchwcMemory);
+    }
+
+    MaybeError Graph::AddOutput(std::string_view name, const OperandBase* output) {
+        Ref<Memory> memory;
+        DAWN_TRY_ASSIGN(memory, ReorderToNchw(output, GetMemory(output)));
         mOutputs.insert(std::make_pair(name.data(), memory));
         return {};
     }
@@ -496,30 +1506,30 @@ namespace webnn::native::mlas {
         if (inputOperand->Type() != wnn::OperandType::Float32) {
             return DAWN_INTERNAL_ERROR("Only support float32");
         }
-        DAWN_ASSERT(mMemoryMap.find(inputOperand) != mMemoryMap.end());
-        Ref<Memory> inputMemory = mMemoryMap.at(inputOperand);
+        // The clamp is computed elementwise, the blocked memory is kept in blocked layout.
+        Ref<Memory> inputMemory = GetMemory(inputOperand);
         const OperandBase* outputOperand = clamp->PrimaryOutput();
-        Ref<Memory> outputMemory =
-            AcquireRef(new Memory(outputOperand->Type(), outputOperand->Shape()));
-        if (!outputMemory->Allocate()) {
-            return DAWN_INTERNAL_ERROR("Failed to allocate output memory");
-        }
+        Ref<Memory> outputMemory = AcquireRef(new Memory(
+            outputOperand->Type(), inputMemory->GetDimensions(), inputMemory->IsBlockedLayout()));
+        DAWN_TRY(AddIntermediateMemory(outputMemory));
         mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
-        std::vector<int32_t> dimensions = inputOperand->Shape();
-        size_t elementNum = std::accumulate(dimensions.begin(), dimensions.end(), (size_t)1,
-                                            std::multiplies<size_t>{});
+        size_t elementNum = GetElementNum(inputMemory->GetDimensions());
         MLAS_ACTIVATION activation;
         activation.ActivationKind = MlasClipActivation;
         activation.Parameters.Clip.minimum = clamp->GetMinValue();
         activation.Parameters.Clip.maximum = clamp->GetMaxValue();
-        mKernels.push_back(
-            AcquireRef(new Clamp(inputMemory, outputMemory, elementNum, activation)));
+        Ref<Kernel> kernel =
+            AcquireRef(new Clamp(inputMemory, outputMemory, elementNum, activation));
+        mKernels.push_back(kernel);
+        if (mGemmKernels.find(inputOperand->Operator()) != mGemmKernels.end()) {
+            mActivationFusions.push_back({inputOperand, kernel, outputMemory, activation});
+        }
         return {};
     }
 
     MaybeError Graph::AddBinary(const op::Binary* binary) {
-        if (binary->GetType() != op::BinaryOpType::kAdd) {
-            return DAWN_UNIMPLEMENTED_ERROR("Binary op is unimplemented.");
+        if (binary->GetType() == op::BinaryOpType::kMatMul) {
+            return AddMatMul(binary);
         }
         const OperandBase* a = binary->Inputs()[0].Get();
         if (a->Type() != wnn::OperandType::Float32) {
@@ -529,67 +1539,122 @@ namespace webnn::native::mlas {
         if (b->Type() != wnn::OperandType::Float32) {
             return DAWN_INTERNAL_ERROR("Only support float32 input.");
         }
-        if (a->Shape() != b->Shape()) {
-            return DAWN_INTERNAL_ERROR("Shapes don't match.");
-        }
-        DAWN_ASSERT(mMemoryMap.find(a) != mMemoryMap.end());
-        Ref<Memory> aMemory = mMemoryMap.at(a);
-        if (!aMemory->IsBlockedLayout()) {
-            return DAWN_INTERNAL_ERROR("Only support blocked memory.");
+        Ref<Memory> aMemory = GetMemory(a);
+        Ref<Memory> bMemory = GetMemory(b);
+        const OperandBase* outputOperand = binary->PrimaryOutput();
+        const std::vector<int32_t> outputShape = outputOperand->Shape();
+        std::vector<int64_t> aShape, bShape, kernelOutputShape;
+        Ref<Memory> outputMemory;
+        if (aMemory->IsBlockedLayout() || bMemory->IsBlockedLayout()) {
+            // The blocked memory is computed as [N, C / blockSize, H, W, blockSize], the other
+            // operand is either blocked as well or broadcast along the spatial axes.
+            const size_t blockSize = MlasNchwcGetBlockSize();
+            const int32_t channels = outputShape[1];
+            const int32_t nchwcChannels =
+                static_cast<int32_t>((channels + blockSize - 1) & ~(blockSize - 1));
+            if (KeepsPaddingFinite(binary->GetType()) &&
+                GetNchwcShape(a, aMemory, channels, &aShape) &&
+                GetNchwcShape(b, bMemory, channels, &bShape)) {
+                std::vector<int32_t> nchwcOutputShape = {outputShape[0], nchwcChannels,
+                                                         outputShape[2], outputShape[3]};
+                outputMemory =
+                    AcquireRef(new Memory(outputOperand->Type(), nchwcOutputShape, true));
+                kernelOutputShape = {outputShape[0], nchwcChannels / int32_t(blockSize),
+                                     outputShape[2], outputShape[3], int32_t(blockSize)};
+            } else {
+                DAWN_TRY_ASSIGN(aMemory, ReorderToNchw(a, aMemory));
+                DAWN_TRY_ASSIGN(bMemory, ReorderToNchw(b, bMemory));
+            }
         }
-        DAWN_ASSERT(mMemoryMap.find(b) != mMemoryMap.end());
-        Ref<Memory> bMemory = mMemoryMap.at(b);
-        if (!bMemory->IsBlockedLayout()) {
-            return DAWN_INTERNAL_ERROR("Only support blocked memory.");
+        if (outputMemory.Get() == nullptr) {
+            // The shapes are aligned to the output rank by prepending 1.
+            const size_t rank = outputShape.size();
+            aShape.assign(rank - a->Shape().size(), 1);
+            aShape.insert(aShape.end(), a->Shape().begin(), a->Shape().end());
+            bShape.assign(rank - b->Shape().size(), 1);
+            bShape.insert(bShape.end(), b->Shape().begin(), b->Shape().end());
+            kernelOutputShape.assign(outputShape.begin(), outputShape.end());
+            outputMemory = AcquireRef(new Memory(outputOperand->Type(), outputShape));
         }
+        DAWN_TRY(AddIntermediateMemory(outputMemory));
+        mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
+        Ref<Binary> kernel = AcquireRef(new Binary(binary->GetType(), aMemory, bMemory,
+                                                   outputMemory, aShape, bShape,
+                                                   kernelOutputShape));
 #if (VERBOSE)
-        dawn::InfoLog() << "Add add";
-        dawn::InfoLog() << "    a: " << a->Operator();
-        dawn::InfoLog() << "    b: " << b->Operator();
+        dawn::InfoLog() << "Add binary " << binary << " kernel " << kernel.Get();
+        dawn::InfoLog() << "    blocked layout: " << outputMemory->IsBlockedLayout();
 #endif
-        Ref<Conv2d> aConv2d;
-        if (mConv2dKernels.find(a->Operator()) != mConv2dKernels.end()) {
-            aConv2d = mConv2dKernels.at(a->Operator());
-        }
-        Ref<Conv2d> bConv2d;
-        if (mConv2dKernels.find(b->Operator()) != mConv2dKernels.end()) {
-            bConv2d = mConv2dKernels.at(b->Operator());
-        }
-        if (aConv2d.Get() == nullptr && bConv2d.Get() == nullptr) {
-            return DAWN_INTERNAL_ERROR("At least one operand should be conv2d.");
-        }
-        Ref<Conv2d> conv2d;
-        if (aConv2d.Get() != nullptr && bConv2d.Get() != nullptr) {
-            size_t aKernelIndex = 0;
-            for (; aKernelIndex < mKernels.size(); ++aKernelIndex) {
-                if (mKernels[aKernelIndex].Get() == aConv2d.Get()) {
-                    break;
-                }
+        mKernels.push_back(kernel);
+        if (binary->GetType() == op::BinaryOpType::kAdd && a->Shape() == b->Shape() &&
+            aMemory->IsBlockedLayout() && bMemory->IsBlockedLayout() &&
+            (mConv2dKernels.find(a->Operator()) != mConv2dKernels.end() ||
+             mConv2dKernels.find(b->Operator()) != mConv2dKernels.end())) {
+            mConv2dSumFusions.push_back({a, b, aMemory, bMemory, kernel, outputMemory});
+        }
+        return {};
+    }
+
+    Ref<Conv2d> Graph::GetConv2dForSum(const Conv2dSumFusion& fusion,
+                                       const OperandBase* conv2dOperand,
+                                       const Ref<Memory>& addendMemory) {
+        auto iter = mConv2dKernels.find(conv2dOperand->Operator());
+        if (iter == mConv2dKernels.end()) {
+            return {};
+        }
+        Ref<Conv2d> conv2d = iter->second;
+        // The activation of conv2d is applied after the sum is accumulated.
+        if (!conv2d->nchwcConv || conv2d->mActivation.ActivationKind != MlasIdentityActivation) {
+            return {};
+        }
+        // The addend is computed before the conv2d and isn't accessed by the kernels after it.
+        Memory* addend = addendMemory->GetRoot();
+        bool afterConv2d = false;
+        for (const Ref<Kernel>& kernel : mKernels) {
+            if (kernel.Get() == conv2d.Get()) {
+                afterConv2d = true;
+                continue;
             }
-            size_t bKernelIndex = 0;
-            for (; bKernelIndex < mKernels.size(); ++bKernelIndex) {
-                if (mKernels[bKernelIndex].Get() == bConv2d.Get()) {
-                    break;
-                }
+            if (!afterConv2d || kernel.Get() == fusion.kernel.Get()) {
+                continue;
             }
-            if (aKernelIndex > bKernelIndex) {
-                aConv2d->mOutput = bConv2d->mOutput;
-                conv2d = aConv2d;
-            } else {
-                bConv2d->mOutput = aConv2d->mOutput;
-                conv2d = bConv2d;
+            for (Memory* memory : kernel->GetMemories()) {
+                if (memory != nullptr && memory->GetRoot() == addend) {
+                    return {};
+                }
             }
-        } else if (aConv2d.Get() != nullptr) {
-            aConv2d->mOutput = bMemory;
-            conv2d = aConv2d;
-        } else {
-            bConv2d->mOutput = aMemory;
-            conv2d = bConv2d;
         }
+        return conv2d;
+    }
+
+    bool Graph::FuseConv2dSum(const Conv2dSumFusion& fusion) {
+        // The conv2d overwrites the memory of the other addend with the sum, so neither addend
+        // may be used by other ops or as a graph output.
+        if (mOperandUses.at(fusion.a) != 1 || mOperandUses.at(fusion.b) != 1) {
+            return false;
+        }
+        Ref<Memory> addendMemory = fusion.aMemory;
+        Ref<Conv2d> conv2d = GetConv2dForSum(fusion, fusion.b, addendMemory);
+        if (conv2d.Get() == nullptr) {
+            addendMemory = fusion.bMemory;
+            conv2d = GetConv2dForSum(fusion, fusion.a, addendMemory);
+        }
+        if (conv2d.Get() == nullptr) {
+            return false;
+        }
+#if (VERBOSE)
+        dawn::InfoLog() << "Fuse add kernel " << fusion.kernel.Get() << " into conv2d kernel "
+                        << conv2d.Get();
+#endif
+        conv2d->mOutput = addendMemory;
         conv2d->mZeroMode = false;
-        const OperandBase* output = binary->PrimaryOutput();
-        mMemoryMap.insert(std::make_pair(output, conv2d->mOutput));
-        return {};
+        fusion.output->SetSource(addendMemory);
+        auto kernel = std::find_if(
+            mKernels.begin(), mKernels.end(),
+            [&fusion](const Ref<Kernel>& kernel) { return kernel.Get() == fusion.kernel.Get(); });
+        DAWN_ASSERT(kernel != mKernels.end());
+        mKernels.erase(kernel);
+        return true;
     }
 
     MaybeError Graph::AddConv2d(const op::Conv2d* conv2d) {
@@ -609,7 +1674,6 @@ namespace webnn::native::mlas {
             return DAWN_INTERNAL_ERROR("Only support float32 filter");
         }
         size_t groupCount = options->groups;
-        size_t batchCount = inputOperand->Shape()[0];
         size_t inputChannels = inputOperand->Shape()[1];
         size_t outputChannels = filterOperand->Shape()[0];
         int32_t inputHeight = inputOperand->Shape()[2];
@@ -641,8 +1705,6 @@ namespace webnn::native::mlas {
         // The current implementation of ReorderInput requires the channel count to be
         // aligned to this value.
         constexpr int64_t channelAlignment = 4;
-        const int64_t nchwcInputChannels =
-            (inputChannels + nchwcBlockSize - 1) & ~(nchwcBlockSize - 1);
         const int64_t nchwcOutputChannels =
             (outputChannels + nchwcBlockSize - 1) & ~(nchwcBlockSize - 1);
 
@@ -675,31 +1737,13 @@ namespace webnn::native::mlas {
             }
         }
 
-        DAWN_ASSERT(mMemoryMap.find(inputOperand) != mMemoryMap.end());
-        Ref<Memory> inputMemory = mMemoryMap.at(inputOperand);
+        Ref<Memory> inputMemory = GetMemory(inputOperand);
         if (nchwcConv && reorderInput) {
-            if (!inputMemory->IsBlockedLayout()) {
-                Ref<Memory> reorderInputMemory = inputMemory;
-                std::vector<int32_t> reorderedOutputShape = {
-                    static_cast<int32_t>(batchCount), static_cast<int32_t>(nchwcInputChannels),
-                    inputHeight, inputWidth};
-                Ref<Memory> reorderOutputMemory =
-                    AcquireRef(new Memory(inputOperand->Type(), reorderedOutputShape, true));
-                if (!reorderOutputMemory->Allocate()) {
-                    return DAWN_INTERNAL_ERROR("Failed to allocate reorder output memory.");
-                }
-                size_t inputSize = inputHeight * inputWidth;
-                mKernels.push_back(AcquireRef(new ReorderInput(
-                    reorderInputMemory, reorderOutputMemory, inputChannels, inputSize)));
-                inputMemory = reorderOutputMemory;
-                inputShape[1] = nchwcInputChannels;
-            } else {
-                inputShape[1] = inputMemory->GetDimensions()[1];
-            }
+            DAWN_TRY_ASSIGN(inputMemory, ReorderToNchwc(inputOperand, inputMemory));
+            inputShape[1] = inputMemory->GetDimensions()[1];
         }
 
-        DAWN_ASSERT(mMemoryMap.find(filterOperand) != mMemoryMap.end());
-        Ref<Memory> filterMemory = mMemoryMap.at(filterOperand);
+        Ref<Memory> filterMemory = GetMemory(filterOperand);
         if (nchwcConv && !filterMemory->IsBlockedLayout()) {
             std::vector<int32_t> reorderedFilterShape = {static_cast<int32_t>(nchwcOutputChannels),
                                                          static_cast<int32_t>(filterInputChannels),
@@ -728,8 +1772,7 @@ namespace webnn::native::mlas {
             if (biasOperand->Type() != wnn::OperandType::Float32) {
                 return DAWN_INTERNAL_ERROR("Only support float32 bias");
             }
-            DAWN_ASSERT(mMemoryMap.find(biasOperand) != mMemoryMap.end());
-            biasMemory = mMemoryMap.at(biasOperand);
+            biasMemory = GetMemory(biasOperand);
             if (nchwcConv && !biasMemory->IsBlockedLayout()) {
                 std::vector<int32_t> alignedBiasShape = {static_cast<int32_t>(nchwcOutputChannels)};
                 Ref<Memory> alignedBiasMemory =
@@ -737,6 +1780,8 @@ namespace webnn::native::mlas {
                 if (!alignedBiasMemory->Allocate()) {
                     return DAWN_INTERNAL_ERROR("Failed to allocate reorder output memory.");
                 }
+                // The padded channels are zero so the padded output channels stay finite.
+                memset(alignedBiasMemory->GetBuffer(), 0, alignedBiasMemory->GetByteLength());
                 memcpy(alignedBiasMemory->GetBuffer(), biasMemory->GetBuffer(),
                        biasMemory->GetByteLength());
                 biasMemory = alignedBiasMemory;
@@ -744,36 +1789,7 @@ namespace webnn::native::mlas {
         }
 
         MLAS_ACTIVATION activation;
-        activation.ActivationKind = MlasIdentityActivation;
-        if (options->activation) {
-            switch (options->activation->GetFusionType()) {
-                case FusionType::Clamp:
-                    activation.ActivationKind = MlasClipActivation;
-                    activation.Parameters.Clip.minimum =
-                        reinterpret_cast<op::FusionClamp*>(options->activation)->GetMinValue();
-                    activation.Parameters.Clip.maximum =
-                        reinterpret_cast<op::FusionClamp*>(options->activation)->GetMaxValue();
-                    break;
-                case FusionType::HardSwish:
-                    activation.ActivationKind = MlasHardSigmoidActivation;
-                    activation.Parameters.HardSigmoid.alpha = 1.0 / 6.0;
-                    activation.Parameters.HardSigmoid.beta = 0.5;
-                    break;
-                case FusionType::Relu:
-                    activation.ActivationKind = MlasReluActivation;
-                    break;
-                case FusionType::Sigmoid:
-                    activation.ActivationKind = MlasLogisticActivation;
-                    break;
-                case FusionType::LeakyRelu:
-                    activation.ActivationKind = MlasLeakyReluActivation;
-                    activation.Parameters.LeakyRelu.alpha =
-                        reinterpret_cast<op::FusionLeakyRelu*>(options->activation)->GetAlpha();
-                    break;
-                default:
-                    return DAWN_INTERNAL_ERROR("Unsupported fused activation");
-            }
-        }
+        DAWN_TRY(GetFusedActivation(options->activation, &activation));
 
         Ref<Memory> outputMemory;
         if (!nchwcConv) {
@@ -785,17 +1801,19 @@ namespace webnn::native::mlas {
             outputMemory = AcquireRef(new Memory(outputOperand->Type(), nchwcOutputShape, true));
             outputShape[1] = nchwcOutputChannels;
         }
-        if (!outputMemory->Allocate()) {
-            return DAWN_INTERNAL_ERROR("Failed to allocate output memory");
-        }
+        DAWN_TRY(AddIntermediateMemory(outputMemory));
         mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
 
         Ref<Conv2d> kernel = AcquireRef(new Conv2d(
             nchwcConv, inputMemory, filterMemory, biasMemory, outputMemory, inputShape, kernelShape,
             dilationShape, padding, strideShape, outputShape, nchwcGroupCount, activation));
         if (!nchwcConv) {
-            if (!kernel->Prepare(reinterpret_cast<Context*>(GetContext())->GetThreadPool())) {
-                return DAWN_INTERNAL_ERROR("Failed to prepare conv2d.");
+            size_t workingBufferSize =
+                kernel->Prepare(reinterpret_cast<Context*>(GetContext())->GetThreadPool());
+            if (workingBufferSize > 0) {
+                kernel->mWorkingBuffer = AcquireRef(
+                    new Memory(wnn::OperandType::Float32, {int32_t(workingBufferSize)}));
+                DAWN_TRY(AddIntermediateMemory(kernel->mWorkingBuffer));
             }
         }
 #if (VERBOSE)
@@ -828,7 +1846,6 @@ namespace webnn::native::mlas {
         } else {
             return DAWN_INTERNAL_ERROR("Pool type is unsupported");
         }
-        size_t batchCount = inputOperand->Shape()[0];
         size_t inputChannels = inputOperand->Shape()[1];
         std::vector<int64_t> inputShape = {inputOperand->Shape()[0], inputOperand->Shape()[1],
                                            inputOperand->Shape()[2], inputOperand->Shape()[3]};
@@ -865,27 +1882,10 @@ namespace webnn::native::mlas {
             return DAWN_INTERNAL_ERROR("Only support nchwc pool");
         }
 
-        DAWN_ASSERT(mMemoryMap.find(inputOperand) != mMemoryMap.end());
-        Ref<Memory> inputMemory = mMemoryMap.at(inputOperand);
+        Ref<Memory> inputMemory = GetMemory(inputOperand);
         if (nchwcPool && reorderInput) {
-            if (!inputMemory->IsBlockedLayout()) {
-                Ref<Memory> reorderInputMemory = inputMemory;
-                std::vector<int32_t> reorderedOutputShape = {static_cast<int32_t>(batchCount),
-                                                             static_cast<int32_t>(nchwcChannels),
-                                                             inputHeight, inputWidth};
-                Ref<Memory> reorderOutputMemory =
-                    AcquireRef(new Memory(inputOperand->Type(), reorderedOutputShape, true));
-                if (!reorderOutputMemory->Allocate()) {
-                    return DAWN_INTERNAL_ERROR("Failed to allocate reorder output memory.");
-                }
-                size_t inputSize = inputHeight * inputWidth;
-                mKernels.push_back(AcquireRef(new ReorderInput(
-                    reorderInputMemory, reorderOutputMemory, inputChannels, inputSize)));
-                inputMemory = reorderOutputMemory;
-                inputShape[1] = nchwcChannels;
-            } else {
-                inputShape[1] = inputMemory->GetDimensions()[1];
-            }
+            DAWN_TRY_ASSIGN(inputMemory, ReorderToNchwc(inputOperand, inputMemory));
+            inputShape[1] = inputMemory->GetDimensions()[1];
         }
 
         const OperandBase* outputOperand = pool2d->PrimaryOutput();
@@ -896,9 +1896,7 @@ namespace webnn::native::mlas {
             outputOperand->Shape()[0], inputMemory->GetDimensions()[1], outputOperand->Shape()[2],
             outputOperand->Shape()[3]};
         outputMemory = AcquireRef(new Memory(outputOperand->Type(), nchwcOutputShape, true));
-        if (!outputMemory->Allocate()) {
-            return DAWN_INTERNAL_ERROR("Failed to allocate output memory");
-        }
+        DAWN_TRY(AddIntermediateMemory(outputMemory));
         mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
         Ref<Pool2d> kernel =
             AcquireRef(new Pool2d(kind, globalPooling, inputMemory, outputMemory, inputShape,
@@ -920,18 +1918,19 @@ namespace webnn::native::mlas {
             if (inputOperand->Type() != wnn::OperandType::Float32) {
                 return DAWN_INTERNAL_ERROR("Only support float32");
             }
-            DAWN_ASSERT(mMemoryMap.find(inputOperand) != mMemoryMap.end());
-            Ref<Memory> inputMemory = mMemoryMap.at(inputOperand);
+            // The ops except softmax are computed elementwise, the blocked memory is kept in
+            // blocked layout.
+            Ref<Memory> inputMemory = GetMemory(inputOperand);
+            if (opType == op::UnaryOpType::kSoftmax) {
+                DAWN_TRY_ASSIGN(inputMemory, ReorderToNchw(inputOperand, inputMemory));
+            }
             const OperandBase* outputOperand = unary->PrimaryOutput();
             Ref<Memory> outputMemory =
-                AcquireRef(new Memory(outputOperand->Type(), outputOperand->Shape()));
-            if (!outputMemory->Allocate()) {
-                return DAWN_INTERNAL_ERROR("Failed to allocate output memory");
-            }
+                AcquireRef(new Memory(outputOperand->Type(), inputMemory->GetDimensions(),
+                                      inputMemory->IsBlockedLayout()));
+            DAWN_TRY(AddIntermediateMemory(outputMemory));
             mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
-            std::vector<int32_t> dimensions = inputOperand->Shape();
-            size_t elementNum = std::accumulate(dimensions.begin(), dimensions.end(), (size_t)1,
-                                                std::multiplies<size_t>{});
+            size_t elementNum = GetElementNum(inputMemory->GetDimensions());
             MLAS_ACTIVATION activation;
             if (opType == op::UnaryOpType::kRelu) {
                 activation.ActivationKind = MlasReluActivation;
@@ -944,18 +1943,454 @@ namespace webnn::native::mlas {
                 activation.Parameters.LeakyRelu.alpha =
                     reinterpret_cast<const op::LeakyRelu*>(unary)->GetAlpha();
             }
-            mKernels.push_back(
-                AcquireRef(new Unary(opType, inputMemory, outputMemory, elementNum, activation)));
+            Ref<Kernel> kernel =
+                AcquireRef(new Unary(opType, inputMemory, outputMemory, elementNum, activation));
+            mKernels.push_back(kernel);
+            MLAS_ACTIVATION fusibleActivation;
+            if (mGemmKernels.find(inputOperand->Operator()) != mGemmKernels.end() &&
+                GetFusibleActivation(unary, &fusibleActivation)) {
+                mActivationFusions.push_back(
+                    {inputOperand, kernel, outputMemory, fusibleActivation});
+            }
         } else {
             return DAWN_UNIMPLEMENTED_ERROR("Unsupported unary op");
         }
         return {};
     }
 
+    MaybeError Graph::AddConcat(const op::Concat* concat) {
+        const OperandBase* outputOperand = concat->PrimaryOutput();
+        const std::vector<int32_t> outputShape = outputOperand->Shape();
+        const uint32_t axis = concat->GetAxis();
+        auto inputs = concat->Inputs();
+        std::vector<Ref<Memory>> inputMemories;
+        bool nchwcConcat = axis == 1 && outputShape.size() == 4;
+        for (auto& input : inputs) {
+            if (input->Type() != wnn::OperandType::Float32) {
+                return DAWN_INTERNAL_ERROR("Only support float32 input.");
+            }
+            inputMemories.push_back(GetMemory(input.Get()));
+            nchwcConcat = nchwcConcat && inputMemories.back()->IsBlockedLayout();
+        }
+        Ref<Memory> outputMemory;
+        Ref<Kernel> kernel;
+        if (nchwcConcat) {
+            // The channels are concatenated in blocked layout if all inputs are blocked.
+            const size_t blockSize = MlasNchwcGetBlockSize();
+            std::vector<int32_t> nchwcOutputShape = {
+                outputShape[0],
+                static_cast<int32_t>((outputShape[1] + blockSize - 1) & ~(blockSize - 1)),
+                outputShape[2], outputShape[3]};
+            outputMemory = AcquireRef(new Memory(outputOperand->Type(), nchwcOutputShape, true));
+            DAWN_TRY(AddIntermediateMemory(outputMemory));
+            std::vector<size_t> channels;
+            for (auto& input : inputs) {
+                channels.push_back(input->Shape()[1]);
+            }
+            kernel = AcquireRef(new ConcatNchwc(inputMemories, outputMemory, channels,
+                                                outputShape[0], outputShape[2] * outputShape[3]));
+        } else {
+            std::vector<size_t> inputSizes;
+            for (size_t i = 0; i < inputs.size(); ++i) {
+                DAWN_TRY_ASSIGN(inputMemories[i], ReorderToNchw(inputs[i].Get(), inputMemories[i]));
+                std::vector<int32_t> inputShape = inputs[i]->Shape();
+                inputSizes.push_back(GetElementNum(
+                    std::vector<int32_t>(inputShape.begin() + axis, inputShape.end())));
+            }
+            size_t outerSize = GetElementNum(
+                std::vector<int32_t>(outputShape.begin(), outputShape.begin() + axis));
+            outputMemory = AcquireRef(new Memory(outputOperand->Type(), outputShape));
+            DAWN_TRY(AddIntermediateMemory(outputMemory));
+            kernel = AcquireRef(new Concat(inputMemories, outputMemory, outerSize, inputSizes));
+        }
+        mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
+#if (VERBOSE)
+        dawn::InfoLog() << "Add concat " << concat << " kernel " << kernel.Get();
+        dawn::InfoLog() << "    blocked layout: " << nchwcConcat;
+#endif
+        mKernels.push_back(kernel);
+        return {};
+    }
+
+    MaybeError Graph::AddResample2d(const op::Resample2d* resample2d) {
+        const OperandBase* inputOperand = resample2d->Inputs()[0].Get();
+        if (inputOperand->Type() != wnn::OperandType::Float32) {
+            return DAWN_INTERNAL_ERROR("Only support float32 input");
+        }
+        const std::vector<int32_t> inputShape = inputOperand->Shape();
+        const OperandBase* outputOperand = resample2d->PrimaryOutput();
+        const std::vector<int32_t> outputShape = outputOperand->Shape();
+        const std::vector<int32_t> axes = resample2d->GetAxes();
+        const wnn::InterpolationMode mode = resample2d->GetOptions()->mode;
+        const size_t blockSize = MlasNchwcGetBlockSize();
+        Ref<Memory> inputMemory = GetMemory(inputOperand);
+        // The spatial axes of the blocked memory are resampled in blocked layout.
+        bool nchwcResample = inputMemory->IsBlockedLayout() && axes[0] == 2;
+        if (!nchwcResample) {
+            DAWN_TRY_ASSIGN(inputMemory, ReorderToNchw(inputOperand, inputMemory));
+        }
+        std::vector<int32_t> dims = inputMemory->GetDimensions();
+        size_t outerSize =
+            GetElementNum(std::vector<int32_t>(dims.begin(), dims.begin() + axes[0]));
+        size_t innerSize =
+            GetElementNum(std::vector<int32_t>(dims.begin() + axes[1] + 1, dims.end()));
+        std::vector<int32_t> outputDims = outputShape;
+        if (nchwcResample) {
+            outerSize /= blockSize;
+            innerSize = blockSize;
+            outputDims[1] = dims[1];
+        }
+        Ref<Memory> outputMemory =
+            AcquireRef(new Memory(outputOperand->Type(), outputDims, nchwcResample));
+        DAWN_TRY(AddIntermediateMemory(outputMemory));
+        mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
+
+        const int32_t inputHeight = inputShape[axes[0]];
+        const int32_t inputWidth = inputShape[axes[1]];
+        const int32_t outputHeight = outputShape[axes[0]];
+        const int32_t outputWidth = outputShape[axes[1]];
+        Ref<Kernel> kernel;
+        if (nchwcResample && mode == wnn::InterpolationMode::NearestNeighbor &&
+            outputHeight % inputHeight == 0 && outputWidth % inputWidth == 0) {
+            std::vector<int64_t> nchwcInputShape = {dims[0], dims[1], dims[2], dims[3]};
+            std::vector<int64_t> scales = {outputHeight / inputHeight, outputWidth / inputWidth};
+            kernel = AcquireRef(new UpsampleNchwc(inputMemory, outputMemory, nchwcInputShape,
+                                                  scales));
+        } else {
+            kernel = AcquireRef(new Resample2d(inputMemory, outputMemory, mode, outerSize,
+                                               innerSize, inputHeight, inputWidth, outputHeight,
+                                               outputWidth));
+        }
+#if (VERBOSE)
+        dawn::InfoLog() << "Add resample2d " << resample2d << " kernel " << kernel.Get();
+        dawn::InfoLog() << "    blocked layout: " << nchwcResample;
+#endif
+        mKernels.push_back(kernel);
+        return {};
+    }
+
+    MaybeError Graph::AddConvTranspose2d(const op::ConvTranspose2d* convTranspose2d) {
+        const ConvTranspose2dOptions* options = convTranspose2d->GetOptions();
+        // The gemm of the kernel reads the filter as [groups, inputChannels / groups,
+        // outputChannels / groups * kernelSize], which is the iohw layout only.
+        if (options->inputLayout != wnn::InputOperandLayout::Nchw) {
+            return DAWN_UNIMPLEMENTED_ERROR(
+                "The MLAS convTranspose2d only supports the nchw input layout.");
+        }
+        if (options->filterLayout != wnn::ConvTranspose2dFilterOperandLayout::Iohw) {
+            return DAWN_UNIMPLEMENTED_ERROR(
+                "The MLAS convTranspose2d only supports the iohw filter layout, the hwoi and "
+                "ohwi filter layouts are unimplemented.");
+        }
+        const OperandBase* inputOperand = convTranspose2d->Inputs()[0].Get();
+        if (inputOperand->Type() != wnn::OperandType::Float32) {
+            return DAWN_INTERNAL_ERROR("Only support float32 input");
+        }
+        const OperandBase* filterOperand = convTranspose2d->Inputs()[1].Get();
+        if (filterOperand->Type() != wnn::OperandType::Float32) {
+            return DAWN_INTERNAL_ERROR("Only support float32 filter");
+        }
+        // The blocked input is reordered, the col2im of the gemm output is done in nchw layout.
+        Ref<Memory> inputMemory;
+        DAWN_TRY_ASSIGN(inputMemory, ReorderToNchw(inputOperand, GetMemory(inputOperand)));
+        Ref<Memory> filterMemory = GetMemory(filterOperand);
+        Ref<Memory> biasMemory;
+        if (options->bias) {
+            const OperandBase* biasOperand = convTranspose2d->Inputs()[2].Get();
+            if (biasOperand->Type() != wnn::OperandType::Float32) {
+                return DAWN_INTERNAL_ERROR("Only support float32 bias");
+            }
+            biasMemory = GetMemory(biasOperand);
+        }
+        MLAS_ACTIVATION activation;
+        DAWN_TRY(GetFusedActivation(options->activation, &activation));
+
+        int32_t inputHeight = inputOperand->Shape()[2];
+        int32_t inputWidth = inputOperand->Shape()[3];
+        int32_t filterHeight = filterOperand->Shape()[2];
+        int32_t filterWidth = filterOperand->Shape()[3];
+        std::vector<int64_t> inputShape = {inputOperand->Shape()[0], inputOperand->Shape()[1],
+                                           inputHeight, inputWidth};
+        std::vector<int64_t> kernelShape = {filterHeight, filterWidth};
+        std::vector<int64_t> dilationShape = {options->dilations[0], options->dilations[1]};
+        std::vector<int64_t> padding(options->padding, options->padding + options->paddingCount);
+        if (options->autoPad != wnn::AutoPad::Explicit) {
+            padding = utils::ComputeImplicitPaddingForConvTranspose2dAutoPad<int64_t>(
+                options, {inputHeight, inputWidth}, {filterHeight, filterWidth});
+        }
+        std::vector<int64_t> strideShape = {options->strides[0], options->strides[1]};
+        const OperandBase* outputOperand = convTranspose2d->PrimaryOutput();
+        std::vector<int64_t> outputShape = {outputOperand->Shape()[0], outputOperand->Shape()[1],
+                                            outputOperand->Shape()[2], outputOperand->Shape()[3]};
+        Ref<Memory> outputMemory =
+            AcquireRef(new Memory(outputOperand->Type(), outputOperand->Shape()));
+        DAWN_TRY(AddIntermediateMemory(outputMemory));
+        mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
+        // The columns of a group are [outputChannels / groups * kernelSize, inputSize].
+        int32_t columnSize = outputShape[1] / options->groups * filterHeight * filterWidth *
+                             inputHeight * inputWidth;
+        Ref<Memory> columnBuffer =
+            AcquireRef(new Memory(wnn::OperandType::Float32, {columnSize}));
+        DAWN_TRY(AddIntermediateMemory(columnBuffer));
+
+        Ref<Kernel> kernel = AcquireRef(new ConvTranspose2d(
+            inputMemory, filterMemory, biasMemory, outputMemory, columnBuffer, inputShape,
+            kernelShape, dilationShape, padding, strideShape, outputShape, options->groups,
+            activation));
+#if (VERBOSE)
+        dawn::InfoLog() << "Add convTranspose2d " << convTranspose2d << " kernel " << kernel.Get();
+        dawn::InfoLog() << "    input memory: " << inputMemory.Get();
+        dawn::InfoLog() << "    output memory: " << outputMemory.Get();
+#endif
+        mKernels.push_back(kernel);
+        return {};
+    }
+
+    MaybeError Graph::AddGemm(const op::Gemm* gemm) {
+        auto inputs = gemm->Inputs();
+        DAWN_ASSERT(inputs.size() == 2 || inputs.size() == 3);
+        for (auto& input : inputs) {
+            if (input->Type() != wnn::OperandType::Float32) {
+                return DAWN_INTERNAL_ERROR("Only support float32 input.");
+            }
+        }
+        const GemmOptions* options = gemm->GetOptions();
+        Ref<Memory> cMemory;
+        if (inputs.size() == 3) {
+            cMemory = GetMemory(inputs[2].Get());
+            if (cMemory->IsBlockedLayout()) {
+                return DAWN_INTERNAL_ERROR("Only support nchw memory.");
+            }
+        }
+        const OperandBase* a = inputs[0].Get();
+        const std::vector<int32_t> outputShape = gemm->PrimaryOutput()->Shape();
+        size_t m = outputShape[0];
+        size_t n = outputShape[1];
+        size_t k = options->aTranspose ? a->Shape()[0] : a->Shape()[1];
+        return AddGemmKernel(gemm, a, inputs[1].Get(), cMemory, options->aTranspose,
+                             options->bTranspose, m, n, k, options->alpha, options->beta, {0},
+                             {0});
+    }
+
+    MaybeError Graph::AddMatMul(const op::Binary* matMul) {
+        const OperandBase* a = matMul->Inputs()[0].Get();
+        const OperandBase* b = matMul->Inputs()[1].Get();
+        if (a->Type() != wnn::OperandType::Float32 || b->Type() != wnn::OperandType::Float32) {
+            return DAWN_INTERNAL_ERROR("Only support float32 input.");
+        }
+        // The 1-D a is the row vector [1, K] and the 1-D b is the column vector [K, 1].
+        const std::vector<int32_t> aShape = a->Shape();
+        const std::vector<int32_t> bShape = b->Shape();
+        const size_t aRank = aShape.size();
+        const size_t bRank = bShape.size();
+        if ((aRank == 1 && bRank > 2) || (aRank > 2 && bRank == 1)) {
+            return DAWN_UNIMPLEMENTED_ERROR("The 1-D input is only supported with 2-D input.");
+        }
+        size_t m = aRank == 1 ? 1 : aShape[aRank - 2];
+        size_t k = aShape[aRank - 1];
+        size_t n = bRank == 1 ? 1 : bShape[bRank - 1];
+        std::vector<int32_t> aBatchShape, bBatchShape, outputBatchShape;
+        if (aRank > 2) {
+            aBatchShape.assign(aShape.begin(), aShape.end() - 2);
+        }
+        if (bRank > 2) {
+            bBatchShape.assign(bShape.begin(), bShape.end() - 2);
+        }
+        const std::vector<int32_t> outputShape = matMul->PrimaryOutput()->Shape();
+        if (outputShape.size() > 2) {
+            outputBatchShape.assign(outputShape.begin(), outputShape.end() - 2);
+        }
+        return AddGemmKernel(matMul, a, b, Ref<Memory>(), false, false, m, n, k, 1.0f, 0.0f,
+                             GetBatchIndices(outputBatchShape, aBatchShape),
+                             GetBatchIndices(outputBatchShape, bBatchShape));
+    }
+
+    MaybeError Graph::AddGemmKernel(const OperatorBase* op,
+                                    const OperandBase* a,
+                                    const OperandBase* b,
+                                    const Ref<Memory>& cMemory,
+                                    bool aTranspose,
+                                    bool bTranspose,
+                                    size_t m,
+                                    size_t n,
+                                    size_t k,
+                                    float alpha,
+                                    float beta,
+                                    const std::vector<size_t>& aBatchIndices,
+                                    const std::vector<size_t>& bBatchIndices) {
+        Ref<Memory> aMemory = GetMemory(a);
+        Ref<Memory> bMemory = GetMemory(b);
+        if (aMemory->IsBlockedLayout() || bMemory->IsBlockedLayout()) {
+            return DAWN_INTERNAL_ERROR("Only support nchw memory.");
+        }
+        const OperandBase* outputOperand = op->PrimaryOutput();
+        Ref<Memory> outputMemory =
+            AcquireRef(new Memory(outputOperand->Type(), outputOperand->Shape()));
+        DAWN_TRY(AddIntermediateMemory(outputMemory));
+        mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
+        Ref<Gemm> kernel = AcquireRef(new Gemm(aMemory, bMemory, cMemory, outputMemory,
+                                               aTranspose, bTranspose, m, n, k, alpha, beta,
+                                               aBatchIndices, bBatchIndices));
+        if (mConstants.find(b) != mConstants.end()) {
+            if (!kernel->PackB()) {
+                return DAWN_INTERNAL_ERROR("Failed to pack B.");
+            }
+        }
+#if (VERBOSE)
+        dawn::InfoLog() << "Add gemm " << op << " kernel " << kernel.Get();
+#endif
+        mKernels.push_back(kernel);
+        mGemmKernels.insert(std::make_pair(op, kernel));
+        return {};
+    }
+
+    MaybeError Graph::AddReshape(const op::Reshape* reshape) {
+        const OperandBase* inputOperand = reshape->Inputs()[0].Get();
+        Ref<Memory> inputMemory;
+        DAWN_TRY_ASSIGN(inputMemory, ReorderToNchw(inputOperand, GetMemory(inputOperand)));
+        const OperandBase* outputOperand = reshape->PrimaryOutput();
+        // The data isn't copied, the output is a view of the input memory.
+        Ref<Memory> outputMemory = AcquireRef(new Memory(inputMemory, outputOperand->Shape()));
+        mMemoryMap.insert(std::make_pair(outputOperand, outputMemory));
+        return {};
+    }
+
     MaybeError Graph::Finish() {
+        // The activation is fused into the epilogue of gemm if the gemm output isn't used by
+        // other ops or as a graph output, the gemm writes to the activation output directly.
+        for (auto& fusion : mActivationFusions) {
+            if (mOperandUses.at(fusion.input) != 1) {
+                continue;
+            }
+            Ref<Gemm> gemm = mGemmKernels.at(fusion.input->Operator());
+            gemm->mOutput = fusion.output;
+            gemm->mActivation = fusion.activation;
+            auto kernel = std::find_if(mKernels.begin(), mKernels.end(),
+                                       [&fusion](const Ref<Kernel>& kernel) {
+                                           return kernel.Get() == fusion.kernel.Get();
+                                       });
+            DAWN_ASSERT(kernel != mKernels.end());
+            mKernels.erase(kernel);
+        }
+        // The add of conv2d and another blocked operand is fused into the nchwc conv2d, which
+        // accumulates into the memory of the other addend, if both addends are only used by
+        // the add.
+        for (auto& fusion : mConv2dSumFusions) {
+            FuseConv2dSum(fusion);
+        }
+        return PlanMemory();
+    }
+
+    MaybeError Graph::PlanMemory() {
+        // The lifetime of an intermediate memory is the range of the kernels using it, the
+        // working buffers are only used by their kernels so they share the space. The graph
+        // outputs are alive until they are copied after the last kernel.
+        struct Allocation {
+            Memory* memory;
+            size_t size;
+            size_t first;
+            size_t last;
+            size_t offset;
+        };
+        std::unordered_map<Memory*, Allocation> allocations;
+        for (const Ref<Memory>& memory : mIntermediateMemories) {
+            allocations[memory.Get()] = {memory.Get(), 0, SIZE_MAX, 0, 0};
+        }
+        auto use = [&allocations](Memory* memory, size_t first, size_t last) {
+            auto allocation = allocations.find(memory->GetRoot());
+            if (allocation != allocations.end()) {
+                allocation->second.first = std::min(allocation->second.first, first);
+                allocation->second.last = std::max(allocation->second.last, last);
+            }
+        };
+        for (size_t i = 0; i < mKernels.size(); ++i) {
+            for (Memory* memory : mKernels[i]->GetMemories()) {
+                if (memory != nullptr) {
+                    use(memory, i, i);
+                }
+            }
+        }
+        for (auto& [_, memory] : mOutputs) {
+            use(memory.Get(), mKernels.size(), mKernels.size());
+        }
+
+        // Places the largest memory first at the lowest offset which doesn't overlap the placed
+        // memories alive at the same time.
+        const size_t alignment = MlasGetPreferredBufferAlignment();
+        std::vector<Allocation*> sorted;
+        for (auto& [_, allocation] : allocations) {
+            // The memory which isn't used by any kernel after fusion isn't placed.
+            if (allocation.first == SIZE_MAX) {
+                continue;
+            }
+            allocation.size =
+                (allocation.memory->GetByteLength() + alignment - 1) / alignment * alignment;
+            sorted.push_back(&allocation);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const Allocation* a, const Allocation* b) {
+            return a->size > b->size || (a->size == b->size && a->first < b->first);
+        });
+        std::vector<const Allocation*> placed;
+        size_t arenaSize = 0;
+        for (Allocation* allocation : sorted) {
+            std::vector<const Allocation*> overlaps;
+            for (const Allocation* other : placed) {
+                if (other->first <= allocation->last && allocation->first <= other->last) {
+                    overlaps.push_back(other);
+                }
+            }
+            std::sort(overlaps.begin(), overlaps.end(),
+                      [](const Allocation* a, const Allocation* b) {
+                          return a->offset < b->offset;
+                      });
+            size_t offset = 0;
+            for (const Allocation* other : overlaps) {
+                if (offset + allocation->size <= other->offset) {
+                    break;
+                }
+                offset = std::max(offset, other->offset + other->size);
+            }
+            allocation->offset = offset;
+            placed.push_back(allocation);
+            arenaSize = std::max(arenaSize, offset + allocation->size);
+        }
+
+        mArena = nullptr;
+        if (arenaSize > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+            return DAWN_OUT_OF_MEMORY_ERROR("The memory arena is too large.");
+        }
+        if (arenaSize > 0) {
+            mArena = AcquireRef(
+                new Memory(wnn::OperandType::Uint8, {static_cast<int32_t>(arenaSize)}));
+            if (!mArena->Allocate()) {
+                return DAWN_OUT_OF_MEMORY_ERROR("Failed to allocate the memory arena.");
+            }
+            int8_t* base = reinterpret_cast<int8_t*>(mArena->GetBuffer());
+            for (const Allocation* allocation : placed) {
+                allocation->memory->SetBuffer(base + allocation->offset);
+            }
+        }
+        mPeakMemoryBytes = arenaSize;
+        mIntermediateMemoryBytes = 0;
+        for (const Allocation* allocation : placed) {
+            mIntermediateMemoryBytes += allocation->size;
+        }
+#if (VERBOSE)
+        dawn::InfoLog() << "Planned " << placed.size() << " intermediate memories into an arena of "
+                        << arenaSize << " bytes instead of " << mIntermediateMemoryBytes
+                        << " bytes";
+#endif
         return {};
     }
 
+    size_t Graph::GetPeakMemoryBytes() const {
+        return mPeakMemoryBytes;
+    }
+
+    size_t Graph::GetIntermediateMemoryBytes() const {
+        return mIntermediateMemoryBytes;
+    }
+
     MaybeError Graph::CompileImpl() {
         return {};
     }
@@ -23,12 +23,15 @@
 #include "webnn/native/mlas/ContextMLAS.h"
 #include "webnn/native/ops/Binary.h"
 #include "webnn/native/ops/Clamp.h"
+#include "webnn/native/ops/Concat.h"
 #include "webnn/native/ops/Constant.h"
 #include "webnn/native/ops/Conv2d.h"
+#include "webnn/native/ops/Gemm.h"
 #include "webnn/native/ops/Input.h"
 #include "webnn/native/ops/LeakyRelu.h"
 #include "webnn/native/ops/Pool2d.h"
 #include "webnn/native/ops/Reshape.h"
+#include "webnn/native/ops/Resample2d.h"
 #include "webnn/native/ops/Transpose.h"
 #include "webnn/native/ops/Unary.h"
 
@@ -37,6 +40,7 @@ namespace webnn::native::mlas {
     class Memory;
     class Kernel;
     class Conv2d;
+    class Gemm;
 
     class Graph : public GraphBase {
       public:
@@ -48,20 +52,92 @@ namespace webnn::native::mlas {
         virtual MaybeError AddOutput(std::string_view name, const OperandBase* output) override;
         virtual MaybeError AddBinary(const op::Binary* binary) override;
         virtual MaybeError AddClamp(const op::Clamp* clamp) override;
+        virtual MaybeError AddConcat(const op::Concat* concat) override;
         virtual MaybeError AddConv2d(const op::Conv2d* conv2d) override;
+        virtual MaybeError AddConvTranspose2d(const op::ConvTranspose2d* convTranspose2d) override;
+        virtual MaybeError AddGemm(const op::Gemm* gemm) override;
         virtual MaybeError AddPool2d(const op::Pool2d* pool2d) override;
+        virtual MaybeError AddReshape(const op::Reshape* reshape) override;
+        virtual MaybeError AddResample2d(const op::Resample2d* resample2d) override;
         virtual MaybeError AddUnary(const op::Unary* unary) override;
         virtual MaybeError Finish() override;
 
+        // The size of the arena holding the intermediate memories, which is the peak memory
+        // of the intermediate tensors and working buffers during compute.
+        size_t GetPeakMemoryBytes() const;
+        // The total size of the intermediate memories if each had its own buffer.
+        size_t GetIntermediateMemoryBytes() const;
+
       private:
         MaybeError CompileImpl() override;
         MaybeError ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) override;
 
+        // Returns the memory of the operand consumed by an op, the uses are counted for fusion.
+        Ref<Memory> GetMemory(const OperandBase* operand);
+        // The memory is reordered once for all consumers which need the other layout. The
+        // blocked layout is kept through the ops which support it, so the reorders mostly
+        // happen at the graph boundaries.
+        ResultOrError<Ref<Memory>> ReorderToNchw(const OperandBase* operand, Ref<Memory> memory);
+        ResultOrError<Ref<Memory>> ReorderToNchwc(const OperandBase* operand, Ref<Memory> memory);
+        // The intermediate memory isn't allocated, it's placed in the arena by PlanMemory.
+        MaybeError AddIntermediateMemory(const Ref<Memory>& memory);
+        // Assigns the offsets of the intermediate memories in the arena by their lifetimes over
+        // the kernels, the memories which are never alive at the same time share the space.
+        MaybeError PlanMemory();
+        // The add of conv2d and another operand which may be fused as the sum of conv2d.
+        struct Conv2dSumFusion {
+            const OperandBase* a;
+            const OperandBase* b;
+            Ref<Memory> aMemory;
+            Ref<Memory> bMemory;
+            Ref<Kernel> kernel;
+            Ref<Memory> output;
+        };
+        // Returns the conv2d producing the operand if it can accumulate into the addend.
+        Ref<Conv2d> GetConv2dForSum(const Conv2dSumFusion& fusion,
+                                    const OperandBase* conv2dOperand,
+                                    const Ref<Memory>& addendMemory);
+        // Returns true if the add is fused as the sum of conv2d.
+        bool FuseConv2dSum(const Conv2dSumFusion& fusion);
+        MaybeError AddMatMul(const op::Binary* matMul);
+        MaybeError AddGemmKernel(const OperatorBase* op,
+                                 const OperandBase* a,
+                                 const OperandBase* b,
+                                 const Ref<Memory>& cMemory,
+                                 bool aTranspose,
+                                 bool bTranspose,
+                                 size_t m,
+                                 size_t n,
+                                 size_t k,
+                                 float alpha,
+                                 float beta,
+                                 const std::vector<size_t>& aBatchIndices,
+                                 const std::vector<size_t>& bBatchIndices);
+
         std::unordered_map<std::string, Ref<Memory>> mInputs;
         std::unordered_map<std::string, Ref<Memory>> mOutputs;
         std::unordered_map<const OperandBase*, Ref<Memory>> mMemoryMap;
+        std::unordered_map<const OperandBase*, Ref<Memory>> mNchwMemoryMap;
+        std::unordered_map<const OperandBase*, Ref<Memory>> mNchwcMemoryMap;
         std::unordered_map<const OperatorBase*, Ref<Conv2d>> mConv2dKernels;
+        std::unordered_map<const OperatorBase*, Ref<Gemm>> mGemmKernels;
+        std::unordered_set<const OperandBase*> mConstants;
+        std::unordered_map<const OperandBase*, size_t> mOperandUses;
         std::vector<Ref<Kernel>> mKernels;
+        std::vector<Ref<Memory>> mIntermediateMemories;
+        Ref<Memory> mArena;
+        size_t mPeakMemoryBytes = 0;
+        size_t mIntermediateMemoryBytes = 0;
+
+        // The activation kernel which may be fused into the gemm producing its input.
+        struct ActivationFusion {
+            const OperandBase* input;
+            Ref<Kernel> kernel;
+            Ref<Memory> output;
+            MLAS_ACTIVATION activation;
+        };
+        std::vector<ActivationFusion> mActivationFusions;
+        std::vector<Conv2dSumFusion> mConv2dSumFusions;
     };
 
 }  // namespace webnn::native::mlas
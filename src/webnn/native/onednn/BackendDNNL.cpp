@@ -29,7 +29,7 @@ namespace webnn::native::onednn {
     }
 
     ContextBase* Backend::CreateContext(ContextOptions const* options) {
-        Ref<ContextBase> context = AcquireRef(new Context());
+        Ref<ContextBase> context = AcquireRef(new Context(options));
         dnnl_status_t status = reinterpret_cast<Context*>(context.Get())->CreateEngine();
         if (status != dnnl_success) {
             dawn::ErrorLog() << "Failed to create oneDNN engine.";
@@ -14,15 +14,26 @@
 
 #include "webnn/native/onednn/ContextDNNL.h"
 
+#include "common/Log.h"
 #include "common/RefCounted.h"
 #include "webnn/native/onednn/GraphDNNL.h"
 
 namespace webnn::native::onednn {
 
-    Context::Context() : mEngine(nullptr) {
+    Context::Context(ContextOptions const* options) : ContextBase(options), mEngine(nullptr) {
+        // The capacity 0 of the options selects the default capacity.
+        const uint32_t capacity = GetContextOptions().primitiveCacheCapacity;
+        mPrimitiveCache.SetCapacity(capacity != 0 ? capacity : PrimitiveCache::kDefaultCapacity);
     }
 
     Context::~Context() {
+        const uint64_t hits = mPrimitiveCache.GetHitCount();
+        const uint64_t misses = mPrimitiveCache.GetMissCount();
+        if (hits + misses != 0) {
+            dawn::InfoLog() << "oneDNN primitive cache: " << hits << " hits, " << misses
+                            << " misses, hit rate " << 100.0 * hits / (hits + misses) << "%.";
+        }
+        mPrimitiveCache.Clear();
         if (mEngine != nullptr) {
             dnnl_engine_destroy(mEngine);
         }
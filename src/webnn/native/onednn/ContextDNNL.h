@@ -16,6 +16,7 @@
 #define WEBNN_NATIVE_ONEDNN_CONTEXT_DNNL_H_
 
 #include "webnn/native/Context.h"
+#include "webnn/native/onednn/PrimitiveCacheDNNL.h"
 
 #include <dnnl.h>
 
@@ -23,7 +24,7 @@ namespace webnn::native::onednn {
 
     class Context : public ContextBase {
       public:
-        Context();
+        explicit Context(ContextOptions const* options = nullptr);
         ~Context() override;
 
         dnnl_status_t CreateEngine(dnnl_engine_kind_t engineKind = dnnl_cpu);
@@ -32,10 +33,15 @@ namespace webnn::native::onednn {
             return mEngine;
         }
 
+        PrimitiveCache& GetPrimitiveCache() {
+            return mPrimitiveCache;
+        }
+
       private:
         GraphBase* CreateGraphImpl() override;
 
         dnnl_engine_t mEngine;
+        PrimitiveCache mPrimitiveCache;
     };
 
 }  // namespace webnn::native::onednn
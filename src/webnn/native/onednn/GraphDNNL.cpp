@@ -85,6 +85,10 @@ namespace webnn::native::onednn {
                 dnnlDataType = dnnl_f16;
             } else if (operandType == wnn::OperandType::Int32) {
                 dnnlDataType = dnnl_s32;
+            } else if (operandType == wnn::OperandType::Int8) {
+                dnnlDataType = dnnl_s8;
+            } else if (operandType == wnn::OperandType::Uint8) {
+                dnnlDataType = dnnl_u8;
             } else {
                 return dnnl_invalid_arguments;
             }
@@ -134,6 +138,23 @@ namespace webnn::native::onednn {
             }
         }
 
+        bool IsQuantizedType(wnn::OperandType operandType) {
+            return operandType == wnn::OperandType::Int8 || operandType == wnn::OperandType::Uint8;
+        }
+
+        // The output channel axis of the filter which per-channel scales are applied to.
+        int32_t GetFilterOutputChannelAxis(wnn::Conv2dFilterOperandLayout layout) {
+            switch (layout) {
+                case wnn::Conv2dFilterOperandLayout::Hwio:
+                case wnn::Conv2dFilterOperandLayout::Ihwo:
+                    return 3;
+                case wnn::Conv2dFilterOperandLayout::Oihw:
+                case wnn::Conv2dFilterOperandLayout::Ohwi:
+                default:
+                    return 0;
+            }
+        }
+
         enum AccessMode { READ, WRITE };
 
         dnnl_status_t AccessMemory(void* buffer,
@@ -277,9 +298,6 @@ namespace webnn::native::onednn {
         for (auto memory : mMemories) {
             dnnl_memory_destroy(memory);
         }
-        for (auto op : mOperations) {
-            dnnl_primitive_destroy(op.primitive);
-        }
     }
 
     MaybeError Graph::AddConstant(const op::Constant* constant) {
@@ -308,58 +326,78 @@ namespace webnn::native::onednn {
             dawn::ErrorLog() << "No operators to build.";
             return dnnl_invalid_arguments;
         }
-        auto& info = mOperandsToBuild[0];
-        if (mOperandsToBuild.size() == 1) {
+        // Count the consumers of every operand, an intermediate operand can only be fused away
+        // if the fused op is its single consumer.
+        std::map<const OperandBase*, size_t> consumers;
+        for (auto& info : mOperandsToBuild) {
+            for (auto& input : info.op->Inputs()) {
+                consumers[input.Get()]++;
+            }
+        }
+        for (auto& [_, output] : mOutputOperands) {
+            consumers[output]++;
+        }
+        for (size_t i = 0; i < mOperandsToBuild.size(); ++i) {
+            auto& info = mOperandsToBuild[i];
             if (info.opType == OperatorType::UNARY) {
                 DNNL_TRY(AddUnaryImpl(reinterpret_cast<const op::Unary*>(info.op)));
             } else if (info.opType == OperatorType::CLAMP) {
                 DNNL_TRY(AddClampImpl(reinterpret_cast<const op::Clamp*>(info.op)));
             } else if (info.opType == OperatorType::BINARY) {
                 DNNL_TRY(AddBinaryImpl(reinterpret_cast<const op::Binary*>(info.op)));
-            } else if (info.opType == OperatorType::CONV2D) {
-                DNNL_TRY(AddConv2dImpl(reinterpret_cast<const op::Conv2d*>(info.op)));
+            } else if (info.opType == OperatorType::GEMM) {
+                DNNL_TRY(AddGemmImpl(reinterpret_cast<const op::Gemm*>(info.op)));
             } else if (info.opType == OperatorType::POOL2D) {
                 DNNL_TRY(AddPool2dImpl(reinterpret_cast<const op::Pool2d*>(info.op)));
+            } else if (info.opType == OperatorType::CONV2D) {
+                // Try to fuse the following add and clamp into conv2d.
+                const op::Conv2d* conv2d = reinterpret_cast<const op::Conv2d*>(info.op);
+                const OperandBase* output = conv2d->PrimaryOutput();
+                const op::Binary* add = nullptr;
+                const op::Clamp* clamp = nullptr;
+                if (i + 1 < mOperandsToBuild.size() &&
+                    mOperandsToBuild[i + 1].opType == OperatorType::BINARY &&
+                    consumers[output] == 1 && conv2d->Inputs().size() == 2 &&
+                    conv2d->GetOptions()->inputLayout == wnn::InputOperandLayout::Nhwc) {
+                    // Only an add of a 1-D tensor broadcasted along the channels is a bias.
+                    auto binary = reinterpret_cast<const op::Binary*>(mOperandsToBuild[i + 1].op);
+                    const OperandBase* a = binary->Inputs()[0].Get();
+                    const OperandBase* b = binary->Inputs()[1].Get();
+                    const OperandBase* bias = a == output ? b : b == output ? a : nullptr;
+                    if (binary->GetType() == op::BinaryOpType::kAdd && bias != nullptr &&
+                        bias->Shape().size() == 1 && bias->Shape()[0] == output->Shape()[3]) {
+                        add = binary;
+                        output = add->PrimaryOutput();
+                        ++i;
+                    }
+                }
+                if (i + 1 < mOperandsToBuild.size() &&
+                    mOperandsToBuild[i + 1].opType == OperatorType::CLAMP &&
+                    consumers[output] == 1 &&
+                    mOperandsToBuild[i + 1].op->Inputs()[0].Get() == output) {
+                    clamp = reinterpret_cast<const op::Clamp*>(mOperandsToBuild[i + 1].op);
+                    ++i;
+                }
+                DNNL_TRY(AddConv2dImpl(conv2d, add, clamp));
             } else {
                 return dnnl_unimplemented;
             }
-        } else if (info.opType == OperatorType::CONV2D) {
-            // Try to fuse add and clamp into conv2d
-            const op::Conv2d* conv2d = reinterpret_cast<const op::Conv2d*>(info.op);
-            if (mOperandsToBuild.size() > 3) {
-                dawn::ErrorLog() << "Cannot fuse conv2d subgraph with more than 3 ops.";
-                return dnnl_invalid_arguments;
-            }
-            const op::Binary* add = nullptr;
-            const op::FusionClamp* clamp = nullptr;
-            for (size_t i = 1; i < mOperandsToBuild.size(); ++i) {
-                auto& postOp = mOperandsToBuild[i];
-                if (postOp.opType == OperatorType::BINARY &&
-                    reinterpret_cast<const op::Binary*>(postOp.op)->GetType() ==
-                        op::BinaryOpType::kAdd) {
-                    add = reinterpret_cast<const op::Binary*>(postOp.op);
-                } else if (postOp.opType == OperatorType::CLAMP) {
-                    clamp = reinterpret_cast<const op::FusionClamp*>(postOp.op);
-                }
-            }
-            if ((mOperandsToBuild.size() == 2 && !add && !clamp) ||
-                (mOperandsToBuild.size() == 3 && (!add || !clamp))) {
-                dawn::ErrorLog() << "Failed to fuse conv2d subgraph.";
-                return dnnl_invalid_arguments;
-            }
-            DNNL_TRY(AddConv2dImpl(conv2d, add, clamp));
-        } else {
-            return dnnl_unimplemented;
+        }
+        return dnnl_success;
+    }
+
+    dnnl_status_t Graph::BuildOutputs() {
+        for (auto& [name, output] : mOutputOperands) {
+            DAWN_ASSERT(mOperandMemoryMap.find(output) != mOperandMemoryMap.end());
+            dnnl_memory_t plainOutputMemory;
+            DNNL_TRY(ReorderToPlainFormat(mOperandMemoryMap.at(output), &plainOutputMemory));
+            mOutputMemoryMap.insert(std::make_pair(name, plainOutputMemory));
         }
         return dnnl_success;
     }
 
     MaybeError Graph::AddOutput(std::string_view name, const OperandBase* output) {
-        DAWN_TRY(BuildPrimitives());
-        DAWN_ASSERT(mOperandMemoryMap.find(output) != mOperandMemoryMap.end());
-        dnnl_memory_t plainOutputMemory;
-        DAWN_TRY(ReorderToPlainFormat(mOperandMemoryMap.at(output), &plainOutputMemory));
-        mOutputMemoryMap.insert(std::make_pair(name.data(), plainOutputMemory));
+        mOutputOperands.push_back(std::make_pair(std::string(name), output));
         return {};
     }
 
@@ -455,7 +493,8 @@ namespace webnn::native::onednn {
         dnnl_memory_desc_t cInitDesc;
         DNNL_TRY(dnnl_memory_desc_init_by_tag(&cInitDesc, cDims.size(), cDims.data(),
                                               aMemoryDesc->data_type, dnnl_format_tag_any));
-        dnnl_primitive_desc_t primitiveDesc;
+        const_dnnl_primitive_desc_t primitiveDesc;
+        dnnl_primitive_t primitive;
         dnnl_data_type_t dataType = aMemoryDesc->data_type;
         if (binary->GetType() == op::BinaryOpType::kMatMul) {
             dnnl_memory_desc_t aInitDesc;
@@ -466,8 +505,7 @@ namespace webnn::native::onednn {
                                                   dnnl_format_tag_any));
             dnnl_matmul_desc_t matmulDesc;
             DNNL_TRY(dnnl_matmul_desc_init(&matmulDesc, &aInitDesc, &bInitDesc, NULL, &cInitDesc));
-            DNNL_TRY(
-                dnnl_primitive_desc_create(&primitiveDesc, &matmulDesc, NULL, GetEngine(), NULL));
+            DNNL_TRY(CreatePrimitive(&matmulDesc, NULL, &primitiveDesc, &primitive));
             const dnnl_memory_desc_t* input0InternalMemoryDesc =
                 dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_src_md, 0);
             DNNL_TRY(ReorderIfNeeded(aMemoryDesc, aMemory, input0InternalMemoryDesc, &aMemory));
@@ -486,16 +524,12 @@ namespace webnn::native::onednn {
             dnnl_binary_desc_t binaryDesc;
             DNNL_TRY(
                 dnnl_binary_desc_init(&binaryDesc, algKind, aMemoryDesc, bMemoryDesc, &cInitDesc));
-            DNNL_TRY(
-                dnnl_primitive_desc_create(&primitiveDesc, &binaryDesc, NULL, GetEngine(), NULL));
+            DNNL_TRY(CreatePrimitive(&binaryDesc, NULL, &primitiveDesc, &primitive));
         }
         dnnl_memory_t cMemory;
-        dnnl_primitive_t primitive;
         const dnnl_memory_desc_t* cMemoryDesc =
             dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
         DNNL_TRY(dnnl_memory_create(&cMemory, cMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
-        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
-        DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
         std::vector<dnnl_exec_arg_t> args;
         if (binary->GetType() == op::BinaryOpType::kMatMul) {
             args = {{DNNL_ARG_SRC, aMemory}, {DNNL_ARG_WEIGHTS, bMemory}, {DNNL_ARG_DST, cMemory}};
@@ -523,7 +557,7 @@ namespace webnn::native::onednn {
 
     dnnl_status_t Graph::AddConv2dImpl(const op::Conv2d* conv2d,
                                        const op::Binary* add,
-                                       const op::FusionClamp* clamp) {
+                                       const op::ClampBase* clamp) {
         DAWN_ASSERT(conv2d->Inputs().size() == 2 || conv2d->Inputs().size() == 3);
         const OperandBase* inputOperand = conv2d->Inputs()[0].Get();
         DAWN_ASSERT(mOperandMemoryMap.find(inputOperand) != mOperandMemoryMap.end());
@@ -554,6 +588,11 @@ namespace webnn::native::onednn {
         const OperandBase* filterOperand = conv2d->Inputs()[1].Get();
         DAWN_ASSERT(mOperandMemoryMap.find(filterOperand) != mOperandMemoryMap.end());
         dnnl_memory_t filterMemory = mOperandMemoryMap.at(filterOperand);
+        const bool quantized = IsQuantizedType(inputOperand->Type());
+        if (!quantized && IsQuantizedType(filterOperand->Type())) {
+            // Weight-only quantization, compute with the dequantized float32 filter.
+            DNNL_TRY(DequantizeConstant(filterOperand, &filterMemory));
+        }
         const dnnl_memory_desc_t* filterMemoryDesc;
         DNNL_TRY(GetMemoryDesc(filterMemory, &filterMemoryDesc));
         std::vector<dnnl_dim_t> filterDims;
@@ -630,19 +669,26 @@ namespace webnn::native::onednn {
             actualFilterMemoryDesc = &newFilterMemoryDesc;
         }
 
-        dnnl_data_type_t dataType = actualInputMemoryDesc->data_type;
+        // The output of the fused subgraph, which decides the destination data type.
+        const OperandBase* output =
+            add ? reinterpret_cast<const OperandBase*>(add->PrimaryOutput())
+                : reinterpret_cast<const OperandBase*>(conv2d->PrimaryOutput());
+        dnnl_data_type_t dataType;
+        DNNL_TRY(GetDnnlDataType(output->Type(), dataType));
+        dnnl_data_type_t inputType = actualInputMemoryDesc->data_type;
+        dnnl_data_type_t filterType = actualFilterMemoryDesc->data_type;
         dnnl_memory_desc_t inputInitDesc;
         DNNL_TRY(dnnl_memory_desc_init_by_tag(&inputInitDesc, inputDims.size(), inputDims.data(),
-                                              dataType, dnnl_format_tag_any));
+                                              inputType, dnnl_format_tag_any));
 
         dnnl_memory_desc_t filterInitDesc;
         if (options->groups == 1) {
             DNNL_TRY(dnnl_memory_desc_init_by_tag(&filterInitDesc, filterDims.size(),
-                                                  filterDims.data(), dataType,
+                                                  filterDims.data(), filterType,
                                                   dnnl_format_tag_any));
         } else {
             DNNL_TRY(dnnl_memory_desc_init_by_tag(&filterInitDesc, groupFilterDims.size(),
-                                                  groupFilterDims.data(), dataType,
+                                                  groupFilterDims.data(), filterType,
                                                   dnnl_format_tag_any));
         }
         std::vector<dnnl_dim_t> strides = {options->strides[0], options->strides[1]};
@@ -683,12 +729,12 @@ namespace webnn::native::onednn {
         DNNL_TRY(dnnl_memory_desc_init_by_tag(&outputInitDesc, outputDims.size(), outputDims.data(),
                                               dataType, dnnl_format_tag_any));
 
-        // dnnl_memory_desc_t biasInitDesc;
-        dnnl_memory_t biasMemory = nullptr;
-        const dnnl_memory_desc_t* biasMemoryDesc;
-        if (add) {
+        // The bias is either the option of conv2d or the other input of the fused add.
+        const OperandBase* biasOperand = nullptr;
+        if (conv2d->Inputs().size() == 3) {
+            biasOperand = conv2d->Inputs()[2].Get();
+        } else if (add) {
             DAWN_ASSERT(add->Inputs().size() == 2);
-            OperandBase* biasOperand = nullptr;
             if (conv2d->PrimaryOutput() == add->Inputs()[0].Get()) {
                 biasOperand = add->Inputs()[1].Get();
             } else if (conv2d->PrimaryOutput() == add->Inputs()[1].Get()) {
@@ -697,38 +743,72 @@ namespace webnn::native::onednn {
                 dawn::ErrorLog() << "The add is not fusable.";
                 return dnnl_invalid_arguments;
             }
-
+        }
+        dnnl_memory_t biasMemory = nullptr;
+        const dnnl_memory_desc_t* biasMemoryDesc = nullptr;
+        if (biasOperand) {
+            if (quantized && biasOperand->Type() != wnn::OperandType::Int32) {
+                dawn::ErrorLog() << "The bias of quantized conv2d must be an int32 tensor.";
+                return dnnl_invalid_arguments;
+            }
             DAWN_ASSERT(mOperandMemoryMap.find(biasOperand) != mOperandMemoryMap.end());
             biasMemory = mOperandMemoryMap.at(biasOperand);
             DNNL_TRY(GetMemoryDesc(biasMemory, &biasMemoryDesc));
         }
 
-        dnnl_primitive_attr_t attr = nullptr;
+        dnnl_primitive_attr_t attr;
+        DNNL_TRY(dnnl_primitive_attr_create(&attr));
+        float outputScale = 1.0f;
+        if (quantized) {
+            DNNL_TRY(SetQuantizationAttributes(
+                attr, inputOperand, filterOperand, output,
+                GetFilterOutputChannelAxis(options->filterLayout), outputScale));
+        }
+        // The fused activation is applied to the scaled accumulator before the destination
+        // zero point is added, so the clamp bounds are divided by the output scale.
         dnnl_post_ops_t postops = nullptr;
-        if (clamp) {
-            float outputMin = -std::numeric_limits<float>::infinity();
-            float outputMax = +std::numeric_limits<float>::infinity();
-            outputMin = clamp->GetMinValue();
-            outputMax = clamp->GetMaxValue();
+        if (options->activation || clamp) {
             DNNL_TRY(dnnl_post_ops_create(&postops));
-            DNNL_TRY(dnnl_post_ops_append_eltwise(postops, 1.0, dnnl_eltwise_clip, outputMin,
-                                                  outputMax));
-            DNNL_TRY(dnnl_primitive_attr_create(&attr));
+            if (options->activation) {
+                switch (options->activation->GetFusionType()) {
+                    case FusionType::Clamp: {
+                        auto fusionClamp =
+                            reinterpret_cast<const op::FusionClamp*>(options->activation);
+                        DNNL_TRY(dnnl_post_ops_append_eltwise(
+                            postops, 1.0, dnnl_eltwise_clip,
+                            fusionClamp->GetMinValue() / outputScale,
+                            fusionClamp->GetMaxValue() / outputScale));
+                        break;
+                    }
+                    case FusionType::Relu:
+                        DNNL_TRY(
+                            dnnl_post_ops_append_eltwise(postops, 1.0, dnnl_eltwise_relu, 0, 0));
+                        break;
+                    default:
+                        dawn::ErrorLog() << "oneDNN backend doesn't support fused operator "
+                                         << static_cast<int>(
+                                                options->activation->GetFusionType());
+                        return dnnl_unimplemented;
+                }
+            }
+            if (clamp) {
+                DNNL_TRY(dnnl_post_ops_append_eltwise(postops, 1.0, dnnl_eltwise_clip,
+                                                      clamp->GetMinValue() / outputScale,
+                                                      clamp->GetMaxValue() / outputScale));
+            }
             DNNL_TRY(dnnl_primitive_attr_set_post_ops(attr, postops));
         }
 
         dnnl_convolution_desc_t convDesc;
         DNNL_TRY(dnnl_dilated_convolution_forward_desc_init(
-            &convDesc, dnnl_forward, dnnl_convolution_direct, &inputInitDesc, &filterInitDesc,
-            add ? biasMemoryDesc : NULL, &outputInitDesc, strides.data(), dilates.data(),
-            padding_l.data(), padding_r.data()));
-        dnnl_primitive_desc_t primitiveDesc;
-        DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &convDesc, clamp ? attr : NULL,
-                                            GetEngine(), NULL));
+            &convDesc, quantized ? dnnl_forward_inference : dnnl_forward, dnnl_convolution_direct,
+            &inputInitDesc, &filterInitDesc, biasMemoryDesc, &outputInitDesc, strides.data(),
+            dilates.data(), padding_l.data(), padding_r.data()));
+        const_dnnl_primitive_desc_t primitiveDesc;
+        dnnl_primitive_t primitive;
+        DNNL_TRY(CreatePrimitive(&convDesc, attr, &primitiveDesc, &primitive));
 
-        if (attr) {
-            DNNL_TRY(dnnl_primitive_attr_destroy(attr));
-        }
+        DNNL_TRY(dnnl_primitive_attr_destroy(attr));
         if (postops) {
             DNNL_TRY(dnnl_post_ops_destroy(postops));
         }
@@ -749,23 +829,15 @@ namespace webnn::native::onednn {
         dnnl_memory_t outputMemory;
         DNNL_TRY(
             dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
-
-        dnnl_primitive_t primitive;
-        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
-        DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
         std::vector<dnnl_exec_arg_t> args = {{DNNL_ARG_SRC, inputInternalMemory},
                                              {DNNL_ARG_WEIGHTS, filterInternalMemory},
                                              {DNNL_ARG_DST, outputMemory}};
-        if (add) {
+        if (biasMemory) {
             args.push_back({DNNL_ARG_BIAS, biasMemory});
         }
         mOperations.push_back({primitive, args});
         mMemories.push_back(outputMemory);
 
-        const OperandBase* output =
-            add ? reinterpret_cast<const OperandBase*>(add->PrimaryOutput())
-                : reinterpret_cast<const OperandBase*>(conv2d->PrimaryOutput());
-
         if (options->inputLayout == wnn::InputOperandLayout::Nhwc) {
             // reorder the output from primitive query layout to nhwc
             dnnl_memory_desc_t finalOutputMemoryDesc;
@@ -853,22 +925,36 @@ namespace webnn::native::onednn {
         } else {
             return dnnl_invalid_arguments;
         }
+        // The quantized pooling computes in the quantized domain of its input, so the output
+        // shares the quantization params of the input.
+        const bool quantized = IsQuantizedType(inputOperand->Type());
+        if (quantized) {
+            const OperandBase* quantizedInput = GetQuantizedOperand(inputOperand);
+            const OperandBase* output = pool2d->PrimaryOutput();
+            if (!output->IsQuantized()) {
+                mQuantizationAliases.insert(std::make_pair(output, quantizedInput));
+            } else if (output->Scales() != quantizedInput->Scales() ||
+                       output->ZeroPoints() != quantizedInput->ZeroPoints()) {
+                dawn::ErrorLog() << "The quantized pool2d cannot requantize its output.";
+                return dnnl_unimplemented;
+            }
+        }
         dnnl_pooling_v2_desc_t poolDesc;
         DNNL_TRY(dnnl_pooling_v2_forward_desc_init(
-            &poolDesc, dnnl_forward, poolType, inputMemoryDesc, &outputInitDesc, strides.data(),
-            kernel.data(), dilates.data(), padding_l.data(), padding_r.data()));
-        dnnl_primitive_desc_t primitiveDesc;
-        DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &poolDesc, NULL, GetEngine(), NULL));
+            &poolDesc, quantized ? dnnl_forward_inference : dnnl_forward, poolType,
+            inputMemoryDesc, &outputInitDesc, strides.data(), kernel.data(), dilates.data(),
+            padding_l.data(), padding_r.data()));
+        const_dnnl_primitive_desc_t primitiveDesc;
+        dnnl_primitive_t primitive;
+        DNNL_TRY(CreatePrimitive(&poolDesc, NULL, &primitiveDesc, &primitive));
         const dnnl_memory_desc_t* outputMemoryDesc =
             dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
         dnnl_memory_t outputMemory;
         DNNL_TRY(
             dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
-        dnnl_primitive_t primitive;
-        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
         std::vector<dnnl_exec_arg_t> args = {{DNNL_ARG_SRC, inputMemory},
                                              {DNNL_ARG_DST, outputMemory}};
-        if (poolType == dnnl_pooling_max) {
+        if (poolType == dnnl_pooling_max && !quantized) {
             const dnnl_memory_desc_t* workspaceMemoryDesc =
                 dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_workspace_md, 0);
             dnnl_memory_t workspaceMemory;
@@ -877,7 +963,6 @@ namespace webnn::native::onednn {
             args.push_back({DNNL_ARG_WORKSPACE, workspaceMemory});
             mMemories.push_back(workspaceMemory);
         }
-        DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
         mOperations.push_back({primitive, args});
         mMemories.push_back(outputMemory);
         mOperandMemoryMap.insert(std::make_pair(pool2d->PrimaryOutput(), outputMemory));
@@ -896,21 +981,19 @@ namespace webnn::native::onednn {
         dnnl_memory_t inputMemory = mOperandMemoryMap.at(inputOperand);
         const dnnl_memory_desc_t* inputMemoryDesc;
         DNNL_TRY(GetMemoryDesc(inputMemory, &inputMemoryDesc));
-        dnnl_primitive_desc_t primitiveDesc;
+        const_dnnl_primitive_desc_t primitiveDesc;
         dnnl_primitive_t primitive;
         dnnl_memory_t outputMemory;
         if (unary->GetType() == op::UnaryOpType::kRelu) {
             dnnl_eltwise_desc_t eltWiseDesc;
             DNNL_TRY(dnnl_eltwise_forward_desc_init(&eltWiseDesc, dnnl_forward, dnnl_eltwise_relu,
                                                     inputMemoryDesc, 0, 0));
-            DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &eltWiseDesc, nullptr, GetEngine(),
-                                                nullptr));
+            DNNL_TRY(CreatePrimitive(&eltWiseDesc, nullptr, &primitiveDesc, &primitive));
         } else if (unary->GetType() == op::UnaryOpType::kSoftmax) {
             dnnl_softmax_desc_t softmaxDesc;
             DNNL_TRY(
                 dnnl_softmax_forward_desc_init(&softmaxDesc, dnnl_forward, inputMemoryDesc, 1));
-            DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &softmaxDesc, nullptr, GetEngine(),
-                                                nullptr));
+            DNNL_TRY(CreatePrimitive(&softmaxDesc, nullptr, &primitiveDesc, &primitive));
         } else {
             return dnnl_unimplemented;
         }
@@ -918,8 +1001,6 @@ namespace webnn::native::onednn {
             dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
         DNNL_TRY(
             dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
-        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
-        DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
         mOperations.push_back(
             {primitive, {{DNNL_ARG_SRC, inputMemory}, {DNNL_ARG_DST, outputMemory}}});
         mMemories.push_back(outputMemory);
@@ -942,21 +1023,18 @@ namespace webnn::native::onednn {
         DNNL_TRY(GetMemoryDesc(inputMemory, &inputMemoryDesc));
         std::vector<dnnl_dim_t> inputDims(inputMemoryDesc->dims,
                                           inputMemoryDesc->dims + inputMemoryDesc->ndims);
-        dnnl_primitive_desc_t primitiveDesc;
+        const_dnnl_primitive_desc_t primitiveDesc;
         dnnl_primitive_t primitive;
         dnnl_memory_t outputMemory;
         dnnl_eltwise_desc_t eltWiseDesc;
         DNNL_TRY(dnnl_eltwise_forward_desc_init(&eltWiseDesc, dnnl_forward, dnnl_eltwise_clip,
                                                 inputMemoryDesc, clamp->GetMinValue(),
                                                 clamp->GetMaxValue()));
-        DNNL_TRY(dnnl_primitive_desc_create(&primitiveDesc, &eltWiseDesc, nullptr, GetEngine(),
-                                            nullptr));
+        DNNL_TRY(CreatePrimitive(&eltWiseDesc, nullptr, &primitiveDesc, &primitive));
         const dnnl_memory_desc_t* outputMemoryDesc =
             dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
         DNNL_TRY(
             dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
-        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
-        DNNL_TRY(dnnl_primitive_desc_destroy(primitiveDesc));
         mOperations.push_back(
             {primitive, {{DNNL_ARG_SRC, inputMemory}, {DNNL_ARG_DST, outputMemory}}});
         mMemories.push_back(outputMemory);
@@ -964,7 +1042,245 @@ namespace webnn::native::onednn {
         return dnnl_success;
     }
 
+    MaybeError Graph::AddGemm(const op::Gemm* gemm) {
+        mOperandsToBuild.push_back({OperatorType::GEMM, gemm});
+        return {};
+    }
+
+    dnnl_status_t Graph::AddGemmImpl(const op::Gemm* gemm) {
+        auto inputs = gemm->Inputs();
+        DAWN_ASSERT(inputs.size() == 2 || inputs.size() == 3);
+        const OperandBase* aOperand = inputs[0].Get();
+        DAWN_ASSERT(mOperandMemoryMap.find(aOperand) != mOperandMemoryMap.end());
+        dnnl_memory_t aMemory = mOperandMemoryMap.at(aOperand);
+        const OperandBase* bOperand = inputs[1].Get();
+        DAWN_ASSERT(mOperandMemoryMap.find(bOperand) != mOperandMemoryMap.end());
+        dnnl_memory_t bMemory = mOperandMemoryMap.at(bOperand);
+        const bool quantized = IsQuantizedType(aOperand->Type());
+        if (!quantized && IsQuantizedType(bOperand->Type())) {
+            // Weight-only quantization, compute with the dequantized float32 weights.
+            DNNL_TRY(DequantizeConstant(bOperand, &bMemory));
+        }
+        const dnnl_memory_desc_t* aMemoryDesc;
+        DNNL_TRY(GetMemoryDesc(aMemory, &aMemoryDesc));
+        const dnnl_memory_desc_t* bMemoryDesc;
+        DNNL_TRY(GetMemoryDesc(bMemory, &bMemoryDesc));
+
+        // The logical dimensions are always {M, K} for a and {K, N} for b, the transposed inputs
+        // are described by permuting the axes of their memory.
+        const GemmOptions* options = gemm->GetOptions();
+        const int permute[] = {1, 0};
+        dnnl_memory_desc_t aTransposedMemoryDesc;
+        if (options->aTranspose) {
+            DNNL_TRY(dnnl_memory_desc_permute_axes(&aTransposedMemoryDesc, aMemoryDesc, permute));
+            aMemoryDesc = &aTransposedMemoryDesc;
+        }
+        dnnl_memory_desc_t bTransposedMemoryDesc;
+        if (options->bTranspose) {
+            DNNL_TRY(dnnl_memory_desc_permute_axes(&bTransposedMemoryDesc, bMemoryDesc, permute));
+            bMemoryDesc = &bTransposedMemoryDesc;
+        }
+        std::vector<dnnl_dim_t> aDims = {aMemoryDesc->dims[0], aMemoryDesc->dims[1]};
+        std::vector<dnnl_dim_t> bDims = {bMemoryDesc->dims[0], bMemoryDesc->dims[1]};
+        std::vector<dnnl_dim_t> outputDims = {aDims[0], bDims[1]};
+        dnnl_data_type_t outputType;
+        DNNL_TRY(GetDnnlDataType(gemm->PrimaryOutput()->Type(), outputType));
+        dnnl_memory_desc_t aInitDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&aInitDesc, aDims.size(), aDims.data(),
+                                              aMemoryDesc->data_type, dnnl_format_tag_any));
+        dnnl_memory_desc_t bInitDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&bInitDesc, bDims.size(), bDims.data(),
+                                              bMemoryDesc->data_type, dnnl_format_tag_any));
+        dnnl_memory_desc_t outputInitDesc;
+        DNNL_TRY(dnnl_memory_desc_init_by_tag(&outputInitDesc, outputDims.size(),
+                                              outputDims.data(), outputType, dnnl_format_tag_any));
+
+        // The c is viewed as a 2-D tensor that is broadcastable to {M, N}.
+        const OperandBase* cOperand = inputs.size() == 3 ? inputs[2].Get() : nullptr;
+        dnnl_memory_t cMemory = nullptr;
+        dnnl_memory_desc_t cMemoryDesc;
+        if (cOperand != nullptr) {
+            if (options->beta != 1.0f) {
+                dawn::ErrorLog() << "oneDNN only supports gemm with beta equal to 1.";
+                return dnnl_unimplemented;
+            }
+            if (quantized && cOperand->Type() != wnn::OperandType::Int32) {
+                dawn::ErrorLog() << "The c of quantized gemm must be an int32 tensor.";
+                return dnnl_invalid_arguments;
+            }
+            DAWN_ASSERT(mOperandMemoryMap.find(cOperand) != mOperandMemoryMap.end());
+            cMemory = mOperandMemoryMap.at(cOperand);
+            const dnnl_memory_desc_t* desc;
+            DNNL_TRY(GetMemoryDesc(cMemory, &desc));
+            std::vector<dnnl_dim_t> cDims =
+                ExpandDimensions(std::vector<dnnl_dim_t>(desc->dims, desc->dims + desc->ndims), 2);
+            DNNL_TRY(dnnl_memory_desc_reshape(&cMemoryDesc, desc, cDims.size(), cDims.data()));
+        }
+
+        dnnl_primitive_attr_t attr;
+        DNNL_TRY(dnnl_primitive_attr_create(&attr));
+        dnnl_post_ops_t postops = nullptr;
+        if (quantized) {
+            // The weights are quantized per column, which is axis 0 of the transposed b.
+            float outputScale;
+            DNNL_TRY(SetQuantizationAttributes(attr, aOperand, bOperand, gemm->PrimaryOutput(),
+                                               options->bTranspose ? 0 : 1, outputScale,
+                                               options->alpha));
+        } else {
+            if (options->alpha != 1.0f) {
+                const float alpha = options->alpha;
+                DNNL_TRY(dnnl_primitive_attr_set_output_scales(attr, 1, 0, &alpha));
+            }
+            if (cOperand != nullptr) {
+                // The bias of matmul would be scaled by alpha, so c is added as a post op.
+                DNNL_TRY(dnnl_post_ops_create(&postops));
+                DNNL_TRY(dnnl_post_ops_append_binary(postops, dnnl_binary_add, &cMemoryDesc));
+                DNNL_TRY(dnnl_primitive_attr_set_post_ops(attr, postops));
+            }
+        }
+        // The int32 c of quantized gemm is in the accumulator domain, so it's the bias.
+        const bool cAsBias = quantized && cOperand != nullptr;
+        dnnl_matmul_desc_t matmulDesc;
+        DNNL_TRY(dnnl_matmul_desc_init(&matmulDesc, &aInitDesc, &bInitDesc,
+                                       cAsBias ? &cMemoryDesc : NULL, &outputInitDesc));
+        const_dnnl_primitive_desc_t primitiveDesc;
+        dnnl_primitive_t primitive;
+        DNNL_TRY(CreatePrimitive(&matmulDesc, attr, &primitiveDesc, &primitive));
+        DNNL_TRY(dnnl_primitive_attr_destroy(attr));
+        if (postops) {
+            DNNL_TRY(dnnl_post_ops_destroy(postops));
+        }
+
+        const dnnl_memory_desc_t* aInternalMemoryDesc =
+            dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_src_md, 0);
+        DNNL_TRY(ReorderIfNeeded(aMemoryDesc, aMemory, aInternalMemoryDesc, &aMemory));
+        const dnnl_memory_desc_t* bInternalMemoryDesc =
+            dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_weights_md, 0);
+        DNNL_TRY(ReorderIfNeeded(bMemoryDesc, bMemory, bInternalMemoryDesc, &bMemory));
+        const dnnl_memory_desc_t* outputMemoryDesc =
+            dnnl_primitive_desc_query_md(primitiveDesc, dnnl_query_dst_md, 0);
+        dnnl_memory_t outputMemory;
+        DNNL_TRY(
+            dnnl_memory_create(&outputMemory, outputMemoryDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
+        std::vector<dnnl_exec_arg_t> args = {{DNNL_ARG_SRC, aMemory},
+                                             {DNNL_ARG_WEIGHTS, bMemory},
+                                             {DNNL_ARG_DST, outputMemory}};
+        if (cAsBias) {
+            args.push_back({DNNL_ARG_BIAS, cMemory});
+        } else if (cOperand != nullptr) {
+            args.push_back({DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_SRC_1, cMemory});
+        }
+        mOperations.push_back({primitive, args});
+        mMemories.push_back(outputMemory);
+        mOperandMemoryMap.insert(std::make_pair(gemm->PrimaryOutput(), outputMemory));
+        return dnnl_success;
+    }
+
+    const OperandBase* Graph::GetQuantizedOperand(const OperandBase* operand) {
+        auto iter = mQuantizationAliases.find(operand);
+        return iter != mQuantizationAliases.end() ? iter->second : operand;
+    }
+
+    dnnl_status_t Graph::DequantizeConstant(const OperandBase* operand,
+                                            dnnl_memory_t* floatMemory) {
+        dnnl_memory_t memory = mOperandMemoryMap.at(operand);
+        if (!operand->IsQuantized() || mConstantMemories.find(memory) == mConstantMemories.end()) {
+            dawn::ErrorLog() << "Only the quantized constant can be dequantized.";
+            return dnnl_invalid_arguments;
+        }
+        void* data = nullptr;
+        DNNL_TRY(dnnl_memory_get_data_handle(memory, &data));
+        std::vector<int32_t> shape = operand->Shape();
+        const size_t size = std::accumulate(shape.begin(), shape.end(), (size_t)1,
+                                            std::multiplies<size_t>());
+        // The per-channel scales are indexed by the coordinate along the quantization axis.
+        size_t innerSize = 1, axisSize = 1;
+        if (operand->IsPerChannelQuantized()) {
+            const int32_t axis = operand->QuantizationAxis();
+            axisSize = shape[axis];
+            innerSize = std::accumulate(shape.begin() + axis + 1, shape.end(), (size_t)1,
+                                        std::multiplies<size_t>());
+        }
+        const std::vector<float>& scales = operand->Scales();
+        const std::vector<int32_t>& zeroPoints = operand->ZeroPoints();
+        std::vector<float> values(size);
+        for (size_t i = 0; i < size; ++i) {
+            const size_t channel = (i / innerSize) % axisSize;
+            const int32_t value = operand->Type() == wnn::OperandType::Int8
+                                      ? static_cast<int8_t*>(data)[i]
+                                      : static_cast<uint8_t*>(data)[i];
+            values[i] = scales[channel] * (value - zeroPoints[channel]);
+        }
+        OperandDescriptor desc = {wnn::OperandType::Float32, shape.data(),
+                                  static_cast<uint32_t>(shape.size())};
+        DNNL_TRY(CreateDnnlMemory(GetEngine(), &desc, floatMemory, values.data(),
+                                  values.size() * sizeof(float)));
+        mMemories.push_back(*floatMemory);
+        mConstantMemories.insert(*floatMemory);
+        return dnnl_success;
+    }
+
+    dnnl_status_t Graph::SetQuantizationAttributes(dnnl_primitive_attr_t attr,
+                                                   const OperandBase* input,
+                                                   const OperandBase* weights,
+                                                   const OperandBase* output,
+                                                   int32_t weightsChannelAxis,
+                                                   float& outputScale,
+                                                   float alpha) {
+        input = GetQuantizedOperand(input);
+        output = GetQuantizedOperand(output);
+        if (!input->IsQuantized() || !weights->IsQuantized() || !output->IsQuantized()) {
+            dawn::ErrorLog() << "The quantization params of input, weights and output are needed.";
+            return dnnl_invalid_arguments;
+        }
+        if (input->IsPerChannelQuantized() || output->IsPerChannelQuantized()) {
+            dawn::ErrorLog() << "oneDNN only supports per-tensor quantized activations.";
+            return dnnl_unimplemented;
+        }
+        if (weights->Type() != wnn::OperandType::Int8) {
+            dawn::ErrorLog() << "oneDNN only supports int8 quantized weights.";
+            return dnnl_unimplemented;
+        }
+        for (int32_t zeroPoint : weights->ZeroPoints()) {
+            if (zeroPoint != 0) {
+                dawn::ErrorLog() << "oneDNN only supports symmetric quantized weights.";
+                return dnnl_unimplemented;
+            }
+        }
+        if (weights->IsPerChannelQuantized() &&
+            weights->QuantizationAxis() != weightsChannelAxis) {
+            dawn::ErrorLog() << "The weights must be quantized per output channel.";
+            return dnnl_invalid_arguments;
+        }
+
+        // dst = output_scale * (src - src_zero_point) * weights + dst_zero_point, where
+        // output_scale = alpha * src_scale * weights_scale / dst_scale.
+        outputScale = output->Scales()[0];
+        const float inputScale = input->Scales()[0];
+        std::vector<float> scales;
+        scales.reserve(weights->Scales().size());
+        for (float weightsScale : weights->Scales()) {
+            scales.push_back(alpha * inputScale * weightsScale / outputScale);
+        }
+        // The mask selects the channel dimension of the output for per-channel scales.
+        const int mask = weights->IsPerChannelQuantized() ? 1 << 1 : 0;
+        DNNL_TRY(dnnl_primitive_attr_set_output_scales(attr, scales.size(), mask, scales.data()));
+        const int32_t inputZeroPoint = input->ZeroPoints()[0];
+        if (inputZeroPoint != 0) {
+            DNNL_TRY(
+                dnnl_primitive_attr_set_zero_points(attr, DNNL_ARG_SRC, 1, 0, &inputZeroPoint));
+        }
+        const int32_t outputZeroPoint = output->ZeroPoints()[0];
+        if (outputZeroPoint != 0) {
+            DNNL_TRY(
+                dnnl_primitive_attr_set_zero_points(attr, DNNL_ARG_DST, 1, 0, &outputZeroPoint));
+        }
+        return dnnl_success;
+    }
+
     MaybeError Graph::Finish() {
+        DAWN_TRY(BuildPrimitives());
+        DAWN_TRY(BuildOutputs());
         return {};
     }
 
@@ -1013,6 +1329,10 @@ namespace webnn::native::onednn {
         return reinterpret_cast<Context*>(GetContext())->GetEngine();
     }
 
+    PrimitiveCache& Graph::GetPrimitiveCache() {
+        return reinterpret_cast<Context*>(GetContext())->GetPrimitiveCache();
+    }
+
     dnnl_status_t Graph::GetMemoryDesc(dnnl_memory_t memory, const dnnl_memory_desc_t** desc) {
         if (mMemoryReinterprets.find(memory) != mMemoryReinterprets.end()) {
             *desc = &mMemoryReinterprets.at(memory);
@@ -1029,20 +1349,17 @@ namespace webnn::native::onednn {
         if (!dnnl_memory_desc_equal(srcDesc, dstDesc)) {
             dnnl_memory_t dstMem;
             DNNL_TRY(dnnl_memory_create(&dstMem, dstDesc, GetEngine(), DNNL_MEMORY_ALLOCATE));
-            dnnl_primitive_desc_t reorderDesc;
-            DNNL_TRY(dnnl_reorder_primitive_desc_create(&reorderDesc, srcDesc, GetEngine(), dstDesc,
-                                                        GetEngine(), NULL));
-            dnnl_primitive_t reorder;
-            DNNL_TRY(dnnl_primitive_create(&reorder, reorderDesc));
-            DNNL_TRY(dnnl_primitive_desc_destroy(reorderDesc));
+            PrimitiveCache::Entry entry;
+            DNNL_TRY(GetPrimitiveCache().GetOrCreateReorder(srcDesc, dstDesc, GetEngine(), &entry));
+            dnnl_primitive_t reorder = entry.primitive.get();
             std::vector<dnnl_exec_arg_t> args = {{DNNL_ARG_SRC, srcMem}, {DNNL_ARG_DST, dstMem}};
             if (mConstantMemories.find(srcMem) != mConstantMemories.end()) {
                 dnnl_stream_t stream;
                 DNNL_TRY(dnnl_stream_create(&stream, GetEngine(), dnnl_stream_default_flags));
 
                 DNNL_TRY(dnnl_primitive_execute(reorder, stream, args.size(), args.data()));
-                DNNL_TRY(dnnl_primitive_destroy(reorder));
             } else {
+                mPrimitives.push_back(entry);
                 mOperations.push_back({reorder, args});
             }
             mMemories.push_back(dstMem);
@@ -27,6 +27,7 @@
 #include "webnn/native/ops/Clamp.h"
 #include "webnn/native/ops/Constant.h"
 #include "webnn/native/ops/Conv2d.h"
+#include "webnn/native/ops/Gemm.h"
 #include "webnn/native/ops/Input.h"
 #include "webnn/native/ops/Pool2d.h"
 #include "webnn/native/ops/Reshape.h"
@@ -48,22 +49,55 @@ namespace webnn::native::onednn {
         virtual MaybeError AddPool2d(const op::Pool2d* pool2d) override;
         virtual MaybeError AddUnary(const op::Unary* unary) override;
         virtual MaybeError AddClamp(const op::Clamp* clamp) override;
+        virtual MaybeError AddGemm(const op::Gemm* gemm) override;
         virtual MaybeError Finish() override;
 
       private:
         dnnl_status_t AddConv2dImpl(const op::Conv2d* conv2d,
                                     const op::Binary* add = nullptr,
-                                    const op::FusionClamp* clamp = nullptr);
+                                    const op::ClampBase* clamp = nullptr);
         dnnl_status_t AddBinaryImpl(const op::Binary* binary);
         dnnl_status_t AddClampImpl(const op::Clamp* clamp);
+        dnnl_status_t AddGemmImpl(const op::Gemm* gemm);
         dnnl_status_t AddPool2dImpl(const op::Pool2d* pool2d);
         dnnl_status_t AddUnaryImpl(const op::Unary* unary);
 
         dnnl_status_t BuildPrimitives();
+        dnnl_status_t BuildOutputs();
+
+        // Quantization helpers.
+        const OperandBase* GetQuantizedOperand(const OperandBase* operand);
+        dnnl_status_t DequantizeConstant(const OperandBase* operand, dnnl_memory_t* floatMemory);
+        dnnl_status_t SetQuantizationAttributes(dnnl_primitive_attr_t attr,
+                                                const OperandBase* input,
+                                                const OperandBase* weights,
+                                                const OperandBase* output,
+                                                int32_t weightsChannelAxis,
+                                                float& outputScale,
+                                                float alpha = 1.0f);
 
         MaybeError CompileImpl() override;
         MaybeError ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) override;
         dnnl_engine_t GetEngine();
+        PrimitiveCache& GetPrimitiveCache();
+        // Gets the primitive from the primitive cache of the context, the graph holds a
+        // reference to it until destruction.
+        template <typename OpDesc>
+        dnnl_status_t CreatePrimitive(const OpDesc* opDesc,
+                                      const_dnnl_primitive_attr_t attr,
+                                      const_dnnl_primitive_desc_t* primitiveDesc,
+                                      dnnl_primitive_t* primitive) {
+            PrimitiveCache::Entry entry;
+            dnnl_status_t status =
+                GetPrimitiveCache().GetOrCreate(opDesc, attr, GetEngine(), &entry);
+            if (status != dnnl_success) {
+                return status;
+            }
+            *primitiveDesc = entry.primitiveDesc.get();
+            *primitive = entry.primitive.get();
+            mPrimitives.push_back(std::move(entry));
+            return dnnl_success;
+        }
         dnnl_status_t GetMemoryDesc(dnnl_memory_t memory, const dnnl_memory_desc_t** desc);
         dnnl_status_t ReorderIfNeeded(const dnnl_memory_desc_t* srcDesc,
                                       dnnl_memory_t srcMem,
@@ -77,8 +111,12 @@ namespace webnn::native::onednn {
         std::map<const OperandBase*, dnnl_memory_t> mOperandMemoryMap;
         std::map<std::string, dnnl_memory_t> mInputMemoryMap;
         std::map<std::string, dnnl_memory_t> mOutputMemoryMap;
+        std::vector<std::pair<std::string, const OperandBase*>> mOutputOperands;
+        // The operands that share the quantization params of another operand, e.g. the output
+        // of a quantized pooling.
+        std::map<const OperandBase*, const OperandBase*> mQuantizationAliases;
 
-        enum OperatorType { BINARY, CLAMP, CONV2D, POOL2D, UNARY };
+        enum OperatorType { BINARY, CLAMP, CONV2D, GEMM, POOL2D, UNARY };
         struct OperatorInfo {
             OperatorType opType;
             const OperatorBase* op;
@@ -92,6 +130,8 @@ namespace webnn::native::onednn {
         } Operation;
 
         std::vector<Operation> mOperations;
+        // The primitives shared with the primitive cache.
+        std::vector<PrimitiveCache::Entry> mPrimitives;
 
         dnnl_stream_t mStream;
     };
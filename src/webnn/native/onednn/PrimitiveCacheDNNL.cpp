@@ -0,0 +1,201 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/native/onednn/PrimitiveCacheDNNL.h"
+
+#include "common/Assert.h"
+
+#define DNNL_TRY(f)                   \
+    do {                              \
+        dnnl_status_t s_ = f;         \
+        if (s_ != dnnl_success)       \
+            return s_;                \
+    } while (0)
+
+namespace webnn::native::onednn {
+
+    namespace {
+
+        template <typename T>
+        void AppendToKey(std::string& key, const T* data, size_t count = 1) {
+            key.append(reinterpret_cast<const char*>(data), sizeof(T) * count);
+        }
+
+        // The attributes are opaque, so they are serialized by querying the parameters that
+        // the graph may set: output scales, zero points and post ops.
+        dnnl_status_t AppendAttributesToKey(std::string& key, const_dnnl_primitive_attr_t attr) {
+            if (attr == nullptr) {
+                return dnnl_success;
+            }
+            dnnl_dim_t count;
+            int mask;
+            const float* scales;
+            DNNL_TRY(dnnl_primitive_attr_get_output_scales(attr, &count, &mask, &scales));
+            AppendToKey(key, &count);
+            AppendToKey(key, &mask);
+            AppendToKey(key, scales, count);
+            for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
+                const int32_t* zeroPoints;
+                DNNL_TRY(
+                    dnnl_primitive_attr_get_zero_points(attr, arg, &count, &mask, &zeroPoints));
+                AppendToKey(key, &count);
+                AppendToKey(key, &mask);
+                AppendToKey(key, zeroPoints, count);
+            }
+            const_dnnl_post_ops_t postops;
+            DNNL_TRY(dnnl_primitive_attr_get_post_ops(attr, &postops));
+            const int length = dnnl_post_ops_len(postops);
+            AppendToKey(key, &length);
+            for (int i = 0; i < length; ++i) {
+                const dnnl_primitive_kind_t kind = dnnl_post_ops_get_kind(postops, i);
+                AppendToKey(key, &kind);
+                if (kind == dnnl_eltwise) {
+                    float scale, alpha, beta;
+                    dnnl_alg_kind_t alg;
+                    DNNL_TRY(
+                        dnnl_post_ops_get_params_eltwise(postops, i, &scale, &alg, &alpha, &beta));
+                    AppendToKey(key, &scale);
+                    AppendToKey(key, &alg);
+                    AppendToKey(key, &alpha);
+                    AppendToKey(key, &beta);
+                } else if (kind == dnnl_binary) {
+                    dnnl_alg_kind_t alg;
+                    const dnnl_memory_desc_t* src1Desc;
+                    DNNL_TRY(dnnl_post_ops_get_params_binary(postops, i, &alg, &src1Desc));
+                    AppendToKey(key, &alg);
+                    AppendToKey(key, src1Desc);
+                } else {
+                    // The graph doesn't append other post ops, don't cache what can't be keyed.
+                    return dnnl_unimplemented;
+                }
+            }
+            return dnnl_success;
+        }
+
+    }  // anonymous namespace
+
+    PrimitiveCache::PrimitiveCache(size_t capacity) : mCapacity(capacity) {
+    }
+
+    dnnl_status_t PrimitiveCache::GetOrCreate(const_dnnl_op_desc_t opDesc,
+                                              size_t opDescSize,
+                                              const_dnnl_primitive_attr_t attr,
+                                              dnnl_engine_t engine,
+                                              Entry* entry) {
+        auto create = [&](dnnl_primitive_desc_t* primitiveDesc) {
+            return dnnl_primitive_desc_create(primitiveDesc, opDesc, attr, engine, NULL);
+        };
+        std::string key;
+        AppendToKey(key, &engine);
+        AppendToKey(key, static_cast<const char*>(opDesc), opDescSize);
+        if (AppendAttributesToKey(key, attr) != dnnl_success) {
+            key.clear();
+        }
+        return Lookup(key, create, entry);
+    }
+
+    dnnl_status_t PrimitiveCache::GetOrCreateReorder(const dnnl_memory_desc_t* srcDesc,
+                                                     const dnnl_memory_desc_t* dstDesc,
+                                                     dnnl_engine_t engine,
+                                                     Entry* entry) {
+        auto create = [&](dnnl_primitive_desc_t* primitiveDesc) {
+            return dnnl_reorder_primitive_desc_create(primitiveDesc, srcDesc, engine, dstDesc,
+                                                      engine, NULL);
+        };
+        // There is no operation descriptor for reorder, so it's keyed by the primitive kind
+        // and the memory descriptors.
+        std::string key;
+        const dnnl_primitive_kind_t kind = dnnl_reorder;
+        AppendToKey(key, &engine);
+        AppendToKey(key, &kind);
+        AppendToKey(key, srcDesc);
+        AppendToKey(key, dstDesc);
+        return Lookup(key, create, entry);
+    }
+
+    dnnl_status_t PrimitiveCache::Lookup(
+        const std::string& key,
+        const std::function<dnnl_status_t(dnnl_primitive_desc_t*)>& create,
+        Entry* entry) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto iter = key.empty() ? mEntryMap.end() : mEntryMap.find(key);
+            if (iter != mEntryMap.end()) {
+                // Move the hit entry to the front as the most recently used.
+                mEntries.splice(mEntries.begin(), mEntries, iter->second);
+                *entry = iter->second->second;
+                mHitCount++;
+                return dnnl_success;
+            }
+            mMissCount++;
+        }
+
+        // Create the primitive without holding the lock since jitting may be slow.
+        dnnl_primitive_desc_t primitiveDesc;
+        DNNL_TRY(create(&primitiveDesc));
+        entry->primitiveDesc.reset(primitiveDesc, dnnl_primitive_desc_destroy);
+        dnnl_primitive_t primitive;
+        DNNL_TRY(dnnl_primitive_create(&primitive, primitiveDesc));
+        entry->primitive.reset(primitive, dnnl_primitive_destroy);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (key.empty() || mCapacity == 0 || mEntryMap.find(key) != mEntryMap.end()) {
+            return dnnl_success;
+        }
+        mEntries.emplace_front(key, *entry);
+        mEntryMap.insert(std::make_pair(key, mEntries.begin()));
+        EvictIfNeeded();
+        return dnnl_success;
+    }
+
+    void PrimitiveCache::EvictIfNeeded() {
+        while (mEntries.size() > mCapacity) {
+            mEntryMap.erase(mEntries.back().first);
+            mEntries.pop_back();
+        }
+    }
+
+    void PrimitiveCache::SetCapacity(size_t capacity) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCapacity = capacity;
+        EvictIfNeeded();
+    }
+
+    size_t PrimitiveCache::GetCapacity() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mCapacity;
+    }
+
+    size_t PrimitiveCache::GetSize() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mEntries.size();
+    }
+
+    uint64_t PrimitiveCache::GetHitCount() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mHitCount;
+    }
+
+    uint64_t PrimitiveCache::GetMissCount() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mMissCount;
+    }
+
+    void PrimitiveCache::Clear() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.clear();
+        mEntryMap.clear();
+    }
+
+}  // namespace webnn::native::onednn
@@ -0,0 +1,91 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_ONEDNN_PRIMITIVE_CACHE_DNNL_H_
+#define WEBNN_NATIVE_ONEDNN_PRIMITIVE_CACHE_DNNL_H_
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <dnnl.h>
+
+namespace webnn::native::onednn {
+
+    // A least recently used cache of primitive descriptors and primitives shared by all graphs of
+    // a context. The key is built from the whole operation descriptor and the primitive
+    // attributes, so graphs with identical ops reuse the jitted primitives.
+    class PrimitiveCache {
+      public:
+        // The entry is reference counted, a graph keeps its primitives alive after eviction.
+        struct Entry {
+            std::shared_ptr<dnnl_primitive_desc> primitiveDesc;
+            std::shared_ptr<dnnl_primitive> primitive;
+        };
+
+        static constexpr size_t kDefaultCapacity = 1024;
+
+        // The capacity 0 disables the cache.
+        explicit PrimitiveCache(size_t capacity = kDefaultCapacity);
+        ~PrimitiveCache() = default;
+
+        // Returns the cached primitive for the operation descriptor and attributes, the
+        // primitive is created and cached on miss.
+        template <typename OpDesc>
+        dnnl_status_t GetOrCreate(const OpDesc* opDesc,
+                                  const_dnnl_primitive_attr_t attr,
+                                  dnnl_engine_t engine,
+                                  Entry* entry) {
+            return GetOrCreate(opDesc, sizeof(OpDesc), attr, engine, entry);
+        }
+        dnnl_status_t GetOrCreateReorder(const dnnl_memory_desc_t* srcDesc,
+                                         const dnnl_memory_desc_t* dstDesc,
+                                         dnnl_engine_t engine,
+                                         Entry* entry);
+
+        // Evicts the least recently used entries if the size exceeds the new capacity. The
+        // capacity 0 disables the cache.
+        void SetCapacity(size_t capacity);
+        size_t GetCapacity() const;
+        size_t GetSize() const;
+        uint64_t GetHitCount() const;
+        uint64_t GetMissCount() const;
+        void Clear();
+
+      private:
+        dnnl_status_t GetOrCreate(const_dnnl_op_desc_t opDesc,
+                                  size_t opDescSize,
+                                  const_dnnl_primitive_attr_t attr,
+                                  dnnl_engine_t engine,
+                                  Entry* entry);
+        dnnl_status_t Lookup(const std::string& key,
+                             const std::function<dnnl_status_t(dnnl_primitive_desc_t*)>& create,
+                             Entry* entry);
+        void EvictIfNeeded();
+
+        using EntryList = std::list<std::pair<std::string, Entry>>;
+        EntryList mEntries;
+        std::unordered_map<std::string, EntryList::iterator> mEntryMap;
+        size_t mCapacity;
+        uint64_t mHitCount = 0;
+        uint64_t mMissCount = 0;
+        mutable std::mutex mMutex;
+    };
+
+}  // namespace webnn::native::onednn
+
+#endif  // WEBNN_NATIVE_ONEDNN_PRIMITIVE_CACHE_DNNL_H_
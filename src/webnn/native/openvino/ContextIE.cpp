@@ -14,6 +14,9 @@
 
 #include "webnn/native/openvino/ContextIE.h"
 
+#include <cstdlib>
+
+#include "common/Assert.h"
 #include "common/Log.h"
 #include "common/RefCounted.h"
 #include "webnn/native/openvino/GraphIE.h"
@@ -24,17 +27,107 @@ namespace webnn::native::ie {
         IEStatusCode status = ie_core_create("", &mInferEngineCore);
         if (status != IEStatusCode::OK) {
             dawn::ErrorLog() << "Failed to create inference engine core.";
+            return;
+        }
+        // The cache directory of the context options takes precedence over the environment
+        // variable, the inference engine creates the directory.
+        std::string cacheDirectory;
+        if (GetContextOptions().cacheDirectory != nullptr) {
+            cacheDirectory = std::string(GetContextOptions().cacheDirectory) + "/openvino";
+        } else if (const char* directory = std::getenv("WEBNN_OPENVINO_CACHE_DIR")) {
+            cacheDirectory = directory;
+        }
+        if (!cacheDirectory.empty()) {
+            ie_config_t config = {"CACHE_DIR", cacheDirectory.c_str(), NULL};
+            status = ie_core_set_config(mInferEngineCore, &config, "");
+            if (status != IEStatusCode::OK) {
+                dawn::WarningLog() << "Failed to enable the OpenVINO model cache in "
+                                   << cacheDirectory;
+            } else {
+                mModelCacheDirectory = cacheDirectory;
+            }
         }
     }
 
     Context::~Context() {
+        const uint64_t hits = mModelCacheHitCount;
+        const uint64_t misses = mModelCacheMissCount;
+        if (hits + misses != 0) {
+            dawn::InfoLog() << "OpenVINO model cache: " << hits << " hits, " << misses
+                            << " misses.";
+        }
+        // The queued tasks keep the context alive, so the queue is empty here. The context is
+        // destroyed on the release thread if the last reference is released by a task.
+        {
+            std::lock_guard<std::mutex> lock(mReleaseQueue->mutex);
+            DAWN_ASSERT(mReleaseQueue->tasks.empty());
+            mReleaseQueue->stopped = true;
+        }
+        mReleaseQueue->condition.notify_all();
+        if (mReleaseThread.joinable()) {
+            if (mReleaseThread.get_id() == std::this_thread::get_id()) {
+                mReleaseThread.detach();
+            } else {
+                mReleaseThread.join();
+            }
+        }
         ie_core_free(&mInferEngineCore);
     }
 
+    void Context::PostReleaseTask(std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(mReleaseQueue->mutex);
+        if (!mReleaseThread.joinable()) {
+            mReleaseThread = std::thread(RunReleaseTasks, mReleaseQueue);
+        }
+        mReleaseQueue->tasks.push_back(std::move(task));
+        mReleaseQueue->condition.notify_one();
+    }
+
+    // static
+    void Context::RunReleaseTasks(std::shared_ptr<ReleaseQueue> queue) {
+        std::unique_lock<std::mutex> lock(queue->mutex);
+        while (true) {
+            queue->condition.wait(lock, [&queue]() {
+                return queue->stopped || !queue->tasks.empty();
+            });
+            if (queue->tasks.empty()) {
+                return;
+            }
+            std::function<void()> task = std::move(queue->tasks.front());
+            queue->tasks.pop_front();
+            lock.unlock();
+            // The task and its reference to the context are released without the lock, the
+            // context may be destroyed here.
+            task();
+            task = nullptr;
+            lock.lock();
+        }
+    }
+
     ie_core_t* Context::InferenceEngineCore() {
         return mInferEngineCore;
     }
 
+    const std::string& Context::GetModelCacheDirectory() const {
+        return mModelCacheDirectory;
+    }
+
+    void Context::RecordModelCacheLookup(bool hit) {
+        if (hit) {
+            mModelCacheHitCount++;
+        } else {
+            mModelCacheMissCount++;
+        }
+    }
+
+    uint64_t Context::GetModelCacheHitCount() const {
+        return mModelCacheHitCount;
+    }
+
+    uint64_t Context::GetModelCacheMissCount() const {
+        return mModelCacheMissCount;
+    }
+
     GraphBase* Context::CreateGraphImpl() {
         return new Graph(this);
     }
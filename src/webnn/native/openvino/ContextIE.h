@@ -16,6 +16,14 @@
 #define WEBNN_NATIVE_IE_CONTEXT_IE_H_
 
 #include <ngraph_c_api.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 
 #include "webnn/native/Context.h"
 #include "webnn/native/Graph.h"
@@ -29,10 +37,41 @@ namespace webnn::native::ie {
 
         ie_core_t* InferenceEngineCore();
 
+        // The compiled models are cached in the directory by the inference engine, the key of
+        // a model is the hash of the network, the device and the config. The directory is
+        // empty if the cache is disabled.
+        const std::string& GetModelCacheDirectory() const;
+        // The lookups are counted from the LOADED_FROM_CACHE metric of the executable network,
+        // the networks of plugins without the metric are not counted.
+        void RecordModelCacheLookup(bool hit);
+        uint64_t GetModelCacheHitCount() const;
+        uint64_t GetModelCacheMissCount() const;
+
+        // Runs the task on the release thread of the context, such as freeing the infer request
+        // whose completion callback released the graph, which the plugin uses until the
+        // callback returns. The task keeps a reference to the context, so all tasks are done
+        // before the context is destroyed and the inference engine core is freed.
+        void PostReleaseTask(std::function<void()> task);
+
       private:
         GraphBase* CreateGraphImpl() override;
 
+        // The queue is shared with the release thread, which may outlive the context if the
+        // last reference is released by a task.
+        struct ReleaseQueue {
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::deque<std::function<void()>> tasks;
+            bool stopped = false;
+        };
+        static void RunReleaseTasks(std::shared_ptr<ReleaseQueue> queue);
+
         ie_core_t* mInferEngineCore;
+        std::string mModelCacheDirectory;
+        std::atomic<uint64_t> mModelCacheHitCount = 0;
+        std::atomic<uint64_t> mModelCacheMissCount = 0;
+        std::shared_ptr<ReleaseQueue> mReleaseQueue = std::make_shared<ReleaseQueue>();
+        std::thread mReleaseThread;
     };
 
 }  // namespace webnn::native::ie
@@ -15,6 +15,10 @@
 #include "webnn/native/openvino/GraphIE.h"
 
 #include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "common/Assert.h"
@@ -34,6 +38,9 @@
 namespace webnn::native::ie {
 
     namespace {
+        // The request whose completion callback is running on the thread.
+        thread_local const void* gCompletingInferRequest = nullptr;
+
         enum TransposeType { None, NhwcToNchw, HwncToNchw, NchwToNhwc, NchwToHwnc };
 
         bool CheckShape(dimensions_t ieShape, std::vector<int32_t> expectedShape) {
@@ -319,20 +326,84 @@ namespace webnn::native::ie {
             }
             return status;
         }
+
+        // Returns the config of the CPU plugin, the streams, the threads and the binding follow
+        // the power preference unless they are set by the context options. The high
+        // performance preference runs the computes of the request pool in throughput streams,
+        // the low power preference computes in a single stream of a few unbound threads.
+        std::vector<std::pair<std::string, std::string>> GetCpuConfig(
+            const ContextOptions& options) {
+            std::vector<std::pair<std::string, std::string>> config;
+            const wnn::PowerPreference powerPreference = options.powerPreference;
+            if (options.streamCount != 0) {
+                config.push_back({"CPU_THROUGHPUT_STREAMS", std::to_string(options.streamCount)});
+            } else if (powerPreference == wnn::PowerPreference::High_performance) {
+                config.push_back({"CPU_THROUGHPUT_STREAMS", "CPU_THROUGHPUT_AUTO"});
+            } else if (powerPreference == wnn::PowerPreference::Low_power) {
+                config.push_back({"CPU_THROUGHPUT_STREAMS", "1"});
+            }
+            if (options.threadCount != 0) {
+                config.push_back({"CPU_THREADS_NUM", std::to_string(options.threadCount)});
+            } else if (powerPreference == wnn::PowerPreference::Low_power) {
+                uint32_t threadCount = std::max(std::thread::hardware_concurrency() / 4, 1u);
+                config.push_back({"CPU_THREADS_NUM", std::to_string(threadCount)});
+            }
+            switch (options.threadBinding) {
+                case wnn::ThreadBinding::None:
+                    config.push_back({"CPU_BIND_THREAD", "NO"});
+                    break;
+                case wnn::ThreadBinding::Cores:
+                    config.push_back({"CPU_BIND_THREAD", "YES"});
+                    break;
+                case wnn::ThreadBinding::Numa:
+                    config.push_back({"CPU_BIND_THREAD", "NUMA"});
+                    break;
+                default:
+                    if (powerPreference == wnn::PowerPreference::High_performance) {
+                        config.push_back({"CPU_BIND_THREAD", "NUMA"});
+                    } else if (powerPreference == wnn::PowerPreference::Low_power) {
+                        // The unbound threads may be scheduled on the efficient cores.
+                        config.push_back({"CPU_BIND_THREAD", "NO"});
+                    }
+                    break;
+            }
+            // The bf16 inference is enforced on the processors with native bf16 support.
+            if (options.precisionHint == wnn::PrecisionHint::Bfloat16) {
+                config.push_back({"ENFORCE_BF16", "YES"});
+            } else if (options.precisionHint == wnn::PrecisionHint::Float32) {
+                config.push_back({"ENFORCE_BF16", "NO"});
+            }
+            return config;
+        }
     }  // namespace
 
     Graph::Graph(Context* context)
-        : GraphBase(context), mInferEngineNetwork(nullptr), mInferEngineRequest(nullptr) {
+        : GraphBase(context), mInferEngineNetwork(nullptr) {
         mInferEngineCore = context->InferenceEngineCore();
+        mResolveBlobsPerCompute =
+            std::getenv("WEBNN_OPENVINO_RESOLVE_BLOBS_PER_COMPUTE") != nullptr;
     }
 
     Graph::~Graph() {
+        // The running and queued async computes keep the graph alive, so no request is running
+        // here unless the graph is released by the completion callback of its last compute.
+        // The plugin uses that request until the callback returns, so it's waited and freed
+        // on the release thread of the context.
+        DAWN_ASSERT(mPendingComputes.empty());
+        for (auto& inferRequest : mInferRequests) {
+            if (inferRequest.get() == gCompletingInferRequest) {
+                Context* context = reinterpret_cast<Context*>(GetContext());
+                std::shared_ptr<InferRequest> request = std::move(inferRequest);
+                context->PostReleaseTask([request, context = Ref<Context>(context)]() {
+                    FreeInferRequest(request.get());
+                });
+            } else {
+                FreeInferRequest(inferRequest.get());
+            }
+        }
         if (mInferEngineNetwork) {
             ie_network_free(&mInferEngineNetwork);
         }
-        if (mInferEngineRequest) {
-            ie_infer_request_free(&mInferEngineRequest);
-        }
         for (auto node : mGraphNodeMap) {
             ngraph_node_free(const_cast<ngraph_node_t**>(&node.second));
         }
@@ -1308,77 +1379,367 @@ namespace webnn::native::ie {
     }
 
     MaybeError Graph::CompileImpl() {
-        wnn::DevicePreference devicePreference = GetContext()->GetContextOptions().devicePreference;
-        const char* deviceName = devicePreference == wnn::DevicePreference::Gpu ? "GPU" : "CPU";
+        ContextOptions options = GetContext()->GetContextOptions();
+        const char* deviceName =
+            options.devicePreference == wnn::DevicePreference::Gpu ? "GPU" : "CPU";
 
-        ie_config_t config = {NULL, NULL, NULL};
+        std::vector<std::pair<std::string, std::string>> configPairs;
+        if (options.devicePreference != wnn::DevicePreference::Gpu) {
+            configPairs = GetCpuConfig(options);
+        }
+        // The config is a linked list of the pairs.
+        std::vector<ie_config_t> configList(configPairs.size() + 1, {NULL, NULL, NULL});
+        for (size_t i = 0; i < configPairs.size(); ++i) {
+            configList[i] = {configPairs[i].first.c_str(), configPairs[i].second.c_str(),
+                             i + 1 < configPairs.size() ? &configList[i + 1] : NULL};
+        }
+        ie_config_t& config = configList[0];
         ie_executable_network_t* executableNetwork;
         IEStatusCode status = ie_core_load_network(mInferEngineCore, mInferEngineNetwork,
                                                    deviceName, &config, &executableNetwork);
         DAWN_TRY(CheckStatusCode(status, "IE load network"));
-        status = ie_exec_network_create_infer_request(executableNetwork, &mInferEngineRequest);
-        DAWN_TRY(CheckStatusCode(status, "IE create infer request"));
+        // The model is loaded from the cache without compiling if it was compiled before, the
+        // plugin reports it by the metric of the executable network.
+        Context* context = reinterpret_cast<Context*>(GetContext());
+        if (!context->GetModelCacheDirectory().empty()) {
+            ie_param_t param;
+            status = ie_exec_network_get_metric(executableNetwork, "LOADED_FROM_CACHE", &param);
+            if (status == IEStatusCode::OK) {
+                context->RecordModelCacheLookup(param.number != 0);
+            }
+        }
+        // The pool has the optimal number of requests for the streams of the plugin unless the
+        // concurrency is set by the context options.
+        uint32_t requestCount = options.computeConcurrency;
+        if (requestCount == 0) {
+            ie_param_t param;
+            status = ie_exec_network_get_metric(executableNetwork,
+                                                "OPTIMAL_NUMBER_OF_INFER_REQUESTS", &param);
+            requestCount = status == IEStatusCode::OK ? param.number : 1;
+        }
+        requestCount = std::max(requestCount, 1u);
+        BlobNames inputNames, outputNames;
+        MaybeError maybeError = GetInputBlobNames(&inputNames);
+        if (!maybeError.IsError()) {
+            maybeError = GetOutputBlobNames(&outputNames);
+        }
+        for (uint32_t i = 0; i < requestCount && !maybeError.IsError(); ++i) {
+            maybeError = CreateInferRequest(executableNetwork, inputNames, outputNames);
+        }
         ie_exec_network_free(&executableNetwork);
-        return {};
+        return maybeError;
     }
 
-    MaybeError Graph::ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
-        auto namedInputs = inputs->GetRecords();
-        for (auto& [name, input] : mInputIdMap) {
-            DAWN_INVALID_IF(namedInputs.find(name) == namedInputs.end(), "all inputs must be set.");
-            ie_blob_t* blob;
+    MaybeError Graph::GetInputBlobNames(BlobNames* inputNames) {
+        for (auto& [name, index] : mInputIdMap) {
             char* inputName = nullptr;
-            IEStatusCode status = ie_network_get_input_name(mInferEngineNetwork, input, &inputName);
-            if (status != IEStatusCode::OK) {
-                return DAWN_INTERNAL_ERROR("IE Failed to ie_network_get_input_name");
-            }
-            status = ie_infer_request_get_blob(mInferEngineRequest, inputName, &blob);
-            if (status != IEStatusCode::OK) {
-                return DAWN_INTERNAL_ERROR("IE Failed to ie_infer_request_get_blob");
+            IEStatusCode status = ie_network_get_input_name(mInferEngineNetwork, index, &inputName);
+            DAWN_TRY(CheckStatusCode(status, "IE get input name"));
+            inputNames->push_back({name, inputName});
+            ie_network_name_free(&inputName);
+        }
+        return {};
+    }
+
+    MaybeError Graph::GetOutputBlobNames(BlobNames* outputNames) {
+        // The outputs are renamed by TransposeSinking, they are found by the original index.
+        for (auto& [name, originalName] : mOutputNameMap) {
+            auto index = mOriginalNameMap.find(originalName);
+            if (index == mOriginalNameMap.end()) {
+                return DAWN_INTERNAL_ERROR("IE Failed to get output");
             }
+            char* sinkingName = nullptr;
+            IEStatusCode status =
+                ie_network_get_output_name(mInferEngineNetwork, index->second, &sinkingName);
+            DAWN_TRY(CheckStatusCode(status, "IE get output name"));
+            outputNames->push_back({name, sinkingName});
+            ie_network_name_free(&sinkingName);
+        }
+        return {};
+    }
+
+    MaybeError Graph::CreateInferRequest(ie_executable_network_t* executableNetwork,
+                                         const BlobNames& inputNames,
+                                         const BlobNames& outputNames) {
+        auto inferRequest = std::make_unique<InferRequest>();
+        IEStatusCode status =
+            ie_exec_network_create_infer_request(executableNetwork, &inferRequest->request);
+        DAWN_TRY(CheckStatusCode(status, "IE create infer request"));
+        // The callback is kept by the request, so the struct stays at the same address.
+        inferRequest->completion.completeCallBackFunc = &Graph::OnInferRequestCompleted;
+        inferRequest->completion.args = inferRequest.get();
+        ie_infer_set_completion_callback(inferRequest->request, &inferRequest->completion);
+        InferRequest* request = inferRequest.get();
+        // The request is owned by the graph first, so it's freed on the errors below.
+        mInferRequests.push_back(std::move(inferRequest));
+
+        // The blobs are kept by the request, so the computes don't resolve them again.
+        DAWN_TRY(ResolveBlobSlots(request->request, inputNames, &request->inputSlots));
+        DAWN_TRY(ResolveBlobSlots(request->request, outputNames, &request->outputSlots));
+        mIdleInferRequests.push_back(request);
+        return {};
+    }
+
+    // static
+    MaybeError Graph::ResolveBlobSlots(ie_infer_request_t* request,
+                                       const BlobNames& names,
+                                       std::vector<BlobSlot>* slots) {
+        for (auto& [name, blobName] : names) {
+            BlobSlot slot;
+            slot.name = name;
+            IEStatusCode status = ie_infer_request_get_blob(request, blobName.c_str(), &slot.blob);
+            DAWN_TRY(CheckStatusCode(status, "IE get blob"));
             ie_blob_buffer_t buffer;
-            status = ie_blob_get_buffer(blob, &buffer);
-            if (status != IEStatusCode::OK) {
-                return DAWN_INTERNAL_ERROR("IE Failed to ie_blob_get_buffer");
+            status = ie_blob_get_buffer(slot.blob, &buffer);
+            int byteLength = 0;
+            if (status == IEStatusCode::OK) {
+                status = ie_blob_byte_size(slot.blob, &byteLength);
             }
-            auto& resource = namedInputs[name].resource.arrayBufferView;
-            memcpy(buffer.buffer, static_cast<int8_t*>(resource.buffer) + resource.byteOffset,
+            slot.buffer = buffer.buffer;
+            slot.byteLength = byteLength;
+            slots->push_back(slot);
+            DAWN_TRY(CheckStatusCode(status, "IE get blob buffer"));
+        }
+        return {};
+    }
+
+    // static
+    void Graph::FreeBlobSlots(std::vector<BlobSlot>* slots) {
+        for (BlobSlot& slot : *slots) {
+            ie_blob_free(&slot.blob);
+        }
+    }
+
+    MaybeError Graph::ResolveBlobSlotsPerCompute(InferRequest* inferRequest,
+                                                 bool inputs,
+                                                 std::vector<BlobSlot>* slots) {
+        BlobNames names;
+        DAWN_TRY(inputs ? GetInputBlobNames(&names) : GetOutputBlobNames(&names));
+        MaybeError maybeError = ResolveBlobSlots(inferRequest->request, names, slots);
+        // The buffers are owned by the request, only the handles of the blobs are freed.
+        FreeBlobSlots(slots);
+        return maybeError;
+    }
+
+    Graph::InferRequest* Graph::AcquireInferRequest() {
+        std::unique_lock<std::mutex> lock(mInferRequestMutex);
+        mInferRequestCondition.wait(lock, [this] { return !mIdleInferRequests.empty(); });
+        InferRequest* inferRequest = mIdleInferRequests.back();
+        mIdleInferRequests.pop_back();
+        return inferRequest;
+    }
+
+    void Graph::ReleaseInferRequest(InferRequest* inferRequest) {
+        while (true) {
+            PendingCompute pending;
+            {
+                std::lock_guard<std::mutex> lock(mInferRequestMutex);
+                if (mPendingComputes.empty()) {
+                    mIdleInferRequests.push_back(inferRequest);
+                    mInferRequestCondition.notify_one();
+                    return;
+                }
+                pending = std::move(mPendingComputes.front());
+                mPendingComputes.pop_front();
+            }
+            // The inputs were validated when the compute was queued.
+            SetInputs(inferRequest, pending.inputs);
+            MaybeError maybeError =
+                StartAsync(inferRequest, pending.outputs.Get(), pending.callback, pending.userdata);
+            if (!maybeError.IsError()) {
+                return;
+            }
+            std::unique_ptr<ErrorData> errorData = maybeError.AcquireError();
+            pending.callback(static_cast<WNNErrorType>(ToWNNErrorType(errorData->GetType())),
+                             errorData->GetMessage().c_str(), pending.userdata);
+        }
+    }
+
+    // static
+    void Graph::FreeInferRequest(InferRequest* inferRequest) {
+        ie_infer_request_wait(inferRequest->request, -1);
+        FreeBlobSlots(&inferRequest->inputSlots);
+        FreeBlobSlots(&inferRequest->outputSlots);
+        ie_infer_request_free(&inferRequest->request);
+    }
+
+    MaybeError Graph::SetInputs(InferRequest* inferRequest, NamedInputsBase* inputs) {
+        std::vector<BlobSlot> resolvedSlots;
+        if (mResolveBlobsPerCompute) {
+            DAWN_TRY(ResolveBlobSlotsPerCompute(inferRequest, true, &resolvedSlots));
+        }
+        const auto& namedInputs = inputs->GetRecords();
+        for (const BlobSlot& slot :
+             mResolveBlobsPerCompute ? resolvedSlots : inferRequest->inputSlots) {
+            auto input = namedInputs.find(slot.name);
+            DAWN_INVALID_IF(input == namedInputs.end(), "all inputs must be set.");
+            auto& resource = input->second.resource.arrayBufferView;
+            DAWN_INVALID_IF(resource.byteLength > slot.byteLength,
+                            "The size of input buffer is larger than the input blob.");
+            memcpy(slot.buffer, static_cast<int8_t*>(resource.buffer) + resource.byteOffset,
                    resource.byteLength);
         }
+        return {};
+    }
+
+    void Graph::SetInputs(InferRequest* inferRequest,
+                          const std::map<std::string, std::vector<int8_t>>& inputs) {
+        for (const BlobSlot& slot : inferRequest->inputSlots) {
+            const std::vector<int8_t>& data = inputs.at(slot.name);
+            memcpy(slot.buffer, data.data(), data.size());
+        }
+    }
+
+    MaybeError Graph::CopyInputs(NamedInputsBase* inputs,
+                                 std::map<std::string, std::vector<int8_t>>* inputData) {
+        const auto& namedInputs = inputs->GetRecords();
+        // The slots are the same for all requests of the pool.
+        for (const BlobSlot& slot : mInferRequests[0]->inputSlots) {
+            auto input = namedInputs.find(slot.name);
+            DAWN_INVALID_IF(input == namedInputs.end(), "all inputs must be set.");
+            auto& resource = input->second.resource.arrayBufferView;
+            DAWN_INVALID_IF(resource.byteLength > slot.byteLength,
+                            "The size of input buffer is larger than the input blob.");
+            const int8_t* buffer = static_cast<int8_t*>(resource.buffer) + resource.byteOffset;
+            (*inputData)[slot.name].assign(buffer, buffer + resource.byteLength);
+        }
+        return {};
+    }
 
-        // Compute the compiled model.
-        IEStatusCode code = ie_infer_request_infer(mInferEngineRequest);
+    MaybeError Graph::GetOutputs(InferRequest* inferRequest, NamedOutputsBase* outputs) {
+        std::vector<BlobSlot> resolvedSlots;
+        if (mResolveBlobsPerCompute) {
+            DAWN_TRY(ResolveBlobSlotsPerCompute(inferRequest, false, &resolvedSlots));
+        }
+        const std::vector<BlobSlot>& outputSlots =
+            mResolveBlobsPerCompute ? resolvedSlots : inferRequest->outputSlots;
+        for (auto& [name, output] : outputs->GetRecords()) {
+            auto slot = std::find_if(outputSlots.begin(), outputSlots.end(),
+                                     [&name = name](const BlobSlot& outputSlot) {
+                                         return outputSlot.name == name;
+                                     });
+            DAWN_INVALID_IF(slot == outputSlots.end(),
+                            "The output " + name + " isn't an output of the graph.");
+            const ArrayBufferView& resource = output.arrayBufferView;
+            DAWN_ASSERT(resource.buffer != nullptr && resource.byteLength != 0);
+            DAWN_INVALID_IF(resource.byteLength < slot->byteLength,
+                            "The size of output buffer is smaller than the output blob.");
+            memcpy(static_cast<int8_t*>(resource.buffer) + resource.byteOffset, slot->buffer,
+                   slot->byteLength);
+        }
+        return {};
+    }
+
+    MaybeError Graph::ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
+        InferRequest* inferRequest = AcquireInferRequest();
+        MaybeError maybeError = SetInputs(inferRequest, inputs);
+        if (!maybeError.IsError()) {
+            // Compute the compiled model.
+            IEStatusCode code = ie_infer_request_infer(inferRequest->request);
+            if (code != IEStatusCode::OK) {
+                maybeError = DAWN_INTERNAL_ERROR("IE Failed to compute model");
+            } else {
+                maybeError = GetOutputs(inferRequest, outputs);
+            }
+        }
+        ReleaseInferRequest(inferRequest);
+        return maybeError;
+    }
+
+    MaybeError Graph::StartAsync(InferRequest* inferRequest,
+                                 NamedOutputsBase* outputs,
+                                 WNNComputeAsyncCallback callback,
+                                 void* userdata) {
+        inferRequest->graph = this;
+        inferRequest->outputs = outputs;
+        inferRequest->callback = callback;
+        inferRequest->userdata = userdata;
+        IEStatusCode code = ie_infer_request_infer_async(inferRequest->request);
         if (code != IEStatusCode::OK) {
-            return DAWN_INTERNAL_ERROR("IE Failed to compute model");
+            inferRequest->outputs = nullptr;
+            inferRequest->callback = nullptr;
+            inferRequest->userdata = nullptr;
+            inferRequest->graph = nullptr;
+            return DAWN_INTERNAL_ERROR("IE Failed to start computing model");
         }
+        return {};
+    }
 
-        // Get Data from nGraph with output.
-        for (auto [name, resource] : outputs->GetRecords()) {
-            ArrayBufferView output = resource.arrayBufferView;
-            DAWN_ASSERT(output.buffer != nullptr && output.byteLength != 0);
-            // Get output id with friendly name.
-            auto originalName = mOutputNameMap[name];
-            if (mOriginalNameMap.find(originalName) == mOriginalNameMap.end()) {
-                return DAWN_INTERNAL_ERROR("IE Failed to get output");
+    void Graph::ComputeAsyncImpl(NamedInputsBase* inputs,
+                                 NamedOutputsBase* outputs,
+                                 WNNComputeAsyncCallback callback,
+                                 void* userdata) {
+        InferRequest* inferRequest = nullptr;
+        MaybeError maybeError;
+        {
+            // The caller isn't blocked when all requests are running, the compute is queued
+            // and started by the completion of a request.
+            std::lock_guard<std::mutex> lock(mInferRequestMutex);
+            if (mIdleInferRequests.empty()) {
+                PendingCompute pending;
+                maybeError = CopyInputs(inputs, &pending.inputs);
+                if (!maybeError.IsError()) {
+                    pending.outputs = outputs;
+                    pending.callback = callback;
+                    pending.userdata = userdata;
+                    mPendingComputes.push_back(std::move(pending));
+                    return;
+                }
+            } else {
+                inferRequest = mIdleInferRequests.back();
+                mIdleInferRequests.pop_back();
             }
-            char* sinkingName;
-            IEStatusCode status = ie_network_get_output_name(
-                mInferEngineNetwork, mOriginalNameMap[originalName], &sinkingName);
-            ie_blob_t* outputBlob;
-            status = ie_infer_request_get_blob(mInferEngineRequest, sinkingName, &outputBlob);
-            if (status != IEStatusCode::OK) {
-                return DAWN_INTERNAL_ERROR("IE Failed to ie_infer_request_get_blob");
+        }
+        if (inferRequest != nullptr) {
+            maybeError = SetInputs(inferRequest, inputs);
+            if (!maybeError.IsError()) {
+                maybeError = StartAsync(inferRequest, outputs, callback, userdata);
             }
-            ie_blob_buffer_t outputBuffer;
-            status = ie_blob_get_cbuffer(outputBlob, &outputBuffer);
-            int bufferLength;
-            status = ie_blob_byte_size(outputBlob, &bufferLength);
-            if (output.byteLength >= static_cast<size_t>(bufferLength)) {
-                memcpy(static_cast<int8_t*>(output.buffer) + output.byteOffset,
-                       outputBuffer.cbuffer, bufferLength);
+            if (maybeError.IsError()) {
+                ReleaseInferRequest(inferRequest);
             }
         }
+        if (maybeError.IsError()) {
+            std::unique_ptr<ErrorData> errorData = maybeError.AcquireError();
+            callback(static_cast<WNNErrorType>(ToWNNErrorType(errorData->GetType())),
+                     errorData->GetMessage().c_str(), userdata);
+        }
+    }
 
-        return {};
+    // static
+    void Graph::OnInferRequestCompleted(void* args) {
+        // Called in the thread of the plugin, the callback of the compute is called from it.
+        InferRequest* inferRequest = static_cast<InferRequest*>(args);
+        if (inferRequest->callback == nullptr) {
+            // The request was computed synchronously.
+            return;
+        }
+        // The graph may be freed when its reference is released, which is the last step after
+        // the callback of the compute. The guard is destroyed after the reference.
+        struct CompletingGuard {
+            explicit CompletingGuard(const void* request) {
+                gCompletingInferRequest = request;
+            }
+            ~CompletingGuard() {
+                gCompletingInferRequest = nullptr;
+            }
+        } completingGuard(inferRequest);
+        Ref<Graph> graph = std::move(inferRequest->graph);
+        MaybeError maybeError = graph->GetOutputs(inferRequest, inferRequest->outputs.Get());
+        WNNComputeAsyncCallback callback = inferRequest->callback;
+        void* userdata = inferRequest->userdata;
+        inferRequest->outputs = nullptr;
+        inferRequest->callback = nullptr;
+        inferRequest->userdata = nullptr;
+        // The request is released first, so the callback may compute again.
+        graph->ReleaseInferRequest(inferRequest);
+        if (maybeError.IsError()) {
+            std::unique_ptr<ErrorData> errorData = maybeError.AcquireError();
+            callback(static_cast<WNNErrorType>(ToWNNErrorType(errorData->GetType())),
+                     errorData->GetMessage().c_str(), userdata);
+        } else {
+            callback(WNNErrorType_NoError, "", userdata);
+        }
     }
+
 }  // namespace webnn::native::ie
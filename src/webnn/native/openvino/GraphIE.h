@@ -16,9 +16,16 @@
 #define WEBNN_NATIVE_IE_MODEL_IE_H_
 
 #include <ngraph_c_api.h>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <string>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "webnn/native/Error.h"
 #include "webnn/native/Graph.h"
@@ -81,6 +88,72 @@ namespace webnn::native::ie {
       private:
         MaybeError CompileImpl() override;
         MaybeError ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) override;
+        void ComputeAsyncImpl(NamedInputsBase* inputs,
+                              NamedOutputsBase* outputs,
+                              WNNComputeAsyncCallback callback,
+                              void* userdata) override;
+
+        // The blob of a graph input or output resolved at compile time.
+        struct BlobSlot {
+            std::string name;
+            ie_blob_t* blob = nullptr;
+            void* buffer = nullptr;
+            size_t byteLength = 0;
+        };
+        // The infer request of the pool, the async compute is completed by the callback of
+        // the request.
+        struct InferRequest {
+            ie_infer_request_t* request = nullptr;
+            ie_complete_call_back_t completion;
+            std::vector<BlobSlot> inputSlots;
+            std::vector<BlobSlot> outputSlots;
+            // Keeps the graph alive while the async compute is running, it's released last by
+            // the completion callback.
+            Ref<Graph> graph;
+            Ref<NamedOutputsBase> outputs;
+            WNNComputeAsyncCallback callback = nullptr;
+            void* userdata = nullptr;
+        };
+        // The async compute queued when all requests of the pool are running. The inputs are
+        // copied since the caller may reuse them once ComputeAsync returns.
+        struct PendingCompute {
+            std::map<std::string, std::vector<int8_t>> inputs;
+            Ref<NamedOutputsBase> outputs;
+            WNNComputeAsyncCallback callback = nullptr;
+            void* userdata = nullptr;
+        };
+        // The pairs of the graph name and the network name of the inputs and outputs.
+        using BlobNames = std::vector<std::pair<std::string, std::string>>;
+        MaybeError GetInputBlobNames(BlobNames* inputNames);
+        MaybeError GetOutputBlobNames(BlobNames* outputNames);
+        MaybeError CreateInferRequest(ie_executable_network_t* executableNetwork,
+                                      const BlobNames& inputNames,
+                                      const BlobNames& outputNames);
+        static MaybeError ResolveBlobSlots(ie_infer_request_t* request,
+                                           const BlobNames& names,
+                                           std::vector<BlobSlot>* slots);
+        static void FreeBlobSlots(std::vector<BlobSlot>* slots);
+        // Resolves the blobs of the inputs or the outputs for one compute, the path before the
+        // blobs were cached. It's only used to measure the overhead of the cache.
+        MaybeError ResolveBlobSlotsPerCompute(InferRequest* inferRequest,
+                                              bool inputs,
+                                              std::vector<BlobSlot>* slots);
+        // Waits until a request of the pool is idle, only the sync computes wait.
+        InferRequest* AcquireInferRequest();
+        // Starts the next queued compute on the request, or returns it to the idle requests.
+        void ReleaseInferRequest(InferRequest* inferRequest);
+        MaybeError SetInputs(InferRequest* inferRequest, NamedInputsBase* inputs);
+        void SetInputs(InferRequest* inferRequest,
+                       const std::map<std::string, std::vector<int8_t>>& inputs);
+        MaybeError CopyInputs(NamedInputsBase* inputs,
+                              std::map<std::string, std::vector<int8_t>>* inputData);
+        MaybeError GetOutputs(InferRequest* inferRequest, NamedOutputsBase* outputs);
+        MaybeError StartAsync(InferRequest* inferRequest,
+                              NamedOutputsBase* outputs,
+                              WNNComputeAsyncCallback callback,
+                              void* userdata);
+        static void OnInferRequestCompleted(void* args);
+        static void FreeInferRequest(InferRequest* inferRequest);
 
         // Map the input name to IE internal input number.
         std::map<std::string, size_t> mInputIdMap;
@@ -99,7 +172,16 @@ namespace webnn::native::ie {
         std::vector<ngraph_node_t*> mGraphInputs;
         ie_core_t* mInferEngineCore;
         ie_network_t* mInferEngineNetwork;
-        ie_infer_request_t* mInferEngineRequest;
+        // The requests created from one executable network, the computes of different threads
+        // and the async computes run on the idle requests concurrently.
+        std::vector<std::unique_ptr<InferRequest>> mInferRequests;
+        std::vector<InferRequest*> mIdleInferRequests;
+        std::deque<PendingCompute> mPendingComputes;
+        std::mutex mInferRequestMutex;
+        std::condition_variable mInferRequestCondition;
+        // Set by the WEBNN_OPENVINO_RESOLVE_BLOBS_PER_COMPUTE environment variable, which the
+        // perf tests use to compare the per compute overhead with and without the cache.
+        bool mResolveBlobsPerCompute = false;
     };
 
 }  // namespace webnn::native::ie
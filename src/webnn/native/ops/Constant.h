@@ -45,6 +45,30 @@ namespace webnn::native::op {
             mByteLength = arrayBuffer->byteLength;
         }
 
+        // The constant uses the value at |buffer| in place, |release| is called with |userdata|
+        // once it's destroyed.
+        Constant(GraphBuilderBase* builder,
+                 const OperandDescriptor* desc,
+                 const void* buffer,
+                 size_t byteLength,
+                 void (*release)(void* userdata),
+                 void* userdata)
+            : OperatorBase(builder),
+              mBuffer(nullptr),
+              mByteOffset(0),
+              mRelease(release),
+              mReleaseUserdata(userdata) {
+            if (desc == nullptr || buffer == nullptr) {
+                return;
+            }
+            mDimensions.assign(desc->dimensions, desc->dimensions + desc->dimensionsCount);
+            mDescriptor.dimensions = mDimensions.data();
+            mDescriptor.dimensionsCount = mDimensions.size();
+            mDescriptor.type = desc->type;
+            mBuffer = const_cast<void*>(buffer);
+            mByteLength = byteLength;
+        }
+
 #if defined(WEBNN_ENABLE_GPU_BUFFER)
         Constant(GraphBuilderBase* builder,
                  const OperandDescriptor* desc,
@@ -65,6 +89,10 @@ namespace webnn::native::op {
 #endif
 
         ~Constant() override {
+            if (mRelease != nullptr) {
+                mRelease(mReleaseUserdata);
+                return;
+            }
 #if defined(WEBNN_ENABLE_WIRE)
 #    if defined(WEBNN_ENABLE_GPU_BUFFER)
             if (mWGPUBuffer)
@@ -120,6 +148,8 @@ namespace webnn::native::op {
 #endif
         size_t mByteLength;
         size_t mByteOffset;
+        void (*mRelease)(void* userdata) = nullptr;
+        void* mReleaseUserdata = nullptr;
     };
 
 }  // namespace webnn::native::op
@@ -77,7 +77,12 @@ namespace webnn::native::op {
 
             auto input = mInputs[0];
             auto filter = mInputs[1];
-            if (input->Type() != filter->Type()) {
+            // A quantized int8 or uint8 filter may be consumed by a float32 input (weight-only
+            // quantization) or by a quantized input of a different 8-bit type.
+            bool quantizedFilter = filter->IsQuantized() &&
+                                   (filter->Type() == wnn::OperandType::Int8 ||
+                                    filter->Type() == wnn::OperandType::Uint8);
+            if (input->Type() != filter->Type() && !quantizedFilter) {
                 return DAWN_VALIDATION_ERROR("Argument types are inconsistent.");
             }
             // The input 4-D tensor
@@ -25,8 +25,8 @@ namespace webnn::native::op {
                    OperandBase* input,
                    ReduceOptions const* options)
         : OperatorBase(builder, {input}), mOpType(opType) {
-        // If axes are not present, all dimensions are reduced.
-        if (options == nullptr || options->axes == nullptr) {
+        // If axes are not present or empty, all dimensions are reduced.
+        if (options == nullptr || options->axes == nullptr || options->axesCount == 0) {
             int32_t rank = input->Shape().size();
             mAxes.resize(rank);
             for (auto i = 0; i < rank; ++i) {
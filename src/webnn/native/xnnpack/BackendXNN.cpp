@@ -59,7 +59,7 @@ namespace webnn::native::xnnpack {
             dawn::ErrorLog() << "XNNPACK backend only supports CPU device.";
             return nullptr;
         }
-        Ref<ContextBase> context = AcquireRef(new Context(mThreadpool));
+        Ref<ContextBase> context = AcquireRef(new Context(mThreadpool, options));
         return context.Detach();
     }
 
@@ -22,13 +22,35 @@
 
 namespace webnn::native::xnnpack {
 
-    Context::Context(pthreadpool_t threadpool) : mThreadpool(threadpool) {
+    Context::Context(pthreadpool_t threadpool, ContextOptions const* options)
+        : ContextBase(options), mThreadpool(threadpool) {
+        std::string filePath;
+        const char* cacheDirectory = GetContextOptions().cacheDirectory;
+        if (cacheDirectory != nullptr) {
+            filePath = std::string(cacheDirectory) + "/xnnpack_weights_cache.bin";
+        }
+        mWeightsCache = std::make_unique<WeightsCache>(filePath);
+    }
+
+    Context::~Context() {
+        const uint64_t hits = mWeightsCache->GetHitCount();
+        const uint64_t misses = mWeightsCache->GetMissCount();
+        if (hits + misses != 0) {
+            dawn::InfoLog() << "XNNPACK weights cache: " << hits << " hits, " << misses
+                            << " misses, " << mWeightsCache->GetSize() << " packed weights.";
+        }
+        // The packed weights of all graphs are written to the file once.
+        mWeightsCache->Finalize();
     }
 
     pthreadpool_t Context::GetThreadpool() {
         return mThreadpool;
     }
 
+    WeightsCache* Context::GetWeightsCache() {
+        return mWeightsCache.get();
+    }
+
     GraphBase* Context::CreateGraphImpl() {
         return new Graph(this);
     }
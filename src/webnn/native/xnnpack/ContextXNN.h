@@ -16,6 +16,7 @@
 #define WEBNN_NATIVE_XNNPACK_CONTEXT_XNN_H_
 
 #include "webnn/native/Context.h"
+#include "webnn/native/xnnpack/WeightsCacheXNN.h"
 
 #include <xnnpack.h>
 
@@ -23,15 +24,17 @@ namespace webnn::native::xnnpack {
 
     class Context : public ContextBase {
       public:
-        explicit Context(pthreadpool_t threadpool);
-        ~Context() override = default;
+        Context(pthreadpool_t threadpool, ContextOptions const* options);
+        ~Context() override;
 
         pthreadpool_t GetThreadpool();
+        WeightsCache* GetWeightsCache();
 
       private:
         GraphBase* CreateGraphImpl() override;
 
         pthreadpool_t mThreadpool;
+        std::unique_ptr<WeightsCache> mWeightsCache;
     };
 
 }  // namespace webnn::native::xnnpack
@@ -15,6 +15,7 @@
 #include "webnn/native/xnnpack/GraphXNN.h"
 
 #include <math.h>
+#include <functional>
 #include <numeric>
 
 #include "common/Assert.h"
@@ -23,6 +24,7 @@
 #include "webnn/native/NamedInputs.h"
 #include "webnn/native/NamedOutputs.h"
 #include "webnn/native/Operand.h"
+#include "webnn/native/Utils.h"
 #include "webnn/native/xnnpack/ContextXNN.h"
 
 #define FAILED(status) (((xnn_status)(status)) != xnn_status_success)
@@ -78,28 +80,185 @@ const char* xnn_status2str(xnn_status v) {
 
 namespace webnn::native::xnnpack {
     namespace {
-        xnn_status GetXnnDataType(wnn::OperandType operandType, xnn_datatype& xnnDataType) {
+        xnn_status GetXnnDataType(const OperandBase* operand, xnn_datatype& xnnDataType) {
+            wnn::OperandType operandType = operand->Type();
             if (operandType == wnn::OperandType::Float32) {
                 xnnDataType = xnn_datatype_fp32;
+            } else if (operandType == wnn::OperandType::Float16) {
+                xnnDataType = xnn_datatype_fp16;
+            } else if (operandType == wnn::OperandType::Int8 && operand->IsQuantized()) {
+                // The per-channel quantized int8 is used by the filter of conv2d and gemm.
+                xnnDataType = operand->IsPerChannelQuantized() ? xnn_datatype_qcint8
+                                                               : xnn_datatype_qint8;
+            } else if (operandType == wnn::OperandType::Uint8 && operand->IsQuantized()) {
+                xnnDataType = xnn_datatype_quint8;
+            } else if (operandType == wnn::OperandType::Int32 && operand->IsQuantized()) {
+                // The quantized int32 is used by the bias of conv2d and gemm.
+                xnnDataType = operand->IsPerChannelQuantized() ? xnn_datatype_qcint32
+                                                               : xnn_datatype_qint32;
             } else {
                 return xnn_status_invalid_parameter;
             }
             return xnn_status_success;
         }
+
+        size_t GetByteLength(const OperandBase* operand) {
+            size_t byteLength = 4;
+            switch (operand->Type()) {
+                case wnn::OperandType::Float16:
+                    byteLength = 2;
+                    break;
+                case wnn::OperandType::Int8:
+                case wnn::OperandType::Uint8:
+                    byteLength = 1;
+                    break;
+                default:
+                    break;
+            }
+            for (int32_t d : operand->Shape()) {
+                byteLength *= static_cast<size_t>(d);
+            }
+            return byteLength;
+        }
+
+        std::vector<size_t> GetDims(const std::vector<int32_t>& shape) {
+            std::vector<size_t> dims;
+            for (auto& d : shape) {
+                dims.push_back(static_cast<size_t>(d));
+            }
+            return dims;
+        }
+
+        // The static mean, slice and transpose nodes are newer than the XNNPACK revision in DEPS,
+        // they are only defined when building with webnn_xnnpack_latest_api.
+        xnn_status DefineStaticMean(xnn_subgraph_t subgraph,
+                                    size_t numReductionAxes,
+                                    const size_t* reductionAxes,
+                                    uint32_t inputId,
+                                    uint32_t outputId) {
+#if defined(WEBNN_XNNPACK_LATEST_API)
+            return xnn_define_static_mean(subgraph, numReductionAxes, reductionAxes, inputId,
+                                          outputId, 0);
+#else
+            dawn::ErrorLog() << "The static mean requires building with webnn_xnnpack_latest_api.";
+            return xnn_status_unsupported_parameter;
+#endif
+        }
+
+        xnn_status DefineStaticSlice(xnn_subgraph_t subgraph,
+                                     size_t numDims,
+                                     const size_t* offsets,
+                                     const size_t* sizes,
+                                     uint32_t inputId,
+                                     uint32_t outputId) {
+#if defined(WEBNN_XNNPACK_LATEST_API)
+            return xnn_define_static_slice(subgraph, numDims, offsets, sizes, inputId, outputId,
+                                           0);
+#else
+            dawn::ErrorLog() << "The static slice requires building with webnn_xnnpack_latest_api.";
+            return xnn_status_unsupported_parameter;
+#endif
+        }
+
+        xnn_status DefineStaticTranspose(xnn_subgraph_t subgraph,
+                                         size_t numDims,
+                                         const size_t* perm,
+                                         uint32_t inputId,
+                                         uint32_t outputId) {
+#if defined(WEBNN_XNNPACK_LATEST_API)
+            return xnn_define_static_transpose(subgraph, numDims, perm, inputId, outputId, 0);
+#else
+            dawn::ErrorLog()
+                << "The static transpose requires building with webnn_xnnpack_latest_api.";
+            return xnn_status_unsupported_parameter;
+#endif
+        }
+
+        // The convert node is newer than the XNNPACK revision in DEPS, the fp16 inputs and
+        // outputs are only supported when building with webnn_xnnpack_latest_api.
+        xnn_status DefineConvert(xnn_subgraph_t subgraph, uint32_t inputId, uint32_t outputId) {
+#if defined(WEBNN_XNNPACK_LATEST_API)
+            return xnn_define_convert(subgraph, inputId, outputId, 0);
+#else
+            dawn::ErrorLog() << "The convert requires building with webnn_xnnpack_latest_api.";
+            return xnn_status_unsupported_parameter;
+#endif
+        }
+
+        // The runtimes share the packed weights through the weights cache of the context, which
+        // requires the weights cache provider of webnn_xnnpack_latest_api.
+        xnn_status CreateRuntime(xnn_subgraph_t subgraph,
+                                 WeightsCache* weightsCache,
+                                 pthreadpool_t threadpool,
+                                 uint32_t flags,
+                                 xnn_runtime_t* runtime) {
+#if defined(WEBNN_XNNPACK_LATEST_API)
+            return xnn_create_runtime_v3(subgraph, weightsCache->GetXnnWeightsCache(), threadpool,
+                                         flags, runtime);
+#else
+            return xnn_create_runtime_v2(subgraph, threadpool, flags, runtime);
+#endif
+        }
+
+        float Float16ToFloat32(uint16_t value) {
+            uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+            uint32_t exponent = (value >> 10) & 0x1f;
+            uint32_t mantissa = value & 0x3ff;
+            uint32_t bits;
+            if (exponent == 0x1f) {
+                // Infinity or NaN.
+                bits = sign | 0x7f800000 | (mantissa << 13);
+            } else if (exponent != 0) {
+                bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+            } else if (mantissa == 0) {
+                bits = sign;
+            } else {
+                // Normalize the subnormal value.
+                exponent = 113;
+                while ((mantissa & 0x400) == 0) {
+                    mantissa <<= 1;
+                    --exponent;
+                }
+                bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+            }
+            float result;
+            memcpy(&result, &bits, sizeof(result));
+            return result;
+        }
+
+        std::vector<float> GetFloatData(const op::Constant* constant) {
+            if (constant->PrimaryOutput()->Type() == wnn::OperandType::Float16) {
+                const uint16_t* data = static_cast<const uint16_t*>(constant->GetBuffer());
+                std::vector<float> result(constant->GetByteLength() / sizeof(uint16_t));
+                for (size_t i = 0; i < result.size(); ++i) {
+                    result[i] = Float16ToFloat32(data[i]);
+                }
+                return result;
+            }
+            const float* data = static_cast<const float*>(constant->GetBuffer());
+            return std::vector<float>(data, data + constant->GetByteLength() / sizeof(float));
+        }
     }  // anonymous namespace
 
     Graph::Graph(Context* context)
         : GraphBase(context),
           mExternalId(0),
-          mRuntime(nullptr),
-          mNamedInputs(nullptr),
-          mNamedOutputs(nullptr) {
+          mSubgraph(nullptr),
+          mRuntimeFlags(0),
+          mRuntime(nullptr) {
     }
 
     Graph::~Graph() {
         if (mRuntime) {
             xnn_delete_runtime(mRuntime);
         }
+        for (auto& bufferSet : mBufferSets) {
+            xnn_delete_runtime(bufferSet.second.runtime);
+        }
+        if (mSubgraph) {
+            xnn_delete_subgraph(mSubgraph);
+        }
+        UnregisterBuffers();
     }
 
     MaybeError Graph::AddInput(const op::Input* input) {
@@ -108,6 +267,13 @@ namespace webnn::native::xnnpack {
         mInputs.insert(std::make_pair(input->PrimaryOutput(), inputId));
         xnn_external_value externalValue = {inputId, nullptr};
         mExternals.insert(std::make_pair(input->GetName(), externalValue));
+        mExternalByteLengths[input->GetName()] = GetByteLength(input->PrimaryOutput());
+        return {};
+    }
+
+    MaybeError Graph::AddConstant(const op::Constant* constant) {
+        mOperators.push_back({OperatorType::Constant, constant});
+        mConstants.insert(std::make_pair(constant->PrimaryOutput(), constant));
         return {};
     }
 
@@ -116,6 +282,7 @@ namespace webnn::native::xnnpack {
         mOutputs.insert(std::make_pair(op, outputId));
         xnn_external_value externalValue = {outputId, nullptr};
         mExternals.insert(std::make_pair(name, externalValue));
+        mExternalByteLengths[std::string(name)] = GetByteLength(op);
         return {};
     }
 
@@ -125,17 +292,23 @@ namespace webnn::native::xnnpack {
         return {};                                        \
     }
 
+    GRAPH_ADD_OP(BatchNorm)
     GRAPH_ADD_OP(Binary)
     GRAPH_ADD_OP(Clamp)
     GRAPH_ADD_OP(Concat)
     GRAPH_ADD_OP(Conv2d)
-    GRAPH_ADD_OP(Constant)
+    GRAPH_ADD_OP(ConvTranspose2d)
     GRAPH_ADD_OP(Gemm)
+    GRAPH_ADD_OP(InstanceNorm)
     GRAPH_ADD_OP(Pad)
     GRAPH_ADD_OP(Pool2d)
+    GRAPH_ADD_OP(Reduce)
+    GRAPH_ADD_OP(Resample2d)
     GRAPH_ADD_OP(Reshape)
+    GRAPH_ADD_OP(Slice)
     GRAPH_ADD_OP(Split)
     GRAPH_ADD_OP(Squeeze)
+    GRAPH_ADD_OP(Transpose)
     GRAPH_ADD_OP(Unary)
 
     xnn_status Graph::DefineXnnTensorValue(xnn_subgraph_t subgraph,
@@ -143,14 +316,11 @@ namespace webnn::native::xnnpack {
                                            uint32_t* id,
                                            const void* data) {
         xnn_datatype datatype = xnn_datatype_invalid;
-        if (GetXnnDataType(operand->Type(), datatype) != xnn_status_success) {
+        if (GetXnnDataType(operand, datatype) != xnn_status_success) {
             // Ignore the unsupproted data type, it may be used for attributes, such as padding
             return xnn_status_success;
         }
-        std::vector<size_t> dims;
-        for (auto& d : operand->Shape()) {
-            dims.push_back(static_cast<size_t>(d));
-        }
+        std::vector<size_t> dims = GetDims(operand->Shape());
         uint32_t flags = 0;
         uint32_t externalId;
         if (mInputs.find(operand) != mInputs.end()) {
@@ -162,14 +332,139 @@ namespace webnn::native::xnnpack {
         } else {
             externalId = XNN_INVALID_VALUE_ID;
         }
-        XNN_TRY(xnn_define_tensor_value(subgraph, datatype, dims.size(), dims.data(), data,
-                                        externalId, flags, id));
+        if (datatype == xnn_datatype_fp16) {
+            // The nodes are defined in fp32 and the runtime rewrites them to fp16 if the
+            // precision hint allows. So the fp16 constant is converted to fp32 and the fp16
+            // external input and output are converted by nodes.
+            if (externalId == XNN_INVALID_VALUE_ID) {
+                std::vector<float> fp32Data;
+                if (data != nullptr) {
+                    const uint16_t* fp16Data = static_cast<const uint16_t*>(data);
+                    fp32Data.resize(std::accumulate(dims.begin(), dims.end(), 1,
+                                                    std::multiplies<size_t>()));
+                    for (size_t i = 0; i < fp32Data.size(); ++i) {
+                        fp32Data[i] = Float16ToFloat32(fp16Data[i]);
+                    }
+                }
+                XNN_TRY(DefineXnnInternalValue(subgraph, dims, id,
+                                               data != nullptr ? fp32Data.data() : nullptr));
+            } else {
+                uint32_t externalValueId;
+                XNN_TRY(xnn_define_tensor_value(subgraph, datatype, dims.size(), dims.data(),
+                                                nullptr, externalId, flags, &externalValueId));
+                XNN_TRY(DefineXnnInternalValue(subgraph, dims, id));
+                if (flags & XNN_VALUE_FLAG_EXTERNAL_INPUT) {
+                    XNN_TRY(DefineConvert(subgraph, externalValueId, *id));
+                } else {
+                    mFp16Outputs.push_back(std::make_pair(*id, externalValueId));
+                }
+            }
+        } else if (datatype == xnn_datatype_qcint8 || datatype == xnn_datatype_qcint32) {
+            for (auto zeroPoint : operand->ZeroPoints()) {
+                if (zeroPoint != 0) {
+                    dawn::ErrorLog() << "XNNPACK backend only supports symmetric per-channel "
+                                        "quantization.";
+                    return xnn_status_invalid_parameter;
+                }
+            }
+            // XNNPACK keeps the pointer of scales, copy them to the graph.
+            mChannelScales.push_back(operand->Scales());
+            XNN_TRY(xnn_define_channelwise_quantized_tensor_value(
+                subgraph, datatype, mChannelScales.back().data(), dims.size(),
+                operand->QuantizationAxis(), dims.data(), data, externalId, flags, id));
+        } else if (operand->IsQuantized()) {
+            XNN_TRY(xnn_define_quantized_tensor_value(
+                subgraph, datatype, operand->ZeroPoints()[0], operand->Scales()[0], dims.size(),
+                dims.data(), data, externalId, flags, id));
+        } else {
+            XNN_TRY(xnn_define_tensor_value(subgraph, datatype, dims.size(), dims.data(), data,
+                                            externalId, flags, id));
+        }
         mOperands.insert(std::make_pair(operand, *id));
         return xnn_status_success;
     }
 
+    xnn_status Graph::DefineXnnInternalValue(xnn_subgraph_t subgraph,
+                                             const std::vector<size_t>& dims,
+                                             uint32_t* id,
+                                             const float* data) {
+        const void* buffer = nullptr;
+        if (data != nullptr) {
+            size_t byteLength = sizeof(float) * std::accumulate(dims.begin(), dims.end(), 1,
+                                                                std::multiplies<size_t>());
+            std::unique_ptr<char[]> copy(new char[byteLength]);
+            memcpy(copy.get(), data, byteLength);
+            buffer = copy.get();
+            GetWeightsCache()->RegisterBuffer(buffer, byteLength, dims);
+            mBuffers.push_back(std::move(copy));
+        }
+        XNN_TRY(xnn_define_tensor_value(subgraph, xnn_datatype_fp32, dims.size(), dims.data(),
+                                        buffer, XNN_INVALID_VALUE_ID, 0, id));
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineXnnActivation(xnn_subgraph_t subgraph,
+                                          const FusionOperatorBase* activation,
+                                          uint32_t inputId,
+                                          uint32_t outputId) {
+        switch (activation->GetFusionType()) {
+            case FusionType::HardSwish:
+                XNN_TRY(xnn_define_hardswish(subgraph, inputId, outputId, 0));
+                break;
+            case FusionType::LeakyRelu:
+                XNN_TRY(xnn_define_leaky_relu(
+                    subgraph, reinterpret_cast<const op::FusionLeakyRelu*>(activation)->GetAlpha(),
+                    inputId, outputId, 0));
+                break;
+            case FusionType::Sigmoid:
+                XNN_TRY(xnn_define_sigmoid(subgraph, inputId, outputId, 0));
+                break;
+            default:
+                dawn::ErrorLog() << "XNNPACK backend doesn't support fused operator "
+                                 << static_cast<int>(activation->GetFusionType());
+                return xnn_status_invalid_parameter;
+        }
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineXnnFusedOutput(xnn_subgraph_t subgraph,
+                                           const FusionOperatorBase* activation,
+                                           const OperandBase* output,
+                                           uint32_t* outputId,
+                                           uint32_t* opOutputId,
+                                           float* outputMin,
+                                           float* outputMax) {
+        *outputMin = -std::numeric_limits<float>::infinity();
+        *outputMax = +std::numeric_limits<float>::infinity();
+        XNN_TRY(DefineXnnTensorValue(subgraph, output, outputId));
+        *opOutputId = *outputId;
+        if (activation == nullptr) {
+            return xnn_status_success;
+        }
+        switch (activation->GetFusionType()) {
+            case FusionType::Clamp: {
+                auto clamp = reinterpret_cast<const op::FusionClamp*>(activation);
+                *outputMin = clamp->GetMinValue();
+                *outputMax = clamp->GetMaxValue();
+                break;
+            }
+            case FusionType::Relu:
+                *outputMin = 0.0f;
+                break;
+            default:
+                XNN_TRY(DefineXnnInternalValue(subgraph, GetDims(output->Shape()), opOutputId));
+                break;
+        }
+        return xnn_status_success;
+    }
+
+    const op::Constant* Graph::GetConstant(const OperandBase* operand) const {
+        auto iter = mConstants.find(operand);
+        return iter != mConstants.end() ? iter->second : nullptr;
+    }
+
     xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Constant* constant) {
-        std::unique_ptr<char> buffer(new char[constant->GetByteLength()]);
+        std::unique_ptr<char[]> buffer(new char[constant->GetByteLength()]);
         if (buffer.get() == nullptr) {
             return xnn_status_out_of_memory;
         }
@@ -177,6 +472,8 @@ namespace webnn::native::xnnpack {
         uint32_t id;
         XNN_TRY(DefineXnnTensorValue(subgraph, constant->PrimaryOutput(), &id, buffer.get()));
         mOperands.insert(std::make_pair(constant->PrimaryOutput(), id));
+        GetWeightsCache()->RegisterBuffer(buffer.get(), constant->GetByteLength(),
+                                          GetDims(constant->PrimaryOutput()->Shape()));
         mBuffers.push_back(std::move(buffer));
         return xnn_status_success;
     }
@@ -189,6 +486,69 @@ namespace webnn::native::xnnpack {
         return xnn_status_success;
     }
 
+    xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::BatchNorm* batchNorm) {
+        auto inputOperands = batchNorm->Inputs();
+        DAWN_ASSERT(inputOperands.size() >= 3 && inputOperands.size() <= 5);
+        auto inputOperand = inputOperands[0].Get();
+        DAWN_ASSERT(mOperands.find(inputOperand) != mOperands.end());
+        uint32_t inputId = mOperands.at(inputOperand);
+        const BatchNormOptions* options = batchNorm->GetOptions();
+        // The mean, variance, scale and bias are folded into a multiplier and an offset per
+        // channel, so they must be constants.
+        const op::Constant* mean = GetConstant(inputOperands[1].Get());
+        const op::Constant* variance = GetConstant(inputOperands[2].Get());
+        const op::Constant* scale = nullptr;
+        const op::Constant* bias = nullptr;
+        size_t index = 3;
+        bool isConstant = mean != nullptr && variance != nullptr;
+        if (options->scale != nullptr) {
+            scale = GetConstant(inputOperands[index++].Get());
+            isConstant = isConstant && scale != nullptr;
+        }
+        if (options->bias != nullptr) {
+            bias = GetConstant(inputOperands[index++].Get());
+            isConstant = isConstant && bias != nullptr;
+        }
+        if (!isConstant) {
+            dawn::ErrorLog() << "XNNPACK backend only supports constant mean, variance, scale and "
+                                "bias for batchNorm.";
+            return xnn_status_invalid_parameter;
+        }
+        auto inputShape = inputOperand->Shape();
+        size_t channels = inputShape[options->axis];
+        std::vector<float> meanData = GetFloatData(mean);
+        std::vector<float> varianceData = GetFloatData(variance);
+        std::vector<float> scaleData = scale ? GetFloatData(scale) : std::vector<float>();
+        std::vector<float> biasData = bias ? GetFloatData(bias) : std::vector<float>();
+        std::vector<float> multiplier(channels), offset(channels);
+        for (size_t c = 0; c < channels; ++c) {
+            float scaleValue = scale ? scaleData[c] : 1.0f;
+            float biasValue = bias ? biasData[c] : 0.0f;
+            multiplier[c] = scaleValue / sqrt(varianceData[c] + options->epsilon);
+            offset[c] = biasValue - meanData[c] * multiplier[c];
+        }
+        // The multiplier and offset are broadcast to the input by the trailing dimensions.
+        std::vector<size_t> paramDims(inputShape.size() - options->axis, 1);
+        paramDims[0] = channels;
+        uint32_t multiplierId, offsetId, scaledId;
+        XNN_TRY(DefineXnnInternalValue(subgraph, paramDims, &multiplierId, multiplier.data()));
+        XNN_TRY(DefineXnnInternalValue(subgraph, paramDims, &offsetId, offset.data()));
+        XNN_TRY(DefineXnnInternalValue(subgraph, GetDims(inputShape), &scaledId));
+        float outputMin, outputMax;
+        uint32_t outputId, addOutputId;
+        XNN_TRY(DefineXnnFusedOutput(subgraph, options->activation, batchNorm->PrimaryOutput(),
+                                     &outputId, &addOutputId, &outputMin, &outputMax));
+        XNN_TRY(xnn_define_multiply2(subgraph, -std::numeric_limits<float>::infinity(),
+                                     +std::numeric_limits<float>::infinity(), inputId,
+                                     multiplierId, scaledId, 0));
+        XNN_TRY(xnn_define_add2(subgraph, outputMin, outputMax, scaledId, offsetId, addOutputId,
+                                0));
+        if (addOutputId != outputId) {
+            XNN_TRY(DefineXnnActivation(subgraph, options->activation, addOutputId, outputId));
+        }
+        return xnn_status_success;
+    }
+
     xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Binary* binary) {
         DAWN_ASSERT(binary->Inputs().size() == 2);
         const OperandBase* input0Operand = binary->Inputs()[0].Get();
@@ -258,21 +618,48 @@ namespace webnn::native::xnnpack {
     xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Concat* concat) {
         auto inputOperands = concat->Inputs();
         DAWN_ASSERT(inputOperands.size() >= 1);
-        if (inputOperands.size() > 4) {
-            dawn::ErrorLog() << "XNNPACK backend doesn't support concat inputs size "
-                             << inputOperands.size();
-            return xnn_status_invalid_parameter;
-        }
         std::vector<uint32_t> inputIds(inputOperands.size());
+        std::vector<size_t> axisSizes(inputOperands.size());
+        size_t axis = concat->GetAxis();
         for (size_t i = 0; i < inputOperands.size(); ++i) {
             DAWN_ASSERT(mOperands.find(inputOperands[i].Get()) != mOperands.end());
             inputIds[i] = mOperands.at(inputOperands[i].Get());
+            axisSizes[i] = inputOperands[i]->Shape()[axis];
         }
         auto outputOperand = concat->PrimaryOutput();
         uint32_t outputId;
         XNN_TRY(DefineXnnTensorValue(subgraph, outputOperand, &outputId));
-        size_t axis = concat->GetAxis();
-        switch (concat->Inputs().size()) {
+        // XNNPACK concatenates at most 4 values in one node, the leading 4 inputs are
+        // concatenated into an internal value until no more than 4 inputs are left.
+        std::vector<size_t> dims = GetDims(outputOperand->Shape());
+        while (inputIds.size() > 4) {
+            dims[axis] = axisSizes[0] + axisSizes[1] + axisSizes[2] + axisSizes[3];
+            uint32_t concatId;
+            if (outputOperand->IsQuantized()) {
+                // The quantized inputs and output of concat share the quantization params.
+                xnn_datatype datatype;
+                XNN_TRY(GetXnnDataType(outputOperand, datatype));
+                XNN_TRY(xnn_define_quantized_tensor_value(
+                    subgraph, datatype, outputOperand->ZeroPoints()[0],
+                    outputOperand->Scales()[0], dims.size(), dims.data(), nullptr,
+                    XNN_INVALID_VALUE_ID, 0, &concatId));
+            } else {
+                XNN_TRY(DefineXnnInternalValue(subgraph, dims, &concatId));
+            }
+            XNN_TRY(xnn_define_concatenate4(subgraph, axis, inputIds[0], inputIds[1], inputIds[2],
+                                            inputIds[3], concatId, 0));
+            inputIds.erase(inputIds.begin() + 1, inputIds.begin() + 4);
+            inputIds[0] = concatId;
+            axisSizes.erase(axisSizes.begin() + 1, axisSizes.begin() + 4);
+            axisSizes[0] = dims[axis];
+        }
+        switch (inputIds.size()) {
+            case 1:
+                // Concat of a single input is a copy.
+                dims = GetDims(outputOperand->Shape());
+                XNN_TRY(xnn_define_static_reshape(subgraph, dims.size(), dims.data(), inputIds[0],
+                                                  outputId, 0));
+                break;
             case 2:
                 XNN_TRY(
                     xnn_define_concatenate2(subgraph, axis, inputIds[0], inputIds[1], outputId, 0));
@@ -286,9 +673,7 @@ namespace webnn::native::xnnpack {
                                                 inputIds[2], inputIds[3], outputId, 0));
                 break;
             default:
-                dawn::ErrorLog() << "XNNPACK backend doesn't support concat inputs size "
-                                 << inputOperands.size();
-                return xnn_status_invalid_parameter;
+                UNREACHABLE();
         }
         return xnn_status_success;
     }
@@ -380,39 +765,99 @@ namespace webnn::native::xnnpack {
             }
         }
 
-        float outputMin = -std::numeric_limits<float>::infinity();
-        float outputMax = +std::numeric_limits<float>::infinity();
-        if (options->activation) {
-            switch (options->activation->GetFusionType()) {
-                case FusionType::Clamp: {
-                    auto clamp = reinterpret_cast<const op::FusionClamp*>(options->activation);
-                    outputMin = clamp->GetMinValue();
-                    outputMax = clamp->GetMaxValue();
-                    break;
-                }
-                case FusionType::Relu:
-                    outputMin = 0.0f;
-                    outputMax = std::numeric_limits<float>::infinity();
-                    break;
-                default:
-                    dawn::ErrorLog() << "XNNPACK backend doesn't support fused operator "
-                                     << static_cast<int>(options->activation->GetFusionType());
-                    return xnn_status_invalid_parameter;
-            }
-        }
-        uint32_t outputId;
-        XNN_TRY(DefineXnnTensorValue(subgraph, outputOperand, &outputId));
+        float outputMin, outputMax;
+        uint32_t outputId, convOutputId;
+        XNN_TRY(DefineXnnFusedOutput(subgraph, options->activation, outputOperand, &outputId,
+                                     &convOutputId, &outputMin, &outputMax));
         if (depthwise) {
             XNN_TRY(xnn_define_depthwise_convolution_2d(
                 subgraph, padTop, padRight, padBottom, padLeft, filterHeight, filterWidth,
                 strideHeight, strideWidth, dilationHeight, dilationWidth, 1, inputChannels,
-                outputMin, outputMax, inputId, filterId, biasId, outputId, 0));
+                outputMin, outputMax, inputId, filterId, biasId, convOutputId, 0));
         } else {
-            XNN_TRY(xnn_define_convolution_2d(subgraph, padTop, padRight, padBottom, padLeft,
-                                              filterHeight, filterWidth, strideHeight, strideWidth,
-                                              dilationHeight, dilationWidth, groups,
-                                              groupInputChannels, groupOutputChannels, outputMin,
-                                              outputMax, inputId, filterId, biasId, outputId, 0));
+            XNN_TRY(xnn_define_convolution_2d(
+                subgraph, padTop, padRight, padBottom, padLeft, filterHeight, filterWidth,
+                strideHeight, strideWidth, dilationHeight, dilationWidth, groups,
+                groupInputChannels, groupOutputChannels, outputMin, outputMax, inputId, filterId,
+                biasId, convOutputId, 0));
+        }
+        if (convOutputId != outputId) {
+            XNN_TRY(DefineXnnActivation(subgraph, options->activation, convOutputId, outputId));
+        }
+        mConv2ds.push_back(conv2d);
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph,
+                                    const op::ConvTranspose2d* convTranspose2d) {
+        auto inputOperands = convTranspose2d->Inputs();
+        DAWN_ASSERT(inputOperands.size() == 2 || inputOperands.size() == 3);
+        auto inputOperand = inputOperands[0].Get();
+        DAWN_ASSERT(mOperands.find(inputOperand) != mOperands.end());
+        uint32_t inputId = mOperands.at(inputOperand);
+        auto filterOperand = inputOperands[1].Get();
+        DAWN_ASSERT(mOperands.find(filterOperand) != mOperands.end());
+        uint32_t filterId = mOperands.at(filterOperand);
+        uint32_t biasId = XNN_INVALID_VALUE_ID;
+        if (inputOperands.size() == 3) {
+            DAWN_ASSERT(mOperands.find(inputOperands[2].Get()) != mOperands.end());
+            biasId = mOperands.at(inputOperands[2].Get());
+        }
+        auto outputOperand = convTranspose2d->PrimaryOutput();
+
+        const ConvTranspose2dOptions* options = convTranspose2d->GetOptions();
+        if (options->inputLayout != wnn::InputOperandLayout::Nhwc) {
+            dawn::ErrorLog() << "XNNPACK backend only supports input layout nhwc.";
+            return xnn_status_invalid_parameter;
+        }
+        // xnn pack expects deconvolution weights layed out like (ohwi):
+        //   [groups * group_output_channels, kernel_height, kernel_width, group_input_channels]
+        if (options->filterLayout != wnn::ConvTranspose2dFilterOperandLayout::Ohwi) {
+            dawn::ErrorLog()
+                << "XNNPACK backend only supports filter layout ohwi for convTranspose2d.";
+            return xnn_status_invalid_parameter;
+        }
+        uint32_t groups = options->groups;
+        int32_t strideHeight = options->strides[0];
+        int32_t strideWidth = options->strides[1];
+        int32_t dilationHeight = options->dilations[0];
+        int32_t dilationWidth = options->dilations[1];
+        int32_t inputHeight = inputOperand->Shape()[1];
+        int32_t inputWidth = inputOperand->Shape()[2];
+        int32_t filterHeight = filterOperand->Shape()[1];
+        int32_t filterWidth = filterOperand->Shape()[2];
+        // The channels of each group are derived from the input and output instead of the
+        // filter, the ohwi filter holds [output_channels, height, width, input_channels / groups].
+        size_t groupInputChannels = inputOperand->Shape()[3] / groups;
+        size_t groupOutputChannels = outputOperand->Shape()[3] / groups;
+        // WebNN padding: [beginning_height, ending_height, beginning_width, ending_width]
+        std::vector<int32_t> padding =
+            options->autoPad == wnn::AutoPad::Explicit
+                ? std::vector<int32_t>(options->padding, options->padding + options->paddingCount)
+                : utils::ComputeImplicitPaddingForConvTranspose2dAutoPad<int32_t>(
+                      options, {inputHeight, inputWidth}, {filterHeight, filterWidth});
+        // The adjustment is the extra size of the output in the ending height and width, it's
+        // computed from the output shape which is inferred from output padding or output sizes.
+        int32_t adjustmentHeight =
+            outputOperand->Shape()[1] - (strideHeight * (inputHeight - 1) +
+                                         (filterHeight - 1) * dilationHeight + 1 - padding[0] -
+                                         padding[1]);
+        int32_t adjustmentWidth =
+            outputOperand->Shape()[2] - (strideWidth * (inputWidth - 1) +
+                                         (filterWidth - 1) * dilationWidth + 1 - padding[2] -
+                                         padding[3]);
+
+        float outputMin, outputMax;
+        uint32_t outputId, deconvOutputId;
+        XNN_TRY(DefineXnnFusedOutput(subgraph, options->activation, outputOperand, &outputId,
+                                     &deconvOutputId, &outputMin, &outputMax));
+        XNN_TRY(xnn_define_deconvolution_2d(
+            subgraph, padding[0], padding[3], padding[1], padding[2], adjustmentHeight,
+            adjustmentWidth, filterHeight, filterWidth, strideHeight, strideWidth, dilationHeight,
+            dilationWidth, groups, groupInputChannels, groupOutputChannels, outputMin, outputMax,
+            inputId, filterId, biasId, deconvOutputId, 0));
+        if (deconvOutputId != outputId) {
+            XNN_TRY(DefineXnnActivation(subgraph, options->activation, deconvOutputId, outputId));
         }
         return xnn_status_success;
     }
@@ -456,6 +901,79 @@ namespace webnn::native::xnnpack {
         return xnn_status_success;
     }
 
+    xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph,
+                                    const op::InstanceNorm* instanceNorm) {
+        auto inputOperands = instanceNorm->Inputs();
+        DAWN_ASSERT(inputOperands.size() >= 1 && inputOperands.size() <= 3);
+        const InstanceNormOptions* options = instanceNorm->GetOptions();
+        if (options->layout != wnn::InputOperandLayout::Nhwc) {
+            dawn::ErrorLog() << "XNNPACK backend only supports layout nhwc for instanceNorm.";
+            return xnn_status_invalid_parameter;
+        }
+        auto inputOperand = inputOperands[0].Get();
+        DAWN_ASSERT(mOperands.find(inputOperand) != mOperands.end());
+        uint32_t inputId = mOperands.at(inputOperand);
+        size_t index = 1;
+        uint32_t scaleId = XNN_INVALID_VALUE_ID;
+        if (options->scale != nullptr) {
+            DAWN_ASSERT(mOperands.find(inputOperands[index].Get()) != mOperands.end());
+            scaleId = mOperands.at(inputOperands[index++].Get());
+        }
+        uint32_t biasId = XNN_INVALID_VALUE_ID;
+        if (options->bias != nullptr) {
+            DAWN_ASSERT(mOperands.find(inputOperands[index].Get()) != mOperands.end());
+            biasId = mOperands.at(inputOperands[index++].Get());
+        }
+        uint32_t outputId;
+        XNN_TRY(DefineXnnTensorValue(subgraph, instanceNorm->PrimaryOutput(), &outputId));
+
+        // instanceNorm = scale * (input - mean) / sqrt(variance + epsilon) + bias, where the mean
+        // and variance are computed over the spatial dimensions.
+        const float outputMin = -std::numeric_limits<float>::infinity();
+        const float outputMax = +std::numeric_limits<float>::infinity();
+        const size_t spatialAxes[2] = {1, 2};
+        std::vector<size_t> dims = GetDims(inputOperand->Shape());
+        std::vector<size_t> reducedDims = {dims[0], 1, 1, dims[3]};
+        uint32_t meanId, centeredId, squareId, varianceId, epsilonId, shiftedId, stddevId;
+        XNN_TRY(DefineXnnInternalValue(subgraph, reducedDims, &meanId));
+        XNN_TRY(DefineStaticMean(subgraph, 2, spatialAxes, inputId, meanId));
+        XNN_TRY(DefineXnnInternalValue(subgraph, dims, &centeredId));
+        XNN_TRY(xnn_define_subtract(subgraph, outputMin, outputMax, inputId, meanId, centeredId,
+                                    0));
+        XNN_TRY(DefineXnnInternalValue(subgraph, dims, &squareId));
+        XNN_TRY(xnn_define_square(subgraph, centeredId, squareId, 0));
+        XNN_TRY(DefineXnnInternalValue(subgraph, reducedDims, &varianceId));
+        XNN_TRY(DefineStaticMean(subgraph, 2, spatialAxes, squareId, varianceId));
+        float epsilon = options->epsilon;
+        XNN_TRY(DefineXnnInternalValue(subgraph, {1}, &epsilonId, &epsilon));
+        XNN_TRY(DefineXnnInternalValue(subgraph, reducedDims, &shiftedId));
+        XNN_TRY(xnn_define_add2(subgraph, outputMin, outputMax, varianceId, epsilonId, shiftedId,
+                                0));
+        XNN_TRY(DefineXnnInternalValue(subgraph, reducedDims, &stddevId));
+        XNN_TRY(xnn_define_square_root(subgraph, shiftedId, stddevId, 0));
+
+        uint32_t normalizedId = outputId;
+        if (scaleId != XNN_INVALID_VALUE_ID || biasId != XNN_INVALID_VALUE_ID) {
+            XNN_TRY(DefineXnnInternalValue(subgraph, dims, &normalizedId));
+        }
+        XNN_TRY(xnn_define_divide(subgraph, outputMin, outputMax, centeredId, stddevId,
+                                  normalizedId, 0));
+        if (scaleId != XNN_INVALID_VALUE_ID) {
+            uint32_t scaledId = outputId;
+            if (biasId != XNN_INVALID_VALUE_ID) {
+                XNN_TRY(DefineXnnInternalValue(subgraph, dims, &scaledId));
+            }
+            XNN_TRY(xnn_define_multiply2(subgraph, outputMin, outputMax, normalizedId, scaleId,
+                                         scaledId, 0));
+            normalizedId = scaledId;
+        }
+        if (biasId != XNN_INVALID_VALUE_ID) {
+            XNN_TRY(xnn_define_add2(subgraph, outputMin, outputMax, normalizedId, biasId, outputId,
+                                    0));
+        }
+        return xnn_status_success;
+    }
+
     xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Pad* pad) {
         auto inputOperands = pad->Inputs();
         DAWN_ASSERT(inputOperands.size() == 2);
@@ -575,6 +1093,91 @@ namespace webnn::native::xnnpack {
         return xnn_status_success;
     }
 
+    xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Reduce* reduce) {
+        DAWN_ASSERT(reduce->Inputs().size() == 1);
+        auto inputOperand = reduce->Inputs()[0].Get();
+        DAWN_ASSERT(mOperands.find(inputOperand) != mOperands.end());
+        uint32_t inputId = mOperands.at(inputOperand);
+        op::ReduceType type = reduce->GetType();
+        if (type != op::ReduceType::kReduceMean && type != op::ReduceType::kReduceSum) {
+            dawn::ErrorLog() << "XNNPACK backend doesn't support reduce op "
+                             << static_cast<int>(type);
+            return xnn_status_unsupported_parameter;
+        }
+        const ReduceOptions* options = reduce->GetOptions();
+        std::vector<size_t> reducedDims = GetDims(inputOperand->Shape());
+        std::vector<size_t> axes;
+        if (options->axesCount == 0) {
+            // All dimensions are reduced if the axes are empty.
+            axes.resize(reducedDims.size());
+            std::iota(axes.begin(), axes.end(), 0);
+        }
+        for (uint32_t i = 0; i < options->axesCount; ++i) {
+            int32_t axis = options->axes[i];
+            axes.push_back(axis < 0 ? axis + reducedDims.size() : axis);
+        }
+        size_t reducedSize = 1;
+        for (auto axis : axes) {
+            reducedSize *= reducedDims[axis];
+            reducedDims[axis] = 1;
+        }
+        auto outputOperand = reduce->PrimaryOutput();
+        uint32_t outputId;
+        XNN_TRY(DefineXnnTensorValue(subgraph, outputOperand, &outputId));
+
+        // The mean keeps the reduced dimensions, the sum is the mean multiplied by the count of
+        // the reduced elements, and the reduced dimensions are removed by a reshape at last.
+        bool isSum = type == op::ReduceType::kReduceSum;
+        bool needsReshape = !options->keepDimensions;
+        uint32_t meanId = outputId;
+        if (isSum || needsReshape) {
+            XNN_TRY(DefineXnnInternalValue(subgraph, reducedDims, &meanId));
+        }
+        XNN_TRY(DefineStaticMean(subgraph, axes.size(), axes.data(), inputId, meanId));
+        uint32_t resultId = meanId;
+        if (isSum) {
+            float count = static_cast<float>(reducedSize);
+            uint32_t countId;
+            XNN_TRY(DefineXnnInternalValue(subgraph, {1}, &countId, &count));
+            resultId = outputId;
+            if (needsReshape) {
+                XNN_TRY(DefineXnnInternalValue(subgraph, reducedDims, &resultId));
+            }
+            XNN_TRY(xnn_define_multiply2(subgraph, -std::numeric_limits<float>::infinity(),
+                                         +std::numeric_limits<float>::infinity(), meanId, countId,
+                                         resultId, 0));
+        }
+        if (needsReshape) {
+            std::vector<size_t> newSizes = GetDims(outputOperand->Shape());
+            XNN_TRY(xnn_define_static_reshape(subgraph, newSizes.size(), newSizes.data(),
+                                              resultId, outputId, 0));
+        }
+        return xnn_status_success;
+    }
+
+    xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Resample2d* resample2d) {
+        DAWN_ASSERT(resample2d->Inputs().size() == 1);
+        auto inputOperand = resample2d->Inputs()[0].Get();
+        DAWN_ASSERT(mOperands.find(inputOperand) != mOperands.end());
+        uint32_t inputId = mOperands.at(inputOperand);
+        if (resample2d->GetOptions()->mode != wnn::InterpolationMode::Linear) {
+            dawn::ErrorLog() << "XNNPACK backend only supports linear mode for resample2d.";
+            return xnn_status_invalid_parameter;
+        }
+        std::vector<int32_t> axes = resample2d->GetAxes();
+        if (axes.size() != 2 || axes[0] != 1 || axes[1] != 2) {
+            dawn::ErrorLog() << "XNNPACK backend only supports resample2d along axes [1, 2].";
+            return xnn_status_invalid_parameter;
+        }
+        auto outputOperand = resample2d->PrimaryOutput();
+        uint32_t outputId;
+        XNN_TRY(DefineXnnTensorValue(subgraph, outputOperand, &outputId));
+        XNN_TRY(xnn_define_static_resize_bilinear_2d(subgraph, outputOperand->Shape()[1],
+                                                     outputOperand->Shape()[2], inputId,
+                                                     outputId, 0));
+        return xnn_status_success;
+    }
+
     xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Reshape* reshape) {
         DAWN_ASSERT(reshape->Inputs().size() == 1);
         auto inputOperand = reshape->Inputs()[0].Get();
@@ -596,21 +1199,41 @@ namespace webnn::native::xnnpack {
         return xnn_status_success;
     }
 
+    xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Slice* slice) {
+        DAWN_ASSERT(slice->Inputs().size() == 1);
+        auto inputOperand = slice->Inputs()[0].Get();
+        DAWN_ASSERT(mOperands.find(inputOperand) != mOperands.end());
+        uint32_t inputId = mOperands.at(inputOperand);
+        auto inputShape = inputOperand->Shape();
+        std::vector<int32_t> starts = slice->GetStarts();
+        std::vector<int32_t> axes = slice->GetAxes();
+        std::vector<size_t> offsets(inputShape.size(), 0);
+        for (size_t i = 0; i < starts.size(); ++i) {
+            int32_t axis = axes.empty() ? i : axes[i];
+            if (axis < 0) {
+                axis += inputShape.size();
+            }
+            offsets[axis] = starts[i] < 0 ? starts[i] + inputShape[axis] : starts[i];
+        }
+        auto outputOperand = slice->PrimaryOutput();
+        uint32_t outputId;
+        XNN_TRY(DefineXnnTensorValue(subgraph, outputOperand, &outputId));
+        std::vector<size_t> sizes = GetDims(outputOperand->Shape());
+        XNN_TRY(DefineStaticSlice(subgraph, sizes.size(), offsets.data(), sizes.data(), inputId,
+                                  outputId));
+        return xnn_status_success;
+    }
+
     xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Split* split) {
         DAWN_ASSERT(split->Inputs().size() == 1);
         auto inputOperand = split->Inputs()[0].Get();
         DAWN_ASSERT(mOperands.find(inputOperand) != mOperands.end());
         uint32_t inputId = mOperands.at(inputOperand);
-        if (split->GetSplits().size() != 1) {
-            dawn::ErrorLog() << "XNNPACK backend only supports even split.";
-            return xnn_status_invalid_parameter;
-        }
         int32_t axis = split->GetAxis();
-        size_t outputSize = split->Outputs().size();
-        if (outputSize > 4) {
-            dawn::ErrorLog() << "XNNPACK backend doesn't support even split more than 4.";
-            return xnn_status_invalid_parameter;
+        if (axis < 0) {
+            axis += inputOperand->Shape().size();
         }
+        size_t outputSize = split->Outputs().size();
         std::vector<uint32_t> outputIds(outputSize);
         for (size_t i = 0; i < outputSize; ++i) {
             uint32_t outputId;
@@ -618,22 +1241,32 @@ namespace webnn::native::xnnpack {
             XNN_TRY(DefineXnnTensorValue(subgraph, outputOperand, &outputId));
             outputIds[i] = outputId;
         }
-        switch (outputSize) {
-            case 2:
-                XNN_TRY(
-                    xnn_define_even_split2(subgraph, axis, inputId, outputIds[0], outputIds[1], 0));
-                break;
-            case 3:
-                XNN_TRY(xnn_define_even_split3(subgraph, axis, inputId, outputIds[0], outputIds[1],
-                                               outputIds[2], 0));
-                break;
-            case 4:
-                XNN_TRY(xnn_define_even_split4(subgraph, axis, inputId, outputIds[0], outputIds[1],
-                                               outputIds[2], outputIds[3], 0));
-                break;
-            default:
-                dawn::ErrorLog() << "XNNPACK backend doesn't support even split more than 4.";
-                return xnn_status_invalid_parameter;
+        if (split->GetSplits().size() == 1) {
+            switch (outputSize) {
+                case 2:
+                    XNN_TRY(xnn_define_even_split2(subgraph, axis, inputId, outputIds[0],
+                                                   outputIds[1], 0));
+                    return xnn_status_success;
+                case 3:
+                    XNN_TRY(xnn_define_even_split3(subgraph, axis, inputId, outputIds[0],
+                                                   outputIds[1], outputIds[2], 0));
+                    return xnn_status_success;
+                case 4:
+                    XNN_TRY(xnn_define_even_split4(subgraph, axis, inputId, outputIds[0],
+                                                   outputIds[1], outputIds[2], outputIds[3], 0));
+                    return xnn_status_success;
+                default:
+                    break;
+            }
+        }
+        // The uneven split and the even split into more than 4 outputs are decomposed into
+        // slices along the axis.
+        std::vector<size_t> offsets(inputOperand->Shape().size(), 0);
+        for (size_t i = 0; i < outputSize; ++i) {
+            std::vector<size_t> sizes = GetDims(split->Outputs()[i]->Shape());
+            XNN_TRY(DefineStaticSlice(subgraph, sizes.size(), offsets.data(), sizes.data(),
+                                      inputId, outputIds[i]));
+            offsets[axis] += sizes[axis];
         }
         return xnn_status_success;
     }
@@ -659,6 +1292,19 @@ namespace webnn::native::xnnpack {
         return xnn_status_success;
     }
 
+    xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Transpose* transpose) {
+        DAWN_ASSERT(transpose->Inputs().size() == 1);
+        auto inputOperand = transpose->Inputs()[0].Get();
+        DAWN_ASSERT(mOperands.find(inputOperand) != mOperands.end());
+        uint32_t inputId = mOperands.at(inputOperand);
+        std::vector<int32_t> permutation = transpose->GetPermutation();
+        std::vector<size_t> perm(permutation.begin(), permutation.end());
+        uint32_t outputId;
+        XNN_TRY(DefineXnnTensorValue(subgraph, transpose->PrimaryOutput(), &outputId));
+        XNN_TRY(DefineStaticTranspose(subgraph, perm.size(), perm.data(), inputId, outputId));
+        return xnn_status_success;
+    }
+
     xnn_status Graph::DefineXnnNode(xnn_subgraph_t subgraph, const op::Unary* unary) {
         DAWN_ASSERT(unary->Inputs().size() == 1);
         auto inputOperand = unary->Inputs()[0].Get();
@@ -717,78 +1363,190 @@ namespace webnn::native::xnnpack {
     }
 
     MaybeError Graph::Finish() {
-        xnn_subgraph_t subgraph;
-        if (FAILED(xnn_create_subgraph(mExternals.size(), 0, &subgraph))) {
+        if (FAILED(xnn_create_subgraph(mExternals.size(), 0, &mSubgraph))) {
             return DAWN_INTERNAL_ERROR("xnn_create_subgraph failed.");
         }
+        xnn_subgraph_t subgraph = mSubgraph;
         for (auto const& info : mOperators) {
             switch (info.type) {
+                HANDLE_OP(BatchNorm)
                 HANDLE_OP(Binary)
                 HANDLE_OP(Clamp)
                 HANDLE_OP(Constant)
                 HANDLE_OP(Concat)
                 HANDLE_OP(Conv2d)
+                HANDLE_OP(ConvTranspose2d)
                 HANDLE_OP(Gemm)
                 HANDLE_OP(Input)
+                HANDLE_OP(InstanceNorm)
                 HANDLE_OP(Pad)
                 HANDLE_OP(Pool2d)
+                HANDLE_OP(Reduce)
+                HANDLE_OP(Resample2d)
                 HANDLE_OP(Reshape)
+                HANDLE_OP(Slice)
                 HANDLE_OP(Split)
                 HANDLE_OP(Squeeze)
+                HANDLE_OP(Transpose)
                 HANDLE_OP(Unary)
                 default: {
                     return DAWN_UNIMPLEMENTED_ERROR("");
                 }
             }
         }
-        uint32_t flags = XNN_FLAG_YIELD_WORKERS;
-        DAWN_TRY(xnn_create_runtime_v2(subgraph, GetThreadpool(), flags, &mRuntime));
-        DAWN_TRY(xnn_delete_subgraph(subgraph));
+        // The fp16 outputs are converted after all nodes are defined.
+        for (auto& output : mFp16Outputs) {
+            DAWN_TRY(DefineConvert(subgraph, output.first, output.second));
+        }
+        mRuntimeFlags = XNN_FLAG_YIELD_WORKERS;
+        if (GetContext()->GetContextOptions().precisionHint == wnn::PrecisionHint::Float16) {
+            // Run in fp16 if the processor supports native fp16 arithmetic, otherwise XNNPACK
+            // falls back to fp32.
+#if defined(WEBNN_XNNPACK_LATEST_API)
+            mRuntimeFlags |= XNN_FLAG_HINT_FP16_INFERENCE;
+#else
+            dawn::WarningLog() << "The fp16 precision hint is ignored without "
+                                  "webnn_xnnpack_latest_api.";
+#endif
+        }
+        // XNNPACK rewrites the subgraph to nchw layout if the convolutions are sparse enough.
+        // The profiling info tells which operators run in nchw layout, it costs timing every
+        // operator so it is only reported by the debug builds.
+        bool reportSparseConvolutions = false;
+        if (GetContext()->GetContextOptions().sparseInference) {
+#if defined(WEBNN_XNNPACK_LATEST_API)
+            mRuntimeFlags |= XNN_FLAG_HINT_SPARSE_INFERENCE;
+#    if defined(DAWN_ENABLE_ASSERTS)
+            mRuntimeFlags |= XNN_FLAG_BASIC_PROFILING;
+            reportSparseConvolutions = true;
+#    endif
+#else
+            dawn::WarningLog() << "The sparse inference hint is ignored without "
+                                  "webnn_xnnpack_latest_api.";
+#endif
+        }
+        // The weights are packed into the cache of the context when the runtime is created, the
+        // graphs with the same weights reuse the packed weights. The subgraph and the static
+        // buffers are kept for the runtimes of bound buffer sets, which are created later and
+        // find the packed weights in the cache.
+        DAWN_TRY(
+            CreateRuntime(subgraph, GetWeightsCache(), GetThreadpool(), mRuntimeFlags, &mRuntime));
+        if (reportSparseConvolutions) {
+            DAWN_TRY(ReportSparseConvolutions());
+        }
         return {};
     }
 
+    xnn_status Graph::ReportSparseConvolutions() {
+#if defined(WEBNN_XNNPACK_LATEST_API)
+        size_t size = 0;
+        xnn_status status = xnn_get_runtime_profiling_info(
+            mRuntime, xnn_profile_info_operator_name, 0, nullptr, &size);
+        if (status != xnn_status_out_of_memory && status != xnn_status_success) {
+            COMPLAIN_XNN_ERROR_AND_RETURN_XNN_ERROR("xnn_get_runtime_profiling_info", status);
+        }
+        std::vector<char> names(size);
+        XNN_TRY(xnn_get_runtime_profiling_info(mRuntime, xnn_profile_info_operator_name, size,
+                                               names.data(), &size));
+        // The operator names are null-terminated strings in the order of nodes, each conv2d
+        // node is lowered to one convolution operator. The 1x1 convolutions in nchw layout are
+        // computed by the sparse matrix-dense matrix multiplication.
+        std::vector<size_t> sparseIndices;
+        size_t convIndex = 0;
+        for (size_t offset = 0; offset < names.size() && convIndex < mConv2ds.size();) {
+            std::string name(names.data() + offset);
+            offset += name.size() + 1;
+            if (name.rfind("Convolution", 0) != 0) {
+                continue;
+            }
+            auto filterShape = mConv2ds[convIndex]->Inputs()[1]->Shape();
+            bool pointwise = filterShape[1] == 1 && filterShape[2] == 1;
+            if (pointwise && name.find("NCHW") != std::string::npos) {
+                sparseIndices.push_back(convIndex);
+            }
+            ++convIndex;
+        }
+        std::string indices;
+        for (auto index : sparseIndices) {
+            indices += (indices.empty() ? "" : ", ") + std::to_string(index);
+        }
+        dawn::InfoLog() << "XNNPACK sparse inference: " << sparseIndices.size() << " of "
+                        << mConv2ds.size() << " conv2d run sparsely [" << indices << "].";
+#endif
+        return xnn_status_success;
+    }
+
     pthreadpool_t Graph::GetThreadpool() {
         return reinterpret_cast<Context*>(GetContext())->GetThreadpool();
     }
 
+    WeightsCache* Graph::GetWeightsCache() {
+        return reinterpret_cast<Context*>(GetContext())->GetWeightsCache();
+    }
+
+    void Graph::UnregisterBuffers() {
+        for (auto& buffer : mBuffers) {
+            GetWeightsCache()->UnregisterBuffer(buffer.get());
+        }
+    }
+
     MaybeError Graph::CompileImpl() {
         return {};
     }
 
-    MaybeError Graph::ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
-        if (mNamedInputs != inputs || mNamedOutputs != outputs) {
-            bool anyPointersChanged = false;
-            for (auto& input : inputs->GetRecords()) {
-                DAWN_INVALID_IF(mExternals.find(input.first) == mExternals.end(),
-                                "Invalid inputs.");
-                void* data = static_cast<int8_t*>(input.second.resource.arrayBufferView.buffer) +
-                             input.second.resource.arrayBufferView.byteOffset;
-                if (mExternals[input.first].data != data) {
-                    mExternals[input.first].data = data;
-                    anyPointersChanged = true;
-                }
+    MaybeError Graph::UpdateExternals(NamedInputsBase* inputs,
+                                      NamedOutputsBase* outputs,
+                                      Externals* externals,
+                                      bool* changed) {
+        for (auto& input : inputs->GetRecords()) {
+            auto external = externals->find(input.first);
+            DAWN_INVALID_IF(external == externals->end(), "Invalid inputs.");
+            const ArrayBufferView& arrayBufferView = input.second.resource.arrayBufferView;
+            DAWN_INVALID_IF(arrayBufferView.byteLength < mExternalByteLengths[input.first],
+                            "The size of input " + input.first + " is smaller than the tensor.");
+            void* data = static_cast<int8_t*>(arrayBufferView.buffer) + arrayBufferView.byteOffset;
+            if (external->second.data != data) {
+                external->second.data = data;
+                *changed = true;
             }
-            mNamedInputs = inputs;
-
-            for (auto& output : outputs->GetRecords()) {
-                DAWN_INVALID_IF(mExternals.find(output.first) == mExternals.end(),
-                                "Invalid outputs.");
-                void* data = static_cast<int8_t*>(output.second.arrayBufferView.buffer) +
-                             output.second.arrayBufferView.byteOffset;
-                if (mExternals[output.first].data != data) {
-                    mExternals[output.first].data = data;
-                    anyPointersChanged = true;
-                }
+        }
+        for (auto& output : outputs->GetRecords()) {
+            auto external = externals->find(output.first);
+            DAWN_INVALID_IF(external == externals->end(), "Invalid outputs.");
+            const ArrayBufferView& arrayBufferView = output.second.arrayBufferView;
+            DAWN_INVALID_IF(arrayBufferView.byteLength < mExternalByteLengths[output.first],
+                            "The size of output " + output.first + " is smaller than the tensor.");
+            void* data = static_cast<int8_t*>(arrayBufferView.buffer) + arrayBufferView.byteOffset;
+            if (external->second.data != data) {
+                external->second.data = data;
+                *changed = true;
             }
-            mNamedOutputs = outputs;
+        }
+        return {};
+    }
 
-            if (anyPointersChanged) {
-                std::vector<xnn_external_value> externalValues;
-                for (auto& iterator : mExternals) {
-                    externalValues.push_back(iterator.second);
-                }
-                DAWN_TRY(xnn_setup_runtime(mRuntime, externalValues.size(), externalValues.data()));
-            }
+    MaybeError Graph::SetupRuntime(xnn_runtime_t runtime, const Externals& externals) {
+        std::vector<xnn_external_value> externalValues;
+        for (auto& external : externals) {
+            DAWN_INVALID_IF(external.second.data == nullptr,
+                            "All inputs and outputs of the graph must be set.");
+            externalValues.push_back(external.second);
+        }
+        DAWN_TRY(xnn_setup_runtime(runtime, externalValues.size(), externalValues.data()));
+        return {};
+    }
+
+    MaybeError Graph::ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) {
+        // The buffers are compared on every compute, the same named inputs may be set to another
+        // buffer, e.g. an input in shared memory set in place by the wire server.
+        // The externals are updated on a copy so that they keep matching the runtime if the
+        // inputs or outputs are invalid.
+        Externals externals = mExternals;
+        bool anyPointersChanged = false;
+        DAWN_TRY(UpdateExternals(inputs, outputs, &externals, &anyPointersChanged));
+        if (anyPointersChanged) {
+            DAWN_TRY(SetupRuntime(mRuntime, externals));
+            mExternals = std::move(externals);
         }
 
         DAWN_TRY(xnn_invoke_runtime(mRuntime));
@@ -796,4 +1554,54 @@ namespace webnn::native::xnnpack {
         return {};
     }
 
+    MaybeError Graph::BindImpl(uint32_t index,
+                               NamedInputsBase* inputs,
+                               NamedOutputsBase* outputs) {
+        DAWN_INVALID_IF(inputs == nullptr || outputs == nullptr,
+                        "named inputs or outputs is empty.");
+        DAWN_INVALID_IF(mSubgraph == nullptr, "The graph isn't built.");
+        Externals externals = mExternals;
+        for (auto& external : externals) {
+            external.second.data = nullptr;
+        }
+        bool changed = false;
+        DAWN_TRY(UpdateExternals(inputs, outputs, &externals, &changed));
+
+        // Each buffer set has its own runtime which is set up once here, the packed weights are
+        // shared with the runtime of the graph through the weights cache.
+        xnn_runtime_t runtime;
+        DAWN_TRY(CreateRuntime(mSubgraph, GetWeightsCache(), GetThreadpool(), mRuntimeFlags,
+                               &runtime));
+        MaybeError maybeError = SetupRuntime(runtime, externals);
+        if (maybeError.IsError()) {
+            xnn_delete_runtime(runtime);
+            return maybeError;
+        }
+        auto bufferSet = mBufferSets.find(index);
+        if (bufferSet != mBufferSets.end()) {
+            xnn_delete_runtime(bufferSet->second.runtime);
+            mBufferSets.erase(bufferSet);
+        }
+        mBufferSets[index] = {runtime, inputs, outputs, std::move(externals)};
+        return {};
+    }
+
+    MaybeError Graph::ComputeBoundImpl(uint32_t index) {
+        auto bufferSet = mBufferSets.find(index);
+        DAWN_INVALID_IF(bufferSet == mBufferSets.end(), "The buffer set isn't bound.");
+        // The named inputs and outputs may be set again after the binding, e.g. an input with
+        // another size moves to new storage, so the runtime is set up again if a buffer moved.
+        BufferSet& buffers = bufferSet->second;
+        Externals externals = buffers.externals;
+        bool changed = false;
+        DAWN_TRY(
+            UpdateExternals(buffers.inputs.Get(), buffers.outputs.Get(), &externals, &changed));
+        if (changed) {
+            DAWN_TRY(SetupRuntime(buffers.runtime, externals));
+            buffers.externals = std::move(externals);
+        }
+        DAWN_TRY(xnn_invoke_runtime(buffers.runtime));
+        return {};
+    }
+
 }  // namespace webnn::native::xnnpack
@@ -15,12 +15,14 @@
 #ifndef WEBNN_NATIVE_XNNPACK_GRAPH_XNN_H_
 #define WEBNN_NATIVE_XNNPACK_GRAPH_XNN_H_
 
+#include <map>
 #include <unordered_map>
 
 #include <xnnpack.h>
 
 #include "webnn/native/Graph.h"
 #include "webnn/native/Operand.h"
+#include "webnn/native/ops/BatchNorm.h"
 #include "webnn/native/ops/Binary.h"
 #include "webnn/native/ops/Clamp.h"
 #include "webnn/native/ops/Concat.h"
@@ -28,10 +30,14 @@
 #include "webnn/native/ops/Conv2d.h"
 #include "webnn/native/ops/Gemm.h"
 #include "webnn/native/ops/Input.h"
+#include "webnn/native/ops/InstanceNorm.h"
 #include "webnn/native/ops/LeakyRelu.h"
 #include "webnn/native/ops/Pad.h"
 #include "webnn/native/ops/Pool2d.h"
+#include "webnn/native/ops/Reduce.h"
+#include "webnn/native/ops/Resample2d.h"
 #include "webnn/native/ops/Reshape.h"
+#include "webnn/native/ops/Slice.h"
 #include "webnn/native/ops/Split.h"
 #include "webnn/native/ops/Squeeze.h"
 #include "webnn/native/ops/Transpose.h"
@@ -48,56 +54,116 @@ namespace webnn::native::xnnpack {
         virtual MaybeError AddConstant(const op::Constant* constant) override;
         virtual MaybeError AddInput(const op::Input* input) override;
         virtual MaybeError AddOutput(std::string_view name, const OperandBase* output) override;
+        virtual MaybeError AddBatchNorm(const op::BatchNorm* batchNorm) override;
         virtual MaybeError AddBinary(const op::Binary* binary) override;
         virtual MaybeError AddConcat(const op::Concat* concat) override;
         virtual MaybeError AddConv2d(const op::Conv2d* conv2d) override;
+        virtual MaybeError AddConvTranspose2d(const op::ConvTranspose2d* convTranspose2d) override;
         virtual MaybeError AddClamp(const op::Clamp* clamp) override;
         virtual MaybeError AddGemm(const op::Gemm* gemm) override;
+        virtual MaybeError AddInstanceNorm(const op::InstanceNorm* instanceNorm) override;
         virtual MaybeError AddPad(const op::Pad* pad) override;
         virtual MaybeError AddPool2d(const op::Pool2d* pool2d) override;
+        virtual MaybeError AddReduce(const op::Reduce* reduce) override;
+        virtual MaybeError AddResample2d(const op::Resample2d* resample2d) override;
         virtual MaybeError AddReshape(const op::Reshape* reshape) override;
+        virtual MaybeError AddSlice(const op::Slice* slice) override;
         virtual MaybeError AddSplit(const op::Split* split) override;
         virtual MaybeError AddSqueeze(const op::Squeeze* squeeze) override;
+        virtual MaybeError AddTranspose(const op::Transpose* transpose) override;
         virtual MaybeError AddUnary(const op::Unary* unary) override;
         virtual MaybeError Finish() override;
 
       private:
         MaybeError CompileImpl() override;
         MaybeError ComputeImpl(NamedInputsBase* inputs, NamedOutputsBase* outputs) override;
+        MaybeError BindImpl(uint32_t index,
+                            NamedInputsBase* inputs,
+                            NamedOutputsBase* outputs) override;
+        MaybeError ComputeBoundImpl(uint32_t index) override;
+        using Externals = std::unordered_map<std::string, xnn_external_value>;
+        // Points the externals to the buffers of the named inputs and outputs, |changed| is set
+        // if a buffer isn't the one the runtime was set up with.
+        MaybeError UpdateExternals(NamedInputsBase* inputs,
+                                   NamedOutputsBase* outputs,
+                                   Externals* externals,
+                                   bool* changed);
+        MaybeError SetupRuntime(xnn_runtime_t runtime, const Externals& externals);
 
         pthreadpool_t GetThreadpool();
+        WeightsCache* GetWeightsCache();
+        void UnregisterBuffers();
+        // Logs the indices of conv2d which run in the sparse nchw path.
+        xnn_status ReportSparseConvolutions();
 
         xnn_status DefineXnnTensorValue(xnn_subgraph_t subgraph,
                                         const OperandBase* operand,
                                         uint32_t* id,
                                         const void* data = nullptr);
+        // Defines a value which isn't an operand of the graph, such as the intermediate result
+        // of a decomposed op or the parameters folded from constants.
+        xnn_status DefineXnnInternalValue(xnn_subgraph_t subgraph,
+                                          const std::vector<size_t>& dims,
+                                          uint32_t* id,
+                                          const float* data = nullptr);
+        // Defines the node of the activation which can't be fused as the output range.
+        xnn_status DefineXnnActivation(xnn_subgraph_t subgraph,
+                                       const FusionOperatorBase* activation,
+                                       uint32_t inputId,
+                                       uint32_t outputId);
+        // Defines the output of an op with fused activation. The clamp and relu are fused as the
+        // output range, otherwise the op writes to `opOutputId` which is an intermediate value
+        // followed by the activation node.
+        xnn_status DefineXnnFusedOutput(xnn_subgraph_t subgraph,
+                                        const FusionOperatorBase* activation,
+                                        const OperandBase* output,
+                                        uint32_t* outputId,
+                                        uint32_t* opOutputId,
+                                        float* outputMin,
+                                        float* outputMax);
+        const op::Constant* GetConstant(const OperandBase* operand) const;
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Constant* constant);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Input* Input);
+        xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::BatchNorm* batchNorm);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Binary* binary);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Clamp* clamp);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Concat* concat);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Conv2d* conv2d);
+        xnn_status DefineXnnNode(xnn_subgraph_t subgraph,
+                                 const op::ConvTranspose2d* convTranspose2d);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Gemm* gemm);
+        xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::InstanceNorm* instanceNorm);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Pad* pad);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Pool2d* pool2d);
+        xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Reduce* reduce);
+        xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Resample2d* resample2d);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Reshape* reshape);
+        xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Slice* slice);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Split* split);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Squeeze* squeeze);
+        xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Transpose* transpose);
         xnn_status DefineXnnNode(xnn_subgraph_t subgraph, const op::Unary* unary);
 
         enum OperatorType {
+            BatchNorm,
             Binary,
             Constant,
             Clamp,
             Concat,
             Conv2d,
+            ConvTranspose2d,
             Input,
+            InstanceNorm,
             Gemm,
             Pad,
             Pool2d,
+            Reduce,
+            Resample2d,
             Reshape,
+            Slice,
             Split,
             Squeeze,
+            Transpose,
             Unary
         };
         struct OperatorInfo {
@@ -110,14 +176,32 @@ namespace webnn::native::xnnpack {
         std::unordered_map<const OperandBase*, uint32_t> mOperands;
         std::unordered_map<const OperandBase*, uint32_t> mInputs;
         std::unordered_map<const OperandBase*, uint32_t> mOutputs;
+        std::unordered_map<const OperandBase*, const op::Constant*> mConstants;
+        // The pairs of the fp32 value and the fp16 external output it's converted to.
+        std::vector<std::pair<uint32_t, uint32_t>> mFp16Outputs;
         uint32_t mExternalId;
 
-        std::vector<std::unique_ptr<char>> mBuffers;
+        std::vector<std::unique_ptr<char[]>> mBuffers;
+        std::vector<std::vector<float>> mChannelScales;
+        std::vector<const op::Conv2d*> mConv2ds;
         std::unordered_map<std::string, xnn_external_value> mExternals;
+        // The byte length of the tensor of each input and output.
+        std::unordered_map<std::string, size_t> mExternalByteLengths;
 
+        xnn_subgraph_t mSubgraph;
+        uint32_t mRuntimeFlags;
         xnn_runtime_t mRuntime;
-        NamedInputsBase* mNamedInputs;
-        NamedOutputsBase* mNamedOutputs;
+
+        // The runtime set up with the buffers of a bound set, the named inputs and outputs are
+        // referenced to keep the buffers alive.
+        struct BufferSet {
+            xnn_runtime_t runtime;
+            Ref<NamedInputsBase> inputs;
+            Ref<NamedOutputsBase> outputs;
+            // The buffers the runtime is set up with.
+            Externals externals;
+        };
+        std::map<uint32_t, BufferSet> mBufferSets;
     };
 
 }  // namespace webnn::native::xnnpack
@@ -0,0 +1,362 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/native/xnnpack/WeightsCacheXNN.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#include <cpuinfo.h>
+
+#include "common/Assert.h"
+#include "common/Log.h"
+#include "webnn/native/Sha256.h"
+
+#if !defined(WEBNN_XNNPACK_REVISION)
+#    define WEBNN_XNNPACK_REVISION "unknown"
+#endif
+
+namespace webnn::native::xnnpack {
+
+    namespace {
+        // The packed weights are accessed by SIMD kernels.
+        constexpr size_t kAlignment = 64;
+        constexpr char kFileMagic[8] = {'W', 'N', 'N', 'X', 'W', 'C', '0', '3'};
+        constexpr char kDigestAlgorithm[] = "sha256";
+
+        void AllocateAligned(size_t size, std::unique_ptr<char[]>* storage, void** data) {
+            storage->reset(new char[size + kAlignment]);
+            uintptr_t address = reinterpret_cast<uintptr_t>(storage->get());
+            *data = reinterpret_cast<void*>((address + kAlignment - 1) & ~(kAlignment - 1));
+        }
+
+        // The instruction sets which XNNPACK selects the kernels and the packed layout by.
+        std::string GetIsa() {
+            if (!cpuinfo_initialize()) {
+                return "unknown";
+            }
+            std::string isa;
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+            isa = CPUINFO_ARCH_X86_64 ? "x86_64" : "x86";
+            const std::pair<const char*, bool> features[] = {
+                {"sse4.1", cpuinfo_has_x86_sse4_1()},     {"avx", cpuinfo_has_x86_avx()},
+                {"f16c", cpuinfo_has_x86_f16c()},         {"fma3", cpuinfo_has_x86_fma3()},
+                {"avx2", cpuinfo_has_x86_avx2()},         {"avx512f", cpuinfo_has_x86_avx512f()},
+                {"avx512vnni", cpuinfo_has_x86_avx512vnni()},
+            };
+#elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+            isa = CPUINFO_ARCH_ARM64 ? "arm64" : "arm";
+            const std::pair<const char*, bool> features[] = {
+                {"neon", cpuinfo_has_arm_neon()},
+                {"neon-fp16-arith", cpuinfo_has_arm_neon_fp16_arith()},
+                {"neon-dot", cpuinfo_has_arm_neon_dot()},
+            };
+#else
+            isa = "unknown";
+            const std::pair<const char*, bool> features[] = {{"", false}};
+#endif
+            for (auto& feature : features) {
+                if (feature.second) {
+                    isa += std::string("+") + feature.first;
+                }
+            }
+            return isa;
+        }
+
+        void WriteString(std::ofstream& file, const std::string& value) {
+            uint64_t length = value.size();
+            file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            file.write(value.data(), length);
+        }
+
+        // The length is checked against the rest of the file, so a corrupted length fails the
+        // read instead of allocating the length.
+        bool ReadLength(std::ifstream& file, uint64_t fileSize, uint64_t* length) {
+            if (!file.read(reinterpret_cast<char*>(length), sizeof(*length))) {
+                return false;
+            }
+            return *length <= fileSize - static_cast<uint64_t>(file.tellg());
+        }
+
+        bool ReadString(std::ifstream& file, uint64_t fileSize, std::string* value) {
+            uint64_t length;
+            if (!ReadLength(file, fileSize, &length)) {
+                return false;
+            }
+            value->resize(length);
+            return length == 0 || file.read(&(*value)[0], length);
+        }
+    }  // anonymous namespace
+
+    // static
+    WeightsCache::FileHeader WeightsCache::GetDefaultFileHeader() {
+        return {WEBNN_XNNPACK_REVISION, GetIsa(), kDigestAlgorithm};
+    }
+
+    WeightsCache::WeightsCache(const std::string& filePath)
+        : WeightsCache(filePath, GetDefaultFileHeader(), Sha256Hex) {
+    }
+
+    WeightsCache::WeightsCache(const std::string& filePath,
+                               FileHeader header,
+                               DigestFunction digest)
+        : mFilePath(filePath), mFileHeader(std::move(header)), mDigest(digest) {
+#if defined(WEBNN_XNNPACK_LATEST_API)
+        mProvider.context = this;
+        mProvider.look_up = [](void* context, const xnn_weights_cache_look_up_key* key) {
+            return static_cast<WeightsCache*>(context)->LookUp(
+                {key->seed, key->kernel, key->bias});
+        };
+        mProvider.reserve_space = [](void* context, size_t n) {
+            return static_cast<WeightsCache*>(context)->ReserveSpace(n);
+        };
+        mProvider.look_up_or_insert = [](void* context, const xnn_weights_cache_look_up_key* key,
+                                         void* ptr, size_t size) {
+            return static_cast<WeightsCache*>(context)->LookUpOrInsert(
+                {key->seed, key->kernel, key->bias}, ptr, size);
+        };
+        // The cache is never finalized because graphs of the context may be built later.
+        mProvider.is_finalized = [](void* context) { return false; };
+        mProvider.offset_to_addr = [](void* context, size_t offset) {
+            return static_cast<WeightsCache*>(context)->OffsetToAddr(offset);
+        };
+        // The cache is owned by the context.
+        mProvider.delete_cache = [](void* context) { return xnn_status_success; };
+#endif
+        if (!mFilePath.empty()) {
+            Load();
+        }
+    }
+
+#if defined(WEBNN_XNNPACK_LATEST_API)
+    xnn_weights_cache_t WeightsCache::GetXnnWeightsCache() {
+        return &mProvider;
+    }
+#endif
+
+    void WeightsCache::RegisterBuffer(const void* data,
+                                      size_t byteLength,
+                                      const std::vector<size_t>& dims) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mBuffers[data] = {data, byteLength, dims, ""};
+    }
+
+    void WeightsCache::UnregisterBuffer(const void* data) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mBuffers.erase(data);
+    }
+
+    void WeightsCache::Finalize() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mDirty && !mFilePath.empty()) {
+            Save();
+        }
+        mDirty = false;
+    }
+
+    size_t WeightsCache::GetSize() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mEntries.size();
+    }
+
+    uint64_t WeightsCache::GetHitCount() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mHitCount;
+    }
+
+    uint64_t WeightsCache::GetMissCount() const {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mMissCount;
+    }
+
+    bool WeightsCache::GetKey(const LookUpKey& key, std::string* cacheKey) {
+        *cacheKey = std::to_string(key.seed);
+        for (const void* data : {key.kernel, key.bias}) {
+            *cacheKey += "|";
+            if (data == nullptr) {
+                continue;
+            }
+            auto iter = mBuffers.find(data);
+            if (iter == mBuffers.end()) {
+                return false;
+            }
+            Buffer& buffer = iter->second;
+            if (buffer.digest.empty()) {
+                buffer.digest = mDigest(buffer.data, buffer.byteLength);
+            }
+            *cacheKey += std::to_string(buffer.byteLength) + ":";
+            for (size_t i = 0; i < buffer.dims.size(); ++i) {
+                *cacheKey += (i == 0 ? "" : "x") + std::to_string(buffer.dims[i]);
+            }
+            *cacheKey += ":" + buffer.digest;
+        }
+        return true;
+    }
+
+    size_t WeightsCache::FindCachedWeights(const std::string& cacheKey) const {
+        auto iter = mCachedWeights.find(cacheKey);
+        return iter != mCachedWeights.end() ? iter->second : SIZE_MAX;
+    }
+
+    size_t WeightsCache::LookUp(const LookUpKey& key) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::string cacheKey;
+        if (GetKey(key, &cacheKey)) {
+            size_t offset = FindCachedWeights(cacheKey);
+            if (offset != SIZE_MAX) {
+                mHitCount++;
+                return offset;
+            }
+        }
+        mMissCount++;
+        return SIZE_MAX;
+    }
+
+    void* WeightsCache::ReserveSpace(size_t size) {
+        Entry entry;
+        AllocateAligned(size, &entry.storage, &entry.data);
+        entry.size = size;
+        void* data = entry.data;
+        std::lock_guard<std::mutex> lock(mMutex);
+        mReservedEntries[data] = std::move(entry);
+        return data;
+    }
+
+    size_t WeightsCache::LookUpOrInsert(const LookUpKey& key, void* ptr, size_t size) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::string cacheKey;
+        bool cacheable = GetKey(key, &cacheKey);
+        if (cacheable) {
+            size_t offset = FindCachedWeights(cacheKey);
+            if (offset != SIZE_MAX) {
+                mReservedEntries.erase(ptr);
+                return offset;
+            }
+        }
+        Entry entry;
+        auto reserved = mReservedEntries.find(ptr);
+        if (reserved != mReservedEntries.end()) {
+            entry = std::move(reserved->second);
+            mReservedEntries.erase(reserved);
+            entry.size = size;
+        } else {
+            AllocateAligned(size, &entry.storage, &entry.data);
+            memcpy(entry.data, ptr, size);
+            entry.size = size;
+        }
+        size_t offset = AddEntry(std::move(entry));
+        // The weights whose buffers are unknown are stored for the runtime but not shared.
+        if (cacheable) {
+            mCachedWeights[cacheKey] = offset;
+            mDirty = true;
+        }
+        return offset;
+    }
+
+    void* WeightsCache::OffsetToAddr(size_t offset) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        DAWN_ASSERT(offset < mEntries.size());
+        return mEntries[offset].data;
+    }
+
+    size_t WeightsCache::AddEntry(Entry entry) {
+        mEntries.push_back(std::move(entry));
+        return mEntries.size() - 1;
+    }
+
+    // The file starts with the magic and the header, which is the XNNPACK revision, the
+    // instruction sets and the digest algorithm. Then it's a sequence of entries, each entry is
+    // the key and the packed weights. The strings and the packed weights are prefixed by their
+    // 64-bit length.
+    void WeightsCache::Load() {
+        std::ifstream file(mFilePath, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return;
+        }
+        const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+        file.seekg(0);
+        char magic[sizeof(kFileMagic)];
+        if (!file.read(magic, sizeof(magic)) || memcmp(magic, kFileMagic, sizeof(magic)) != 0) {
+            dawn::WarningLog() << "Ignore the invalid XNNPACK weights cache file " << mFilePath;
+            return;
+        }
+        FileHeader header;
+        if (!ReadString(file, fileSize, &header.xnnpackRevision) ||
+            !ReadString(file, fileSize, &header.isa) ||
+            !ReadString(file, fileSize, &header.digestAlgorithm)) {
+            dawn::WarningLog() << "Ignore the invalid XNNPACK weights cache file " << mFilePath;
+            return;
+        }
+        if (header.xnnpackRevision != mFileHeader.xnnpackRevision ||
+            header.isa != mFileHeader.isa ||
+            header.digestAlgorithm != mFileHeader.digestAlgorithm) {
+            dawn::WarningLog() << "Ignore the stale XNNPACK weights cache file " << mFilePath
+                               << " written by XNNPACK " << header.xnnpackRevision << " on "
+                               << header.isa << " with " << header.digestAlgorithm;
+            return;
+        }
+        size_t count = 0;
+        std::string key;
+        while (ReadString(file, fileSize, &key)) {
+            uint64_t size;
+            if (!ReadLength(file, fileSize, &size)) {
+                break;
+            }
+            Entry entry;
+            AllocateAligned(size, &entry.storage, &entry.data);
+            entry.size = size;
+            if (!file.read(static_cast<char*>(entry.data), size)) {
+                break;
+            }
+            mCachedWeights[key] = AddEntry(std::move(entry));
+            count++;
+        }
+        dawn::InfoLog() << "Loaded " << count << " packed weights from " << mFilePath;
+    }
+
+    void WeightsCache::Save() {
+        // Write to a temporary file first, so a crash never leaves a truncated cache.
+        std::string tempPath = mFilePath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                dawn::WarningLog() << "Failed to write the XNNPACK weights cache file "
+                                   << mFilePath;
+                return;
+            }
+            file.write(kFileMagic, sizeof(kFileMagic));
+            WriteString(file, mFileHeader.xnnpackRevision);
+            WriteString(file, mFileHeader.isa);
+            WriteString(file, mFileHeader.digestAlgorithm);
+            for (auto& cachedWeights : mCachedWeights) {
+                const Entry& entry = mEntries[cachedWeights.second];
+                uint64_t size = entry.size;
+                WriteString(file, cachedWeights.first);
+                file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+                file.write(static_cast<const char*>(entry.data), size);
+            }
+            if (!file.good()) {
+                dawn::WarningLog() << "Failed to write the XNNPACK weights cache file "
+                                   << mFilePath;
+                return;
+            }
+        }
+        std::remove(mFilePath.c_str());
+        std::rename(tempPath.c_str(), mFilePath.c_str());
+    }
+
+}  // namespace webnn::native::xnnpack
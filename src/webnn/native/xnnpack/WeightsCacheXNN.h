@@ -0,0 +1,127 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_NATIVE_XNNPACK_WEIGHTS_CACHE_XNN_H_
+#define WEBNN_NATIVE_XNNPACK_WEIGHTS_CACHE_XNN_H_
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <xnnpack.h>
+
+namespace webnn::native::xnnpack {
+
+    // The cache of packed weights shared by all runtimes of a context. XNNPACK looks up the
+    // packed weights by the addresses of the kernel and bias, so the graph registers its static
+    // buffers before creating the runtime and the packed weights are keyed by the byte length,
+    // the shape and the SHA-256 digest of their content instead. Graphs with identical weights
+    // then skip the packing. Only the packed weights are kept, not the content of the kernel and
+    // bias.
+    //
+    // If the file path is set, the packed weights are loaded from the file at creation and
+    // written back by Finalize when the context is destroyed. The packed layout depends on the
+    // XNNPACK revision and the instruction sets of the processor, so the file header records
+    // both and a file written by another revision or processor is ignored and overwritten.
+    //
+    // The XNNPACK weights cache provider is newer than the XNNPACK revision in DEPS, without
+    // webnn_xnnpack_latest_api the runtimes don't use the cache.
+    class WeightsCache {
+      public:
+        struct FileHeader {
+            std::string xnnpackRevision;
+            std::string isa;
+            std::string digestAlgorithm;
+        };
+        using DigestFunction = std::string (*)(const void* data, size_t size);
+
+        // The packed weights are identified by the seed of the operator and the static buffers
+        // of the kernel and bias, the bias may be null.
+        struct LookUpKey {
+            uint32_t seed;
+            const void* kernel;
+            const void* bias;
+        };
+
+        static FileHeader GetDefaultFileHeader();
+
+        explicit WeightsCache(const std::string& filePath = "");
+        // The header and digest are only replaced by the tests.
+        WeightsCache(const std::string& filePath, FileHeader header, DigestFunction digest);
+        ~WeightsCache() = default;
+
+#if defined(WEBNN_XNNPACK_LATEST_API)
+        xnn_weights_cache_t GetXnnWeightsCache();
+#endif
+
+        void RegisterBuffer(const void* data, size_t byteLength, const std::vector<size_t>& dims);
+        void UnregisterBuffer(const void* data);
+        // Called once when the context is destroyed, the new packed weights are written to the
+        // file.
+        void Finalize();
+
+        // The callbacks of the XNNPACK weights cache provider.
+        size_t LookUp(const LookUpKey& key);
+        void* ReserveSpace(size_t size);
+        size_t LookUpOrInsert(const LookUpKey& key, void* ptr, size_t size);
+        void* OffsetToAddr(size_t offset);
+
+        size_t GetSize() const;
+        uint64_t GetHitCount() const;
+        uint64_t GetMissCount() const;
+
+      private:
+        struct Buffer {
+            const void* data;
+            size_t byteLength;
+            std::vector<size_t> dims;
+            // Computed at the first look up, XNNPACK doesn't pack all static buffers.
+            std::string digest;
+        };
+        struct Entry {
+            std::unique_ptr<char[]> storage;
+            void* data;
+            size_t size;
+        };
+
+        bool GetKey(const LookUpKey& key, std::string* cacheKey);
+        size_t FindCachedWeights(const std::string& cacheKey) const;
+        size_t AddEntry(Entry entry);
+        void Load();
+        void Save();
+
+#if defined(WEBNN_XNNPACK_LATEST_API)
+        xnn_weights_cache_provider mProvider;
+#endif
+        std::string mFilePath;
+        FileHeader mFileHeader;
+        DigestFunction mDigest;
+        std::unordered_map<const void*, Buffer> mBuffers;
+        // The offsets of the packed weights keyed by the seed and the byte lengths, shapes and
+        // digests of the kernel and bias.
+        std::unordered_map<std::string, size_t> mCachedWeights;
+        std::vector<Entry> mEntries;
+        // The space reserved for packing, keyed by the address returned to XNNPACK.
+        std::unordered_map<void*, Entry> mReservedEntries;
+        bool mDirty = false;
+        uint64_t mHitCount = 0;
+        uint64_t mMissCount = 0;
+        mutable std::mutex mMutex;
+    };
+
+}  // namespace webnn::native::xnnpack
+
+#endif  // WEBNN_NATIVE_XNNPACK_WEIGHTS_CACHE_XNN_H_
@@ -24,6 +24,13 @@ int main(int argc, char** argv) {
         if (strcmp("-p", argv[i]) == 0 && i + 1 < argc) {
             powerPreference = argv[i + 1];
         }
+        // Not "-w", which selects the type of the weights in the examples.
+        if (strcmp("-t", argv[i]) == 0 && i + 1 < argc) {
+            SetWireTransport(argv[i + 1]);
+        }
+        if (strcmp("-b", argv[i]) == 0 && i + 1 < argc) {
+            SetBackend(argv[i + 1]);
+        }
     }
     const wnn::ContextOptions options =
         utils::CreateContextOptions(devicePreference, powerPreference);
@@ -25,14 +25,44 @@ const wnn::Context& WebnnTest::GetContext() {
     return gTestEnv->GetContext();
 }
 
+// The contexts are created by the first enabled backend in the order of
+// InstanceBase::CreateContext, or by the null backend selected with "-b null".
+wnn::BackendType WebnnTest::GetBackendType() const {
+    if (IsNullBackend()) {
+        return wnn::BackendType::Null;
+    }
+#if defined(WEBNN_ENABLE_BACKEND_DML)
+    return wnn::BackendType::DirectML;
+#elif defined(WEBNN_ENABLE_BACKEND_DMLX)
+    return wnn::BackendType::DirectMLX;
+#elif defined(WEBNN_ENABLE_BACKEND_OPENVINO)
+    return wnn::BackendType::OpenVINO;
+#elif defined(WEBNN_ENABLE_BACKEND_ONEDNN)
+    return wnn::BackendType::OneDNN;
+#elif defined(WEBNN_ENABLE_BACKEND_MLAS)
+    return wnn::BackendType::MLAS;
+#elif defined(WEBNN_ENABLE_BACKEND_XNNPACK)
+    return wnn::BackendType::XNNPACK;
+#elif defined(WEBNN_ENABLE_BACKEND_NNAPI)
+    return wnn::BackendType::NNAPI;
+#else
+    return wnn::BackendType::Null;
+#endif
+}
+
 void WebnnTest::SetUp() {
     const wnn::Context& context = GetContext();
+    if (!context) {
+        GTEST_SKIP() << "The context can't be created.";
+    }
     context.SetUncapturedErrorCallback(ErrorCallback, this);
 }
 
 WebnnTest::~WebnnTest() {
     const wnn::Context& context = GetContext();
-    context.SetUncapturedErrorCallback(ErrorCallback, nullptr);
+    if (context) {
+        context.SetUncapturedErrorCallback(ErrorCallback, nullptr);
+    }
 }
 
 void WebnnTest::TearDown() {
@@ -68,7 +98,11 @@ void WebnnTest::ErrorCallback(WNNErrorType type, char const* message, void* user
 
 void WebnnTestEnvironment::SetUp() {
     mContext = CreateCppContext(mOptions);
-    DAWN_ASSERT(mContext);
+    // The null backend selected with "-b null" may not be built, the tests are skipped then.
+    if (IsNullBackend()) {
+        return;
+    }
+    ASSERT_TRUE(mContext) << "Failed to create the context.";
 }
 
 const wnn::Context& WebnnTestEnvironment::GetContext() {
@@ -18,6 +18,14 @@
 #include "examples/SampleUtils.h"
 #include "gtest/gtest.h"
 
+// Skips the test when the condition holds, e.g. the backend doesn't support the operation.
+#define WEBNN_SKIP_TEST_IF(condition)                                \
+    do {                                                             \
+        if (condition) {                                             \
+            GTEST_SKIP() << "Test skipped because of: " #condition; \
+        }                                                            \
+    } while (0)
+
 class WebnnTest : public testing::Test {
   protected:
     ~WebnnTest() override;
@@ -26,6 +34,8 @@ class WebnnTest : public testing::Test {
     void TearDown() override;
 
     const wnn::Context& GetContext();
+    // The backend computing the graphs of the tests.
+    wnn::BackendType GetBackendType() const;
     void StartExpectContextError();
     bool EndExpectContextError();
     std::string GetLastErrorMessage() const;
@@ -101,6 +101,131 @@ TEST_F(AddTests, AddTwoInputs) {
     EXPECT_TRUE(utils::CheckValue(result, expectedValue));
 }
 
+// The buffer sets are bound once and computed in turn with the data written in place.
+TEST_F(AddTests, AddBoundBufferSets) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 2});
+    const wnn::Operand b = utils::BuildInput(builder, "b", {2, 2});
+    const wnn::Graph graph = utils::Build(builder, {{"c", builder.Add(a, b)}});
+    ASSERT_TRUE(graph);
+    std::vector<std::vector<float>> dataA(2, std::vector<float>(4));
+    std::vector<std::vector<float>> dataB(2, std::vector<float>(4));
+    std::vector<std::vector<float>> results(2, std::vector<float>(4));
+    for (uint32_t i = 0; i < 2; ++i) {
+        wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+        wnn::Input inputA = {};
+        inputA.resource.arrayBufferView = {dataA[i].data(), dataA[i].size() * sizeof(float)};
+        namedInputs.Set("a", &inputA);
+        wnn::Input inputB = {};
+        inputB.resource.arrayBufferView = {dataB[i].data(), dataB[i].size() * sizeof(float)};
+        namedInputs.Set("b", &inputB);
+        wnn::NamedOutputs namedOutputs = CreateCppNamedOutputs();
+        wnn::Resource output = {};
+        output.arrayBufferView = {results[i].data(), results[i].size() * sizeof(float)};
+        namedOutputs.Set("c", &output);
+        graph.Bind(i, namedInputs, namedOutputs);
+    }
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        const uint32_t index = frame % 2;
+        dataA[index].assign(4, static_cast<float>(frame));
+        dataB[index] = {1, 2, 3, 4};
+        graph.ComputeBound(index);
+        DoFlush();
+        EXPECT_TRUE(utils::CheckValue(results[index], {frame + 1.0f, frame + 2.0f,
+                                                       frame + 3.0f, frame + 4.0f}));
+    }
+}
+
+// Binding an index again replaces its buffer set, the earlier outputs are no longer written.
+TEST_F(AddTests, AddRebindBufferSet) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 2});
+    const std::vector<float> dataB = {1, 2, 3, 4};
+    const wnn::Operand b =
+        utils::BuildConstant(builder, {2, 2}, dataB.data(), dataB.size() * sizeof(float));
+    const wnn::Graph graph = utils::Build(builder, {{"c", builder.Add(a, b)}});
+    ASSERT_TRUE(graph);
+    std::vector<std::vector<float>> dataA = {{1, 1, 1, 1}, {10, 10, 10, 10}};
+    std::vector<std::vector<float>> results(2, std::vector<float>(4));
+    std::vector<wnn::Input> inputs(2);
+    std::vector<wnn::Resource> outputs(2);
+    for (uint32_t i = 0; i < 2; ++i) {
+        wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+        inputs[i].resource.arrayBufferView = {dataA[i].data(), dataA[i].size() * sizeof(float)};
+        namedInputs.Set("a", &inputs[i]);
+        wnn::NamedOutputs namedOutputs = CreateCppNamedOutputs();
+        outputs[i].arrayBufferView = {results[i].data(), results[i].size() * sizeof(float)};
+        namedOutputs.Set("c", &outputs[i]);
+        graph.Bind(0, namedInputs, namedOutputs);
+        graph.ComputeBound(0);
+        DoFlush();
+    }
+    EXPECT_TRUE(utils::CheckValue(results[0], {2, 3, 4, 5}));
+    EXPECT_TRUE(utils::CheckValue(results[1], {11, 12, 13, 14}));
+
+    // The replaced buffer set keeps the results of its last compute.
+    dataA[1].assign(4, 20);
+    graph.ComputeBound(0);
+    DoFlush();
+    EXPECT_TRUE(utils::CheckValue(results[0], {2, 3, 4, 5}));
+    EXPECT_TRUE(utils::CheckValue(results[1], {21, 22, 23, 24}));
+}
+
+// Setting a bound input again may move its buffer, the buffer set computes with the new one. The
+// wire client sends the inputs it had at the binding, so only the native named inputs are set.
+TEST_F(AddTests, AddBoundInputSetAgain) {
+    WEBNN_SKIP_TEST_IF(GetBackendType() != wnn::BackendType::XNNPACK || IsWireEnabled());
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 2});
+    const std::vector<float> dataB = {1, 2, 3, 4};
+    const wnn::Operand b =
+        utils::BuildConstant(builder, {2, 2}, dataB.data(), dataB.size() * sizeof(float));
+    const wnn::Graph graph = utils::Build(builder, {{"c", builder.Add(a, b)}});
+    ASSERT_TRUE(graph);
+    std::vector<float> dataA = {1, 1, 1, 1};
+    std::vector<float> result(4);
+    wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+    wnn::Input input = {};
+    input.resource.arrayBufferView = {dataA.data(), dataA.size() * sizeof(float)};
+    namedInputs.Set("a", &input);
+    wnn::NamedOutputs namedOutputs = CreateCppNamedOutputs();
+    wnn::Resource output = {};
+    output.arrayBufferView = {result.data(), result.size() * sizeof(float)};
+    namedOutputs.Set("c", &output);
+    graph.Bind(0, namedInputs, namedOutputs);
+    graph.ComputeBound(0);
+    DoFlush();
+    EXPECT_TRUE(utils::CheckValue(result, {2, 3, 4, 5}));
+
+    // A larger buffer of another size is set, only the elements of the tensor are read.
+    std::vector<float> largerDataA = {10, 10, 10, 10, 10, 10, 10, 10};
+    input.resource.arrayBufferView = {largerDataA.data(), largerDataA.size() * sizeof(float)};
+    namedInputs.Set("a", &input);
+    graph.ComputeBound(0);
+    DoFlush();
+    EXPECT_TRUE(utils::CheckValue(result, {11, 12, 13, 14}));
+
+    // A buffer smaller than the tensor is an error, the buffer set keeps the last valid input.
+    std::vector<float> smallerDataA = {20, 20};
+    input.resource.arrayBufferView = {smallerDataA.data(), smallerDataA.size() * sizeof(float)};
+    namedInputs.Set("a", &input);
+    StartExpectContextError();
+    graph.ComputeBound(0);
+    DoFlush();
+    EXPECT_TRUE(EndExpectContextError());
+    StartExpectContextError();
+    graph.Bind(1, namedInputs, namedOutputs);
+    DoFlush();
+    EXPECT_TRUE(EndExpectContextError());
+
+    dataA.assign(4, 30);
+    input.resource.arrayBufferView = {dataA.data(), dataA.size() * sizeof(float)};
+    namedInputs.Set("a", &input);
+    graph.ComputeBound(0);
+    DoFlush();
+    EXPECT_TRUE(utils::CheckValue(result, {31, 32, 33, 34}));
+}
+
 TEST_F(AddTests, AddBroadcast) {
     const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
     const wnn::Operand a = utils::BuildInput(builder, "a", {3, 4, 5});
@@ -135,3 +260,108 @@ TEST_F(AddTests, AddBroadcast) {
          2.79817,     -1.3517822,  -0.12901783, 2.1257153});
     EXPECT_TRUE(utils::CheckValue(result, expectedValue));
 }
+
+// Both operands are broadcast to the output shape.
+TEST_F(AddTests, AddBroadcastBothOperands) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {3, 1});
+    const std::vector<float> dataB = {10, 20, 30, 40};
+    const wnn::Operand b =
+        utils::BuildConstant(builder, {1, 4}, dataB.data(), dataB.size() * sizeof(float));
+    const wnn::Operand c = builder.Add(a, b);
+    const wnn::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> dataA = {1, 2, 3};
+    std::vector<float> result(utils::SizeOfShape({3, 4}));
+    utils::Compute(graph, {{"a", dataA}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {11, 21, 31, 41, 12, 22, 32, 42, 13, 23, 33, 43}));
+}
+
+// The constants larger than the batches of the wire are sent ahead of the batched commands
+// referencing them, the smaller ones are batched with their commands.
+TEST_F(AddTests, AddLargeAndSmallConstants) {
+    const std::vector<int32_t> shape = {128, 256};
+    const size_t size = utils::SizeOfShape(shape);
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", shape);
+    const std::vector<float> dataB(size, 1.0f);
+    const wnn::Operand b =
+        utils::BuildConstant(builder, shape, dataB.data(), dataB.size() * sizeof(float));
+    const std::vector<float> dataC(shape[1], 0.5f);
+    const wnn::Operand c =
+        utils::BuildConstant(builder, {shape[1]}, dataC.data(), dataC.size() * sizeof(float));
+    const std::vector<float> dataD(size, 2.0f);
+    const wnn::Operand d =
+        utils::BuildConstant(builder, shape, dataD.data(), dataD.size() * sizeof(float));
+    const wnn::Operand e = builder.Add(builder.Add(builder.Add(a, b), c), d);
+    const wnn::Graph graph = utils::Build(builder, {{"e", e}});
+    ASSERT_TRUE(graph);
+    std::vector<float> dataA(size);
+    std::vector<float> expectedValue(size);
+    for (size_t i = 0; i < size; ++i) {
+        dataA[i] = static_cast<float>(i % 7);
+        expectedValue[i] = dataA[i] + 3.5f;
+    }
+    std::vector<float> result(size);
+    utils::Compute(graph, {{"a", dataA}}, {{"e", result}});
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
+
+// Flushing the wire while building closes the batch of the builder, the following commands go in
+// another batch.
+TEST_F(AddTests, AddFlushWhileBuilding) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 2});
+    const std::vector<float> dataB = {1, 2, 3, 4};
+    const wnn::Operand b =
+        utils::BuildConstant(builder, {2, 2}, dataB.data(), dataB.size() * sizeof(float));
+    DoFlush();
+    const wnn::Operand c = builder.Add(a, b);
+    DoFlush();
+    const wnn::Graph graph = utils::Build(builder, {{"d", builder.Add(c, b)}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> dataA = {1, 1, 1, 1};
+    std::vector<float> result(4);
+    utils::Compute(graph, {{"a", dataA}}, {{"d", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {3, 5, 7, 9}));
+}
+
+TEST_F(AddTests, AddQuantizedInt8) {
+    WEBNN_SKIP_TEST_IF(GetBackendType() != wnn::BackendType::XNNPACK);
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 2}, wnn::OperandType::Int8);
+    utils::SetQuantizationParams(builder, a, 0.5);
+    const std::vector<int8_t> bData = {2, 2, 2, 2};
+    const wnn::Operand b = utils::BuildConstant(builder, {2, 2}, bData.data(),
+                                                bData.size() * sizeof(int8_t),
+                                                wnn::OperandType::Int8);
+    utils::SetQuantizationParams(builder, b, 0.5);
+    const wnn::Operand c = builder.Add(a, b);
+    utils::SetQuantizationParams(builder, c, 0.5);
+    const wnn::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    const std::vector<int8_t> aData = {2, 4, -6, 8};
+    std::vector<int8_t> result(utils::SizeOfShape({2, 2}));
+    utils::Compute<int8_t>(graph, {{"a", aData}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, std::vector<int8_t>({4, 6, -4, 10})));
+}
+
+TEST_F(AddTests, AddQuantizedUint8) {
+    WEBNN_SKIP_TEST_IF(GetBackendType() != wnn::BackendType::XNNPACK);
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 2}, wnn::OperandType::Uint8);
+    utils::SetQuantizationParams(builder, a, 1.0, 100);
+    const std::vector<uint8_t> bData = {110, 110, 110, 110};
+    const wnn::Operand b = utils::BuildConstant(builder, {2, 2}, bData.data(),
+                                                bData.size() * sizeof(uint8_t),
+                                                wnn::OperandType::Uint8);
+    utils::SetQuantizationParams(builder, b, 1.0, 100);
+    const wnn::Operand c = builder.Add(a, b);
+    utils::SetQuantizationParams(builder, c, 1.0, 100);
+    const wnn::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    const std::vector<uint8_t> aData = {101, 102, 103, 104};
+    std::vector<uint8_t> result(utils::SizeOfShape({2, 2}));
+    utils::Compute<uint8_t>(graph, {{"a", aData}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, std::vector<uint8_t>({111, 112, 113, 114})));
+}
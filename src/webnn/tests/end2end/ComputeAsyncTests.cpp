@@ -0,0 +1,137 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/tests/WebnnTest.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+class ComputeAsyncTests : public WebnnTest {
+  protected:
+    // The callbacks are called by the threads of the backend or while the wire is flushed.
+    struct Completion {
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t count = 0;
+        size_t errorCount = 0;
+    };
+
+    // The computes of the graph adding 1 to the input.
+    struct Compute {
+        std::vector<float> input;
+        std::vector<float> output;
+        wnn::NamedOutputs namedOutputs;
+        wnn::Resource resource = {};
+    };
+
+    wnn::Graph BuildAddOne(const std::vector<int32_t>& shape) {
+        const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+        const wnn::Operand a = utils::BuildInput(builder, "a", shape);
+        const std::vector<float> dataB(utils::SizeOfShape(shape), 1);
+        const wnn::Operand b = utils::BuildConstant(builder, shape, dataB.data(),
+                                                    dataB.size() * sizeof(float));
+        return utils::Build(builder, {{"c", builder.Add(a, b)}});
+    }
+
+    // The named outputs are kept by the compute until the results are received.
+    void ComputeAsync(const wnn::Graph& graph, Compute* compute, Completion* completion) {
+        wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+        wnn::Input input = {};
+        input.resource.arrayBufferView = {compute->input.data(),
+                                          compute->input.size() * sizeof(float)};
+        namedInputs.Set("a", &input);
+        compute->namedOutputs = CreateCppNamedOutputs();
+        compute->resource.arrayBufferView = {compute->output.data(),
+                                             compute->output.size() * sizeof(float)};
+        compute->namedOutputs.Set("c", &compute->resource);
+        graph.ComputeAsync(
+            namedInputs, compute->namedOutputs,
+            [](WNNErrorType type, char const* message, void* userdata) {
+                Completion* completion = static_cast<Completion*>(userdata);
+                std::lock_guard<std::mutex> lock(completion->mutex);
+                ++completion->count;
+                if (type != WNNErrorType_NoError) {
+                    ++completion->errorCount;
+                }
+                completion->condition.notify_all();
+            },
+            completion);
+    }
+
+    bool WaitForCompletions(Completion* completion, size_t count) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        std::unique_lock<std::mutex> lock(completion->mutex);
+        while (completion->count < count) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            lock.unlock();
+            DoFlush();
+            lock.lock();
+            completion->condition.wait_for(lock, std::chrono::milliseconds(1),
+                                           [&]() { return completion->count >= count; });
+        }
+        return true;
+    }
+};
+
+// The computes more than the requests of the backend are queued without blocking the caller.
+TEST_F(ComputeAsyncTests, MoreComputesThanPoolSize) {
+    const std::vector<int32_t> shape = {1, 64, 32, 32};
+    const wnn::Graph graph = BuildAddOne(shape);
+    ASSERT_TRUE(graph);
+    std::vector<Compute> computes(32);
+    Completion completion;
+    for (size_t i = 0; i < computes.size(); ++i) {
+        computes[i].input.assign(utils::SizeOfShape(shape), static_cast<float>(i));
+        computes[i].output.resize(utils::SizeOfShape(shape));
+        ComputeAsync(graph, &computes[i], &completion);
+    }
+    ASSERT_TRUE(WaitForCompletions(&completion, computes.size()));
+    EXPECT_EQ(completion.errorCount, 0u);
+    for (size_t i = 0; i < computes.size(); ++i) {
+        EXPECT_TRUE(utils::CheckValue(
+            computes[i].output,
+            std::vector<float>(computes[i].output.size(), static_cast<float>(i + 1))));
+    }
+}
+
+// The graph released by the caller stays alive until its running computes complete. The wire
+// client can't return the results to the released graph, it calls the callbacks with an error.
+TEST_F(ComputeAsyncTests, ReleaseGraphWithPendingCompute) {
+    const std::vector<int32_t> shape = {1, 64, 32, 32};
+    std::vector<Compute> computes(8);
+    Completion completion;
+    {
+        const wnn::Graph graph = BuildAddOne(shape);
+        ASSERT_TRUE(graph);
+        for (size_t i = 0; i < computes.size(); ++i) {
+            computes[i].input.assign(utils::SizeOfShape(shape), static_cast<float>(i));
+            computes[i].output.resize(utils::SizeOfShape(shape));
+            ComputeAsync(graph, &computes[i], &completion);
+        }
+    }
+    ASSERT_TRUE(WaitForCompletions(&completion, computes.size()));
+    if (IsWireEnabled()) {
+        EXPECT_EQ(completion.errorCount, computes.size());
+        return;
+    }
+    EXPECT_EQ(completion.errorCount, 0u);
+    for (size_t i = 0; i < computes.size(); ++i) {
+        EXPECT_TRUE(utils::CheckValue(
+            computes[i].output,
+            std::vector<float>(computes[i].output.size(), static_cast<float>(i + 1))));
+    }
+}
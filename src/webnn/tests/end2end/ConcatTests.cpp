@@ -370,3 +370,28 @@ TEST_F(ConcatTests, DISABLED_ConcatTwo3DConstants) {
         CheckConcat(inputs, axes[i], expectedShape[i], expectedValue[i], false);
     }
 }
+
+// The inputs are the outputs of conv2d, which are computed in blocked layout by some backends.
+// The channels of the first input are not a multiple of the block size, so the channels of
+// the second input are shifted across the blocks.
+TEST_F(ConcatTests, ConcatChannelsOfConv2ds) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand input = utils::BuildInput(builder, "input", {1, 1, 2, 2});
+    const std::vector<float> filterData = {1, 2, 3, 4, 5, 6, 7, 8};
+    const wnn::Operand filter0 = utils::BuildConstant(builder, {3, 1, 1, 1}, filterData.data(),
+                                                      3 * sizeof(float));
+    const wnn::Operand filter1 = utils::BuildConstant(builder, {5, 1, 1, 1}, filterData.data() + 3,
+                                                      5 * sizeof(float));
+    std::vector<wnn::Operand> inputs = {builder.Conv2d(input, filter0),
+                                        builder.Conv2d(input, filter1)};
+    const wnn::Operand output = builder.Concat(inputs.size(), inputs.data(), 1);
+    const wnn::Graph graph = utils::Build(builder, {{"output", output}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {1, 2, 3, 4};
+    std::vector<float> result(utils::SizeOfShape({1, 8, 2, 2}));
+    utils::Compute(graph, {{"input", inputData}}, {{"output", result}});
+    const std::vector<float> expectedValue = {1, 2,  3,  4,  2, 4,  6,  8,  3, 6,  9,  12,
+                                              4, 8,  12, 16, 5, 10, 15, 20, 6, 12, 18, 24,
+                                              7, 14, 21, 28, 8, 16, 24, 32};
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
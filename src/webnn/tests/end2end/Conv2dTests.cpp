@@ -74,6 +74,49 @@ class Conv2dTests : public WebnnTest {
         EXPECT_TRUE(utils::CheckValue(result, expected.value));
     }
 
+    // The tensors are quantized per tensor, real_value = scale * (value - zeroPoint).
+    template <typename T>
+    struct QuantizedTensor {
+        std::vector<int32_t> shape;
+        std::vector<T> value;
+        float scale;
+        int32_t zeroPoint = 0;
+    };
+
+    template <typename T>
+    void CheckQuantizedConv2d(wnn::OperandType type,
+                              const QuantizedTensor<T>& input,
+                              const QuantizedTensor<T>& filter,
+                              const QuantizedTensor<T>& expected,
+                              utils::Conv2dOptions options = {}) {
+        const wnn::Operand x = utils::BuildInput(builder, "input", input.shape, type);
+        utils::SetQuantizationParams(builder, x, input.scale, input.zeroPoint);
+        const wnn::Operand w = utils::BuildConstant(builder, filter.shape, filter.value.data(),
+                                                    filter.value.size() * sizeof(T), type);
+        utils::SetQuantizationParams(builder, w, filter.scale, filter.zeroPoint);
+        const wnn::Operand y = builder.Conv2d(x, w, options.AsPtr());
+        utils::SetQuantizationParams(builder, y, expected.scale, expected.zeroPoint);
+        const wnn::Graph graph = utils::Build(builder, {{"output", y}});
+        ASSERT_TRUE(graph);
+        std::vector<T> result(utils::SizeOfShape(expected.shape));
+        utils::Compute<T>(graph, {{"input", input.value}}, {{"output", result}});
+        EXPECT_TRUE(utils::CheckValue(result, expected.value));
+    }
+
+    // Builds the sum of two 1x1 conv2d of the input, which scale the input by 1 and 2. The
+    // backends may accumulate the sum into the output of one conv2d.
+    void BuildConv2dSum(wnn::Operand* conv0, wnn::Operand* conv1, wnn::Operand* sum) {
+        const wnn::Operand x = utils::BuildInput(builder, "input", {1, 1, 2, 2});
+        const std::vector<float> filter0 = {1}, filter1 = {2};
+        const wnn::Operand w0 = utils::BuildConstant(builder, {1, 1, 1, 1}, filter0.data(),
+                                                     filter0.size() * sizeof(float));
+        const wnn::Operand w1 = utils::BuildConstant(builder, {1, 1, 1, 1}, filter1.data(),
+                                                     filter1.size() * sizeof(float));
+        *conv0 = builder.Conv2d(x, w0);
+        *conv1 = builder.Conv2d(x, w1);
+        *sum = builder.Add(*conv0, *conv1);
+    }
+
     wnn::GraphBuilder builder;
 };
 
@@ -1212,3 +1255,78 @@ TEST_F(Conv2dTests, Conv2dWithAutoPadSameUpperNhwcIhwo) {
     options.filterLayout = wnn::Conv2dFilterOperandLayout::Ihwo;
     CheckConv2d(input, filter, expected, options);
 }
+
+TEST_F(Conv2dTests, Conv2dQuantizedInt8) {
+    WEBNN_SKIP_TEST_IF(GetBackendType() != wnn::BackendType::OneDNN);
+    QuantizedTensor<int8_t> input = {{1, 1, 3, 3}, {1, 2, 3, 4, 5, 6, 7, 8, 9}, 0.5};
+    QuantizedTensor<int8_t> filter = {{1, 1, 2, 2}, std::vector<int8_t>(4, 2), 0.25};
+    QuantizedTensor<int8_t> expected = {{1, 1, 2, 2}, {6, 8, 12, 14}, 0.5};
+    CheckQuantizedConv2d(wnn::OperandType::Int8, input, filter, expected);
+}
+
+// The input has two channels, XNNPACK takes the conv2d of a single channel as depthwise.
+TEST_F(Conv2dTests, Conv2dQuantizedInt8Nhwc) {
+    WEBNN_SKIP_TEST_IF(GetBackendType() != wnn::BackendType::OneDNN &&
+                       GetBackendType() != wnn::BackendType::XNNPACK);
+    QuantizedTensor<int8_t> input = {
+        {1, 3, 3, 2}, {1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10}, 0.5};
+    QuantizedTensor<int8_t> filter = {{1, 2, 2, 2}, std::vector<int8_t>(8, 2), 0.25};
+    QuantizedTensor<int8_t> expected = {{1, 2, 2, 1}, {14, 18, 26, 30}, 0.5};
+    utils::Conv2dOptions options;
+    options.inputLayout = wnn::InputOperandLayout::Nhwc;
+    options.filterLayout = wnn::Conv2dFilterOperandLayout::Ohwi;
+    CheckQuantizedConv2d(wnn::OperandType::Int8, input, filter, expected, options);
+}
+
+TEST_F(Conv2dTests, Conv2dQuantizedUint8Nhwc) {
+    // oneDNN only supports the symmetric quantization of the filter.
+    WEBNN_SKIP_TEST_IF(GetBackendType() != wnn::BackendType::XNNPACK);
+    QuantizedTensor<uint8_t> input = {{1, 3, 3, 2},
+                                      {129, 130, 130, 131, 131, 132, 132, 133, 133, 134, 134,
+                                       135, 135, 136, 136, 137, 137, 138},
+                                      0.5,
+                                      128};
+    QuantizedTensor<uint8_t> filter = {{1, 2, 2, 2}, std::vector<uint8_t>(8, 130), 0.25, 128};
+    QuantizedTensor<uint8_t> expected = {{1, 2, 2, 1}, {142, 146, 154, 158}, 0.5, 128};
+    utils::Conv2dOptions options;
+    options.inputLayout = wnn::InputOperandLayout::Nhwc;
+    options.filterLayout = wnn::Conv2dFilterOperandLayout::Ohwi;
+    CheckQuantizedConv2d(wnn::OperandType::Uint8, input, filter, expected, options);
+}
+
+TEST_F(Conv2dTests, Conv2dSum) {
+    wnn::Operand conv0, conv1, sum;
+    BuildConv2dSum(&conv0, &conv1, &sum);
+    const wnn::Graph graph = utils::Build(builder, {{"output", sum}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(4);
+    const std::vector<float> input = {1, 2, 3, 4};
+    utils::Compute(graph, {{"input", input}}, {{"output", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {3, 6, 9, 12}));
+}
+
+// The addend is a graph output as well, so the sum can't be accumulated into it.
+TEST_F(Conv2dTests, Conv2dSumWithAddendOutput) {
+    wnn::Operand conv0, conv1, sum;
+    BuildConv2dSum(&conv0, &conv1, &sum);
+    const wnn::Graph graph = utils::Build(builder, {{"sum", sum}, {"conv0", conv0}});
+    ASSERT_TRUE(graph);
+    std::vector<float> sumResult(4), conv0Result(4);
+    const std::vector<float> input = {1, 2, 3, 4};
+    utils::Compute(graph, {{"input", input}}, {{"sum", sumResult}, {"conv0", conv0Result}});
+    EXPECT_TRUE(utils::CheckValue(sumResult, {3, 6, 9, 12}));
+    EXPECT_TRUE(utils::CheckValue(conv0Result, {1, 2, 3, 4}));
+}
+
+// The addend is consumed by another op after the add.
+TEST_F(Conv2dTests, Conv2dSumWithAddendConsumer) {
+    wnn::Operand conv0, conv1, sum;
+    BuildConv2dSum(&conv0, &conv1, &sum);
+    const wnn::Operand product = builder.Mul(sum, conv1);
+    const wnn::Graph graph = utils::Build(builder, {{"output", product}});
+    ASSERT_TRUE(graph);
+    std::vector<float> result(4);
+    const std::vector<float> input = {1, 2, 3, 4};
+    utils::Compute(graph, {{"input", input}}, {{"output", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {6, 24, 54, 96}));
+}
@@ -14,6 +14,8 @@
 
 #include "webnn/tests/WebnnTest.h"
 
+#include <numeric>
+
 class ConvTranspose2dTests : public WebnnTest {
     void SetUp() override {
         builder = wnn::CreateGraphBuilder(GetContext());
@@ -165,6 +167,20 @@ TEST_F(ConvTranspose2dTests, Conv2dTransposeNhwcOhwi) {
     CheckConvTranspose2d(input, filter, expected, options);
 }
 
+TEST_F(ConvTranspose2dTests, Conv2dTransposeNhwcOhwiGroups) {
+    Tensor input = {{1, 1, 1, 2}, {1, 2}};
+    std::vector<float> filterValue(16);
+    std::iota(filterValue.begin(), filterValue.end(), 1);
+    Tensor filter = {{4, 2, 2, 1}, filterValue};
+    Tensor expected = {{1, 2, 2, 4},
+                       {1, 5, 18, 26, 2, 6, 20, 28, 3, 7, 22, 30, 4, 8, 24, 32}};
+    utils::ConvTranspose2dOptions options;
+    options.groups = 2;
+    options.inputLayout = wnn::InputOperandLayout::Nhwc;
+    options.filterLayout = wnn::ConvTranspose2dFilterOperandLayout::Ohwi;
+    CheckConvTranspose2d(input, filter, expected, options);
+}
+
 TEST_F(ConvTranspose2dTests, Conv2dTransposeWithOutputShapeDefault) {
     Tensor input = {{1, 1, 3, 3}, {0, 1, 2, 3, 4, 5, 6, 7, 8}};
     Tensor filter = {{1, 2, 3, 3}, std::vector<float>(18, 1)};
@@ -466,3 +482,24 @@ TEST_F(ConvTranspose2dTests, Conv2dTransposeWithAutoPadSameLowerDefault) {
     options.autoPad = wnn::AutoPad::SameLower;
     CheckConvTranspose2d(input, filter, expected, options);
 }
+
+// The input is the output of conv2d, which is computed in blocked layout by some backends.
+TEST_F(ConvTranspose2dTests, Conv2dTransposeAfterConv2d) {
+    const wnn::Operand x = utils::BuildInput(builder, "input", {1, 1, 3, 3});
+    const std::vector<float> conv2dFilter = {1, 1};
+    const wnn::Operand w0 = utils::BuildConstant(builder, {2, 1, 1, 1}, conv2dFilter.data(),
+                                                 conv2dFilter.size() * sizeof(float));
+    const std::vector<float> filter(18, 1);
+    const wnn::Operand w1 =
+        utils::BuildConstant(builder, {2, 1, 3, 3}, filter.data(), filter.size() * sizeof(float));
+    const wnn::Operand y = builder.ConvTranspose2d(builder.Conv2d(x, w0), w1);
+    const wnn::Graph graph = utils::Build(builder, {{"output", y}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> input = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<float> result(utils::SizeOfShape({1, 1, 5, 5}));
+    utils::Compute(graph, {{"input", input}}, {{"output", result}});
+    const std::vector<float> expectedValue = {0.,  2.,  6.,  6.,  4.,  6.,  16., 30., 24.,
+                                              14., 18., 42., 72., 54., 30., 18., 40., 66.,
+                                              48., 26., 12., 26., 42., 30., 16.};
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
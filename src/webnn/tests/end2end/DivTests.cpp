@@ -93,3 +93,23 @@ TEST_F(DivTests, DivBroadcast) {
          0.3493175,   0.00538545,  0.39885238,  -1.0581895});
     EXPECT_TRUE(utils::CheckValue(result, expectedValue));
 }
+
+// The channels of the conv2d outputs are not a multiple of the channel block size of the
+// backends which compute in blocked layout, the padded channels must not affect the results.
+TEST_F(DivTests, DivBetweenConv2ds) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand x = utils::BuildInput(builder, "x", {1, 1, 2, 2});
+    const std::vector<float> filterData(20, 1);
+    const wnn::Operand w0 = utils::BuildConstant(builder, {20, 1, 1, 1}, filterData.data(),
+                                                 filterData.size() * sizeof(float));
+    const wnn::Operand y = builder.Conv2d(x, w0);
+    const wnn::Operand w1 = utils::BuildConstant(builder, {1, 20, 1, 1}, filterData.data(),
+                                                 filterData.size() * sizeof(float));
+    const wnn::Operand z = builder.Conv2d(builder.Div(y, y), w1);
+    const wnn::Graph graph = utils::Build(builder, {{"z", z}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> dataX = {1, 2, 3, 4};
+    std::vector<float> result(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph, {{"x", dataX}}, {{"z", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {20, 20, 20, 20}));
+}
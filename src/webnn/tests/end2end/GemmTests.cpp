@@ -366,3 +366,58 @@ TEST_F(GemmTests, bTransposeWithConstantWeight) {
     TestGemm(inputAShape, inputAData, inputBShape, inputBData, expectedShape, expectedValue,
              &options, true);
 }
+
+// The relu may be fused into the gemm.
+TEST_F(GemmTests, GemmRelu) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 2});
+    const std::vector<float> bData = {1, -1, 2, -2};
+    const wnn::Operand b =
+        utils::BuildConstant(builder, {2, 2}, bData.data(), bData.size() * sizeof(float));
+    const wnn::Operand c = builder.Relu(builder.Gemm(a, b));
+    const wnn::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> aData = {1, 2, -3, 4};
+    std::vector<float> result(utils::SizeOfShape({2, 2}));
+    utils::Compute(graph, {{"a", aData}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {5, 0, 5, 0}));
+}
+
+// The gemm output is a graph output as well, so the relu can't be fused into the gemm.
+TEST_F(GemmTests, GemmReluWithGemmOutput) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 2});
+    const std::vector<float> bData = {1, -1, 2, -2};
+    const wnn::Operand b =
+        utils::BuildConstant(builder, {2, 2}, bData.data(), bData.size() * sizeof(float));
+    const wnn::Operand gemm = builder.Gemm(a, b);
+    const wnn::Operand c = builder.Relu(gemm);
+    const wnn::Graph graph = utils::Build(builder, {{"c", c}, {"gemm", gemm}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> aData = {1, 2, -3, 4};
+    std::vector<float> result(utils::SizeOfShape({2, 2}));
+    std::vector<float> gemmResult(utils::SizeOfShape({2, 2}));
+    utils::Compute(graph, {{"a", aData}}, {{"c", result}, {"gemm", gemmResult}});
+    EXPECT_TRUE(utils::CheckValue(result, {5, 0, 5, 0}));
+    EXPECT_TRUE(utils::CheckValue(gemmResult, {5, -5, 5, -5}));
+}
+
+TEST_F(GemmTests, QuantizedInt8) {
+    WEBNN_SKIP_TEST_IF(GetBackendType() != wnn::BackendType::OneDNN);
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {1, 2}, wnn::OperandType::Int8);
+    utils::SetQuantizationParams(builder, a, 0.5);
+    const std::vector<int8_t> bData = {1, 2, 3, 4};
+    const wnn::Operand b = utils::BuildConstant(builder, {2, 2}, bData.data(),
+                                                bData.size() * sizeof(int8_t),
+                                                wnn::OperandType::Int8);
+    utils::SetQuantizationParams(builder, b, 1.0);
+    const wnn::Operand c = builder.Gemm(a, b);
+    utils::SetQuantizationParams(builder, c, 1.0);
+    const wnn::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    const std::vector<int8_t> aData = {2, 4};
+    std::vector<int8_t> result(utils::SizeOfShape({1, 2}));
+    utils::Compute<int8_t>(graph, {{"a", aData}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, std::vector<int8_t>({7, 10})));
+}
@@ -226,3 +226,19 @@ TEST_F(MatMulTests, MatMul4dx2d) {
     };
     EXPECT_TRUE(utils::CheckValue(result, expectedValue));
 }
+
+// The batch dimensions of both operands are broadcast.
+TEST_F(MatMulTests, MatMulBroadcastBatch) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {2, 1, 1, 2});
+    const std::vector<float> bData = {1, 2, 3, 4, 5, 6, 7, 8};
+    const wnn::Operand b =
+        utils::BuildConstant(builder, {1, 2, 2, 2}, bData.data(), bData.size() * sizeof(float));
+    const wnn::Operand c = builder.Matmul(a, b);
+    const wnn::Graph graph = utils::Build(builder, {{"c", c}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> aData = {1, 2, 3, 4};
+    std::vector<float> result(utils::SizeOfShape({2, 2, 1, 2}));
+    utils::Compute(graph, {{"a", aData}}, {{"c", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {7, 10, 19, 22, 15, 22, 43, 50}));
+}
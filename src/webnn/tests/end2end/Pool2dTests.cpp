@@ -914,3 +914,19 @@ TEST_F(Pool2dTests, DISABLED_L2Pool2dSameLowerNhwc) {
     const std::vector<float> expectedValue({1.5, 2.5});
     EXPECT_TRUE(utils::CheckValue(result, expectedValue));
 }
+
+TEST_F(Pool2dTests, MaxPool2dQuantizedInt8) {
+    WEBNN_SKIP_TEST_IF(GetBackendType() != wnn::BackendType::OneDNN);
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand x = utils::BuildInput(builder, "x", {1, 1, 2, 2}, wnn::OperandType::Int8);
+    utils::SetQuantizationParams(builder, x, 0.5);
+    utils::Pool2dOptions options;
+    options.windowDimensions = {2, 2};
+    const wnn::Operand y = builder.MaxPool2d(x, options.AsPtr());
+    const wnn::Graph graph = utils::Build(builder, {{"y", y}});
+    ASSERT_TRUE(graph);
+    const std::vector<int8_t> dataX = {1, 5, 3, 2};
+    std::vector<int8_t> result(utils::SizeOfShape({1, 1, 1, 1}));
+    utils::Compute<int8_t>(graph, {{"x", dataX}}, {{"y", result}});
+    EXPECT_TRUE(utils::CheckValue(result, std::vector<int8_t>({5})));
+}
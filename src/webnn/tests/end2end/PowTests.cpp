@@ -113,3 +113,26 @@ TEST_F(PowTests, PowBroadcast1d) {
     const std::vector<float> expectedValue({1, 4, 27, 4, 25, 216});
     EXPECT_TRUE(utils::CheckValue(result, expectedValue));
 }
+
+// The channels of the conv2d outputs are not a multiple of the channel block size of the
+// backends which compute in blocked layout, the padded channels must not affect the results.
+TEST_F(PowTests, PowBetweenConv2ds) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand x = utils::BuildInput(builder, "x", {1, 1, 2, 2});
+    const std::vector<float> filterData(20, 1);
+    const wnn::Operand w0 = utils::BuildConstant(builder, {20, 1, 1, 1}, filterData.data(),
+                                                 filterData.size() * sizeof(float));
+    const std::vector<float> exponent = {-1};
+    const wnn::Operand e =
+        utils::BuildConstant(builder, {1}, exponent.data(), exponent.size() * sizeof(float));
+    const wnn::Operand y = builder.Pow(builder.Conv2d(x, w0), e);
+    const wnn::Operand w1 = utils::BuildConstant(builder, {1, 20, 1, 1}, filterData.data(),
+                                                 filterData.size() * sizeof(float));
+    const wnn::Operand z = builder.Conv2d(y, w1);
+    const wnn::Graph graph = utils::Build(builder, {{"z", z}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> dataX = {1, 2, 4, 5};
+    std::vector<float> result(utils::SizeOfShape({1, 1, 2, 2}));
+    utils::Compute(graph, {{"x", dataX}}, {{"z", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {20, 10, 5, 4}));
+}
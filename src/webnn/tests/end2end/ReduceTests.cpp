@@ -411,6 +411,23 @@ TEST_F(ReduceTests, ReduceMeanDefaultAxesKeepDims) {
                 true);
 }
 
+TEST_F(ReduceTests, ReduceMeanEmptyAxes) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", {3, 2, 2});
+    // The empty axes reduce all dimensions like the absent axes.
+    const int32_t axes[1] = {0};
+    wnn::ReduceOptions options;
+    options.axes = axes;
+    options.axesCount = 0;
+    const wnn::Operand b = builder.ReduceMean(a, &options);
+    const wnn::Graph graph = utils::Build(builder, {{"b", b}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {5., 1., 20., 2., 30., 1., 40., 2., 55., 1., 60., 2.};
+    std::vector<float> result(utils::SizeOfShape({1}));
+    utils::Compute(graph, {{"a", inputData}}, {{"b", result}});
+    EXPECT_TRUE(utils::CheckValue(result, {18.25f}));
+}
+
 TEST_F(ReduceTests, ReduceMeanAxes0NotKeepDims) {
     const std::vector<int32_t> inputShape = {3, 2, 2};
     const std::vector<float> inputData = {5., 1., 20., 2., 30., 1., 40., 2., 55., 1., 60., 2.};
@@ -180,3 +180,29 @@ TEST_F(Resample2dTests, UpsampleNearest) {
     options.sizes = sizes.data();
     TestResample2d(inputShape, inputData, expectedShape, expectedValue, &options);
 }
+
+// The input is the output of conv2d, which is computed in blocked layout by some backends.
+TEST_F(Resample2dTests, UpsampleNearestAfterConv2d) {
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand input = utils::BuildInput(builder, "input", {1, 1, 2, 2});
+    const std::vector<float> filterData = {1, 2, 3};
+    const wnn::Operand filter = utils::BuildConstant(builder, {3, 1, 1, 1}, filterData.data(),
+                                                     filterData.size() * sizeof(float));
+    wnn::Resample2dOptions options;
+    options.mode = wnn::InterpolationMode::NearestNeighbor;
+    std::vector<float> scales = {2.0, 2.0};
+    options.scalesCount = scales.size();
+    options.scales = scales.data();
+    const wnn::Operand output = builder.Resample2d(builder.Conv2d(input, filter), &options);
+    const wnn::Graph graph = utils::Build(builder, {{"output", output}});
+    ASSERT_TRUE(graph);
+    const std::vector<float> inputData = {1, 2, 3, 4};
+    std::vector<float> result(utils::SizeOfShape({1, 3, 4, 4}));
+    utils::Compute(graph, {{"input", inputData}}, {{"output", result}});
+    const std::vector<float> expectedValue = {
+        1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4,  4,  3, 3, 4,  4,
+        2, 2, 4, 4, 2, 2, 4, 4, 6, 6, 8,  8,  6, 6, 8,  8,
+        3, 3, 6, 6, 3, 3, 6, 6, 9, 9, 12, 12, 9, 9, 12, 12,
+    };
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+}
@@ -0,0 +1,147 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/tests/WebnnTest.h"
+
+#include <algorithm>
+
+#include "webnn/utils/SharedMemory.h"
+
+class SharedMemoryTests : public WebnnTest {
+  protected:
+    static constexpr uint32_t kSharedMemoryId = 1;
+
+    // Unregisters the region from the wire client and server when the test returns.
+    class SharedMemoryRegistration {
+      public:
+        explicit SharedMemoryRegistration(uint32_t id) : mId(id) {
+        }
+        ~SharedMemoryRegistration() {
+            UnregisterSharedMemory(mId);
+        }
+
+      private:
+        uint32_t mId;
+    };
+};
+
+// The constant, input and output are placed in a region mapped twice, as the client and the
+// server processes would map it, so the tensors are referenced by the wire commands and the
+// client serializes less than the bytes of one tensor.
+TEST_F(SharedMemoryTests, AddInSharedMemory) {
+    const std::vector<int32_t> shape = {256, 256};
+    const size_t size = utils::SizeOfShape(shape);
+    const size_t byteLength = size * sizeof(float);
+    std::unique_ptr<utils::SharedMemory> clientMemory = utils::SharedMemory::Create(3 * byteLength);
+    if (clientMemory == nullptr) {
+        GTEST_SKIP() << "Shared memory isn't supported on the platform.";
+    }
+    std::unique_ptr<utils::SharedMemory> serverMemory =
+        utils::SharedMemory::Map(clientMemory->GetFd(), clientMemory->GetSize());
+    ASSERT_TRUE(serverMemory != nullptr);
+    // The registration is undone even if only the client or the server registered the region.
+    SharedMemoryRegistration registration(kSharedMemoryId);
+    ASSERT_TRUE(RegisterSharedMemory(kSharedMemoryId, clientMemory->GetData(),
+                                     serverMemory->GetData(), clientMemory->GetSize()));
+
+    float* b = static_cast<float*>(clientMemory->GetData());
+    float* a = b + size;
+    float* c = a + size;
+    std::vector<float> expectedValue(size);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] = static_cast<float>(i % 16);
+        b[i] = 0.5f;
+        expectedValue[i] = a[i] + b[i];
+    }
+    uint64_t bytesBefore = 0;
+    const bool wireEnabled = GetWireClientSerializedBytes(&bytesBefore);
+
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand inputA = utils::BuildInput(builder, "a", shape);
+    const wnn::Operand constantB = utils::BuildConstant(builder, shape, b, byteLength);
+    const wnn::Graph graph = utils::Build(builder, {{"c", builder.Add(inputA, constantB)}});
+    ASSERT_TRUE(graph);
+
+    wnn::Input input = {};
+    input.resource.arrayBufferView = {a, byteLength};
+    wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+    namedInputs.Set("a", &input);
+    wnn::Resource output = {};
+    output.arrayBufferView = {c, byteLength};
+    wnn::NamedOutputs namedOutputs = CreateCppNamedOutputs();
+    namedOutputs.Set("c", &output);
+    graph.Compute(namedInputs, namedOutputs);
+    DoFlush();
+
+    const std::vector<float> result(c, c + size);
+    EXPECT_TRUE(utils::CheckValue(result, expectedValue));
+    if (wireEnabled) {
+        uint64_t bytesAfter = 0;
+        ASSERT_TRUE(GetWireClientSerializedBytes(&bytesAfter));
+        EXPECT_LT(bytesAfter - bytesBefore, byteLength);
+    }
+}
+
+// The server sets the input in shared memory in place, so the data written to the region after
+// the input is set is computed, and the input set to another tensor of the region is computed
+// by the same graph.
+TEST_F(SharedMemoryTests, InputInSharedMemoryIsNotCopied) {
+    const std::vector<int32_t> shape = {2, 2};
+    const size_t size = utils::SizeOfShape(shape);
+    const size_t byteLength = size * sizeof(float);
+    std::unique_ptr<utils::SharedMemory> clientMemory = utils::SharedMemory::Create(2 * byteLength);
+    if (clientMemory == nullptr) {
+        GTEST_SKIP() << "Shared memory isn't supported on the platform.";
+    }
+    std::unique_ptr<utils::SharedMemory> serverMemory =
+        utils::SharedMemory::Map(clientMemory->GetFd(), clientMemory->GetSize());
+    ASSERT_TRUE(serverMemory != nullptr);
+    SharedMemoryRegistration registration(kSharedMemoryId);
+    ASSERT_TRUE(RegisterSharedMemory(kSharedMemoryId, clientMemory->GetData(),
+                                     serverMemory->GetData(), clientMemory->GetSize()));
+
+    const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+    const wnn::Operand a = utils::BuildInput(builder, "a", shape);
+    const std::vector<float> dataB(size, 1.0f);
+    const wnn::Operand b = utils::BuildConstant(builder, shape, dataB.data(), byteLength);
+    const wnn::Graph graph = utils::Build(builder, {{"c", builder.Add(a, b)}});
+    ASSERT_TRUE(graph);
+
+    float* first = static_cast<float*>(clientMemory->GetData());
+    float* second = first + size;
+    std::fill(first, first + size, 0.0f);
+    std::fill(second, second + size, 5.0f);
+    wnn::Input input = {};
+    input.resource.arrayBufferView = {first, byteLength};
+    wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+    namedInputs.Set("a", &input);
+    // The set is handled by the server before the data is written.
+    DoFlush();
+    std::fill(first, first + size, 2.0f);
+
+    std::vector<float> result(size);
+    wnn::Resource output = {};
+    output.arrayBufferView = {result.data(), byteLength};
+    wnn::NamedOutputs namedOutputs = CreateCppNamedOutputs();
+    namedOutputs.Set("c", &output);
+    graph.Compute(namedInputs, namedOutputs);
+    DoFlush();
+    EXPECT_TRUE(utils::CheckValue(result, std::vector<float>(size, 3.0f)));
+
+    input.resource.arrayBufferView = {second, byteLength};
+    namedInputs.Set("a", &input);
+    graph.Compute(namedInputs, namedOutputs);
+    DoFlush();
+    EXPECT_TRUE(utils::CheckValue(result, std::vector<float>(size, 6.0f)));
+}
@@ -98,3 +98,11 @@ TEST_F(SliceTests, SliceTestsWithAxes) {
     options.axes = {-3, -1};
     CheckSlice(input, starts, sizes, expected, options);
 }
+
+TEST_F(SliceTests, SliceTests4D) {
+    Tensor input = {{1, 2, 3, 2}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}};
+    std::vector<int> starts = {0, 1, 1, 0};
+    std::vector<int> sizes = {1, 1, 2, 2};
+    Tensor expected = {{1, 1, 2, 2}, {8, 9, 10, 11}};
+    CheckSlice(input, starts, sizes, expected);
+}
@@ -108,3 +108,11 @@ TEST_F(TransposeTests, TransposePermutations) {
                        permutations[i]);
     }
 }
+
+TEST_F(TransposeTests, TransposeNhwcToNchw) {
+    const std::vector<int32_t> inputShape = {1, 2, 2, 3};
+    const std::vector<float> inputData = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    const std::vector<int32_t> expectedShape = {1, 3, 2, 2};
+    const std::vector<float> expectedValue = {0, 3, 6, 9, 1, 4, 7, 10, 2, 5, 8, 11};
+    CheckTranspose(inputShape, inputData, expectedShape, expectedValue, {0, 3, 1, 2});
+}
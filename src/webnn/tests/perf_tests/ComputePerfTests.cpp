@@ -0,0 +1,77 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdlib>
+
+#include "common/Platform.h"
+#include "webnn/tests/perf_tests/WebnnPerfTest.h"
+
+// Times the compute of an add graph, the small shape measures the overhead of binding the
+// inputs and outputs per compute and the large shape measures the copies of the data.
+class ComputePerfTests : public WebnnPerfTest {
+  protected:
+    void RunAdd(const std::vector<int32_t>& shape) {
+        double computeTime = 0;
+        ComputeAdd(shape, &computeTime);
+        PrintResult("compute", computeTime, "us");
+        // The OpenVINO graph resolves the blobs of the inputs and outputs on every compute with
+        // the toggle like before they were cached, so the difference is the overhead per call
+        // saved by the cache.
+        if (GetBackendType() == wnn::BackendType::OpenVINO) {
+            double resolveTime = 0;
+            SetResolveBlobsPerCompute(true);
+            ComputeAdd(shape, &resolveTime);
+            SetResolveBlobsPerCompute(false);
+            PrintResult("compute_resolve_blobs_per_compute", resolveTime, "us");
+            PrintResult("compute_overhead_per_call", resolveTime - computeTime, "us");
+        }
+    }
+
+  private:
+    void ComputeAdd(const std::vector<int32_t>& shape, double* computeTime) {
+        const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+        const wnn::Operand a = utils::BuildInput(builder, "a", shape);
+        const std::vector<float> bData(utils::SizeOfShape(shape), 1.0f);
+        const wnn::Operand b =
+            utils::BuildConstant(builder, shape, bData.data(), bData.size() * sizeof(float));
+        const wnn::Graph graph = utils::Build(builder, {{"c", builder.Add(a, b)}});
+        ASSERT_TRUE(graph);
+        const std::vector<float> dataA(utils::SizeOfShape(shape), 2.0f);
+        std::vector<float> result(utils::SizeOfShape(shape));
+        *computeTime = RunSteps([&]() { utils::Compute(graph, {{"a", dataA}}, {{"c", result}}); });
+        EXPECT_TRUE(CheckValue(result, std::vector<float>(result.size(), 3.0f)));
+    }
+
+    // The toggle is read when the graph is created.
+    void SetResolveBlobsPerCompute(bool enabled) {
+        const char* name = "WEBNN_OPENVINO_RESOLVE_BLOBS_PER_COMPUTE";
+#if defined(DAWN_PLATFORM_WINDOWS)
+        _putenv_s(name, enabled ? "1" : "");
+#else
+        if (enabled) {
+            setenv(name, "1", 1);
+        } else {
+            unsetenv(name);
+        }
+#endif
+    }
+};
+
+TEST_F(ComputePerfTests, AddSmall) {
+    RunAdd({1, 8});
+}
+
+TEST_F(ComputePerfTests, AddLarge) {
+    RunAdd({1, 64, 56, 56});
+}
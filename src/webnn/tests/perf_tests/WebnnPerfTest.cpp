@@ -0,0 +1,167 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/tests/perf_tests/WebnnPerfTest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    // The heap allocations of the process, counted by the replaced allocation functions below
+    // since the perf tests are their own binary. The aligned allocations and the direct
+    // mallocs aren't counted, e.g. the copies of the constants, besides the system allocations
+    // of the deserialize allocators which are added from their stats.
+    std::atomic<uint64_t> gHeapAllocationCount = 0;
+
+    void* AllocateCounted(size_t size) {
+        gHeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        return malloc(size == 0 ? 1 : size);
+    }
+}  // anonymous namespace
+
+void* operator new(size_t size) {
+    void* ptr = AllocateCounted(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return AllocateCounted(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return AllocateCounted(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    free(ptr);
+}
+
+WebnnPerfTest::WebnnPerfTest(unsigned int iterations, unsigned int warmupIterations)
+    : mIterations(iterations), mWarmupIterations(warmupIterations) {
+}
+
+double WebnnPerfTest::RunSteps(const std::function<void()>& step) {
+    return RunSteps(step, []() {});
+}
+
+double WebnnPerfTest::RunSteps(const std::function<void()>& step,
+                               const std::function<void()>& warmedUp) {
+    for (unsigned int i = 0; i < mWarmupIterations; ++i) {
+        step();
+    }
+    warmedUp();
+    const auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < mIterations; ++i) {
+        step();
+    }
+    const std::chrono::duration<double, std::micro> elapsedTime =
+        std::chrono::steady_clock::now() - startTime;
+    return elapsedTime.count() / mIterations;
+}
+
+double WebnnPerfTest::RunWireSteps(const std::function<void()>& step) {
+    webnn::wire::DeserializeAllocatorStats serverStats, clientStats;
+    uint64_t heapAllocationCount = 0;
+    bool hasWire = false;
+    // The stats are taken after the warmup, so the allocations which grow the allocators to the
+    // size the commands need aren't counted.
+    const double stepTime = RunSteps(step, [&]() {
+        hasWire = GetWireAllocatorStats(&serverStats, &clientStats);
+        heapAllocationCount = gHeapAllocationCount.load();
+    });
+    const uint64_t endHeapAllocationCount = gHeapAllocationCount.load();
+    webnn::wire::DeserializeAllocatorStats endServerStats, endClientStats;
+    if (!hasWire || !GetWireAllocatorStats(&endServerStats, &endClientStats)) {
+        return stepTime;
+    }
+
+    // The commands of a graph builder batch are handled as part of the received batch command.
+    const uint64_t commandCount = endServerStats.commandCount - serverStats.commandCount;
+    const uint64_t batchedCommandCount =
+        endServerStats.batchedCommandCount - serverStats.batchedCommandCount;
+    const double perCommand = 1.0 / std::max<uint64_t>(commandCount, 1);
+    // The step time is in microseconds.
+    PrintResult("server_commands", commandCount * 1e6 / mIterations / stepTime, "commands/s");
+    PrintResult("server_batched_commands", batchedCommandCount * 1e6 / mIterations / stepTime,
+                "commands/s");
+    // The allocations of the client, the server and the backend in the process, including the
+    // blocks allocated by the deserialize allocators.
+    const uint64_t systemAllocationCount =
+        endServerStats.systemAllocationCount - serverStats.systemAllocationCount +
+        endClientStats.systemAllocationCount - clientStats.systemAllocationCount;
+    PrintResult("heap_allocations_per_command",
+                (endHeapAllocationCount - heapAllocationCount + systemAllocationCount) *
+                    perCommand,
+                "allocations");
+
+    auto PrintDeserializeStats = [&](const std::string& side,
+                                     const webnn::wire::DeserializeAllocatorStats& start,
+                                     const webnn::wire::DeserializeAllocatorStats& end) {
+        PrintResult(side + "_deserialize_spaces_per_command",
+                    (end.spaceCount - start.spaceCount) * perCommand, "spaces");
+        PrintResult(side + "_system_allocations_per_command",
+                    (end.systemAllocationCount - start.systemAllocationCount) * perCommand,
+                    "allocations");
+        PrintResult(side + "_high_water_size", end.highWaterSize, "bytes");
+    };
+    PrintDeserializeStats("server", serverStats, endServerStats);
+    PrintDeserializeStats("client", clientStats, endClientStats);
+    return stepTime;
+}
+
+void WebnnPerfTest::PrintResult(const std::string& metric,
+                                double value,
+                                const std::string& units) const {
+    const testing::TestInfo* testInfo = testing::UnitTest::GetInstance()->current_test_info();
+    printf("*RESULT %s.%s: %s= %f %s\n", testInfo->test_suite_name(), testInfo->name(),
+           metric.c_str(), value, units.c_str());
+    fflush(stdout);
+    RecordProperty(metric, std::to_string(value) + " " + units);
+}
+
+bool WebnnPerfTest::CheckValue(const std::vector<float>& value,
+                               const std::vector<float>& expectedValue) {
+    return IsNullBackend() || utils::CheckValue(value, expectedValue);
+}
@@ -0,0 +1,55 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TESTS_PERF_TESTS_WEBNN_PERF_TEST_H_
+#define TESTS_PERF_TESTS_WEBNN_PERF_TEST_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "webnn/tests/WebnnTest.h"
+
+// The base of the perf tests, a step is run for a number of warmup iterations first and then
+// timed for the iterations. The results are printed in the format of the Chromium perf
+// dashboard, e.g. "*RESULT ComputePerfTests.AddSmall: compute= 12.3 us".
+class WebnnPerfTest : public WebnnTest {
+  protected:
+    static constexpr unsigned int kDefaultWarmupIterations = 10;
+    static constexpr unsigned int kDefaultIterations = 1000;
+
+    explicit WebnnPerfTest(unsigned int iterations = kDefaultIterations,
+                           unsigned int warmupIterations = kDefaultWarmupIterations);
+
+    // Returns the average wall time of the step in microseconds.
+    double RunSteps(const std::function<void()>& step);
+    // Runs the steps like RunSteps and also prints the commands handled by the wire server per
+    // second, the heap allocations of the process per command and the deserialize stats of the
+    // server and the client. The step must flush the wire. Nothing more is printed without the
+    // wire.
+    double RunWireSteps(const std::function<void()>& step);
+    // The result is also recorded as a property of the test, so --gtest_output=json writes the
+    // results in a machine readable file.
+    void PrintResult(const std::string& metric, double value, const std::string& units) const;
+    // The null backend computes nothing, so the values are only checked with other backends.
+    bool CheckValue(const std::vector<float>& value, const std::vector<float>& expectedValue);
+
+  private:
+    double RunSteps(const std::function<void()>& step, const std::function<void()>& warmedUp);
+
+    unsigned int mIterations;
+    unsigned int mWarmupIterations;
+};
+
+#endif  // TESTS_PERF_TESTS_WEBNN_PERF_TEST_H_
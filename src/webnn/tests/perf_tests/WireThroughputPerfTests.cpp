@@ -0,0 +1,83 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/tests/perf_tests/WebnnPerfTest.h"
+
+#include <cstdlib>
+
+// Measures the throughput of uploading tensors through the wire. The small tensors fit in one
+// command with their payload, the large tensors are streamed in the chunks of the command buffer,
+// so the throughputs of both paths are printed side by side for the comparison. The client stages
+// the payloads in a full size buffer like before they were streamed when the tests run with the
+// WEBNN_WIRE_STAGE_PAYLOADS environment variable, the results have the "_staged" suffix then and
+// are the baseline of the streamed ones. The server still copied the payloads into its allocator
+// before, which isn't restored, so the baseline is slightly faster than the old path.
+class WireThroughputPerfTests : public WebnnPerfTest {
+  protected:
+    static constexpr unsigned int kIterations = 20;
+    static constexpr unsigned int kWarmupIterations = 2;
+    // 256 KiB of float32 fits in a chunk of the terrible command buffer and the ring buffer.
+    const std::vector<int32_t> kInlineShape = {64, 1024};
+    // 16 MiB of float32.
+    const std::vector<int32_t> kChunkedShape = {4, 1024, 1024};
+
+    WireThroughputPerfTests() : WebnnPerfTest(kIterations, kWarmupIterations) {
+    }
+
+    // Returns the throughput in MB/s, the step time is in microseconds, so the bytes per
+    // microsecond are MB/s.
+    double MeasureConstant(const std::vector<int32_t>& shape) {
+        const std::vector<float> data(utils::SizeOfShape(shape), 1.0f);
+        const size_t byteLength = data.size() * sizeof(float);
+        const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+        const double stepTime = RunWireSteps([&]() {
+            const wnn::Operand constant =
+                utils::BuildConstant(builder, shape, data.data(), byteLength);
+            DoFlush();
+        });
+        return byteLength / stepTime;
+    }
+
+    double MeasureInput(const std::vector<int32_t>& shape) {
+        const std::vector<float> data(utils::SizeOfShape(shape), 1.0f);
+        const size_t byteLength = data.size() * sizeof(float);
+        wnn::Input input = {};
+        input.resource.arrayBufferView = {const_cast<float*>(data.data()), byteLength};
+        const double stepTime = RunWireSteps([&]() {
+            wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+            namedInputs.Set("a", &input);
+            DoFlush();
+        });
+        return byteLength / stepTime;
+    }
+
+    void PrintThroughputs(double inlineThroughput, double chunkedThroughput) {
+        const std::string suffix =
+            std::getenv("WEBNN_WIRE_STAGE_PAYLOADS") != nullptr ? "_staged" : "";
+        PrintResult("throughput_inline" + suffix, inlineThroughput, "MB/s");
+        PrintResult("throughput_chunked" + suffix, chunkedThroughput, "MB/s");
+        // Below 1 if streaming the chunks is slower than copying the payload into one command.
+        PrintResult("chunked_to_inline" + suffix, chunkedThroughput / inlineThroughput, "ratio");
+    }
+};
+
+TEST_F(WireThroughputPerfTests, Constant) {
+    const double inlineThroughput = MeasureConstant(kInlineShape);
+    PrintThroughputs(inlineThroughput, MeasureConstant(kChunkedShape));
+}
+
+TEST_F(WireThroughputPerfTests, Input) {
+    const double inlineThroughput = MeasureInput(kInlineShape);
+    PrintThroughputs(inlineThroughput, MeasureInput(kChunkedShape));
+}
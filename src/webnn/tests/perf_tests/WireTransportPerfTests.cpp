@@ -0,0 +1,156 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/tests/perf_tests/WebnnPerfTest.h"
+
+// Measures the round trip of a compute through the wire and back, run with "-t terrible" and
+// "-t ring" to compare the in process transport with the ring buffers.
+class WireTransportPerfTests : public WebnnPerfTest {
+  protected:
+    wnn::Graph BuildAdd(const std::vector<int32_t>& shape) {
+        const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+        const wnn::Operand a = utils::BuildInput(builder, "a", shape);
+        const wnn::Operand b = utils::BuildInput(builder, "b", shape);
+        return utils::Build(builder, {{"c", builder.Add(a, b)}});
+    }
+
+    // Measures the latency from sending the compute until its results are received.
+    void RunRoundTrip(const std::vector<int32_t>& shape, bool async) {
+        const wnn::Graph graph = BuildAdd(shape);
+        ASSERT_TRUE(graph);
+        const std::vector<float> dataA(utils::SizeOfShape(shape), 1.0f);
+        const std::vector<float> dataB(utils::SizeOfShape(shape), 2.0f);
+        std::vector<float> result(utils::SizeOfShape(shape));
+        double stepTime;
+        if (async) {
+            stepTime = RunWireSteps([&]() {
+                wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+                wnn::Input inputA = {};
+                inputA.resource.arrayBufferView = {const_cast<float*>(dataA.data()),
+                                                   dataA.size() * sizeof(float)};
+                namedInputs.Set("a", &inputA);
+                wnn::Input inputB = {};
+                inputB.resource.arrayBufferView = {const_cast<float*>(dataB.data()),
+                                                   dataB.size() * sizeof(float)};
+                namedInputs.Set("b", &inputB);
+                wnn::NamedOutputs namedOutputs = CreateCppNamedOutputs();
+                wnn::Resource output = {};
+                output.arrayBufferView = {result.data(), result.size() * sizeof(float)};
+                namedOutputs.Set("c", &output);
+                bool done = false;
+                graph.ComputeAsync(
+                    namedInputs, namedOutputs,
+                    [](WNNErrorType type, char const* message, void* userdata) {
+                        EXPECT_EQ(type, WNNErrorType_NoError);
+                        *static_cast<bool*>(userdata) = true;
+                    },
+                    &done);
+                DoFlush();
+                EXPECT_TRUE(done);
+            });
+        } else {
+            stepTime = RunWireSteps(
+                [&]() { utils::Compute(graph, {{"a", dataA}, {"b", dataB}}, {{"c", result}}); });
+        }
+        EXPECT_TRUE(CheckValue(result, std::vector<float>(result.size(), 3.0f)));
+        PrintResult("round_trip", stepTime, "us");
+    }
+};
+
+TEST_F(WireTransportPerfTests, RoundTrip) {
+    RunRoundTrip({1}, false);
+}
+
+// 784 KiB of float32 per input and output.
+TEST_F(WireTransportPerfTests, RoundTripLarge) {
+    RunRoundTrip({1, 64, 56, 56}, false);
+}
+
+TEST_F(WireTransportPerfTests, ComputeAsyncRoundTrip) {
+    RunRoundTrip({1}, true);
+}
+
+TEST_F(WireTransportPerfTests, ComputeAsyncRoundTripLarge) {
+    RunRoundTrip({1, 64, 56, 56}, true);
+}
+
+// Only the data of the inputs is sent by the computes of the buffer set bound once.
+TEST_F(WireTransportPerfTests, BoundRoundTrip) {
+    const wnn::Graph graph = BuildAdd({1});
+    ASSERT_TRUE(graph);
+    std::vector<float> dataA = {1.0f}, dataB = {2.0f};
+    std::vector<float> result(1);
+    wnn::NamedInputs namedInputs = CreateCppNamedInputs();
+    wnn::Input inputA = {};
+    inputA.resource.arrayBufferView = {dataA.data(), dataA.size() * sizeof(float)};
+    namedInputs.Set("a", &inputA);
+    wnn::Input inputB = {};
+    inputB.resource.arrayBufferView = {dataB.data(), dataB.size() * sizeof(float)};
+    namedInputs.Set("b", &inputB);
+    wnn::NamedOutputs namedOutputs = CreateCppNamedOutputs();
+    wnn::Resource output = {};
+    output.arrayBufferView = {result.data(), result.size() * sizeof(float)};
+    namedOutputs.Set("c", &output);
+    graph.Bind(0, namedInputs, namedOutputs);
+    const double stepTime = RunWireSteps([&]() {
+        graph.ComputeBound(0);
+        DoFlush();
+    });
+    EXPECT_TRUE(CheckValue(result, {3.0f}));
+    PrintResult("bound_round_trip", stepTime, "us");
+}
+
+TEST_F(WireTransportPerfTests, Throughput) {
+    // 4 MiB of float32 per input and output.
+    const std::vector<int32_t> shape = {1024, 1024};
+    const wnn::Graph graph = BuildAdd(shape);
+    ASSERT_TRUE(graph);
+    const std::vector<float> dataA(utils::SizeOfShape(shape), 1.0f);
+    const std::vector<float> dataB(utils::SizeOfShape(shape), 2.0f);
+    std::vector<float> result(utils::SizeOfShape(shape));
+    const double stepTime = RunWireSteps(
+        [&]() { utils::Compute(graph, {{"a", dataA}, {"b", dataB}}, {{"c", result}}); });
+    EXPECT_TRUE(CheckValue(result, std::vector<float>(result.size(), 3.0f)));
+    // The step time is in microseconds, so the bytes per microsecond are MB/s.
+    const size_t byteLength = (dataA.size() + dataB.size() + result.size()) * sizeof(float);
+    PrintResult("throughput", byteLength / stepTime, "MB/s");
+}
+
+// Measures building a deep graph through the wire. The commands of the builder, the small
+// constants included, are coalesced into a few batches serialized in place before the build
+// command.
+class WireGraphBuildPerfTests : public WebnnPerfTest {
+  protected:
+    WireGraphBuildPerfTests() : WebnnPerfTest(20, 2) {
+    }
+};
+
+TEST_F(WireGraphBuildPerfTests, BuildDeepGraph) {
+    constexpr uint32_t kLayerCount = 200;
+    const std::vector<int32_t> shape = {1, 16};
+    const std::vector<float> bias(utils::SizeOfShape(shape), 0.1f);
+    const double stepTime = RunWireSteps([&]() {
+        const wnn::GraphBuilder builder = wnn::CreateGraphBuilder(GetContext());
+        wnn::Operand x = utils::BuildInput(builder, "x", shape);
+        for (uint32_t i = 0; i < kLayerCount; ++i) {
+            const wnn::Operand b =
+                utils::BuildConstant(builder, shape, bias.data(), bias.size() * sizeof(float));
+            x = builder.Relu(builder.Add(x, b));
+        }
+        const wnn::Graph graph = utils::Build(builder, {{"y", x}});
+        DoFlush();
+        EXPECT_TRUE(graph);
+    });
+    PrintResult("build_deep_graph", stepTime, "us");
+}
@@ -0,0 +1,152 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "webnn/wire/server/ComputeWorkerPool.h"
+
+namespace webnn::wire::server { namespace {
+
+    // The order the tasks ran in.
+    class TaskLog {
+      public:
+        void Add(int task) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTasks.push_back(task);
+        }
+        std::vector<int> Get() {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return mTasks;
+        }
+
+      private:
+        std::mutex mMutex;
+        std::vector<int> mTasks;
+    };
+
+    // The tasks of a key run in the order they are posted on any number of threads.
+    TEST(ComputeWorkerPoolTests, Ordering) {
+        TaskLog log;
+        std::vector<int> expected;
+        {
+            ComputeWorkerPool pool(4);
+            for (int i = 0; i < 100; ++i) {
+                pool.PostTask({1}, [&log, i]() { log.Add(i); });
+                expected.push_back(i);
+            }
+            pool.WaitForKey(1);
+            EXPECT_TRUE(pool.IsIdle(1));
+        }
+        EXPECT_EQ(log.Get(), expected);
+    }
+
+    // The tasks of different keys, e.g. the computes of two graphs, run concurrently.
+    TEST(ComputeWorkerPoolTests, ConcurrentKeys) {
+        ComputeWorkerPool pool(2);
+        std::promise<void> started;
+        std::shared_future<void> startedFuture = started.get_future().share();
+        std::atomic<bool> overlapped = false;
+        pool.PostTask({1}, [&]() {
+            overlapped = startedFuture.wait_for(std::chrono::seconds(10)) ==
+                         std::future_status::ready;
+        });
+        pool.PostTask({2}, [&]() { started.set_value(); });
+        pool.WaitForKey(1);
+        EXPECT_TRUE(overlapped);
+    }
+
+    // A task with several keys, e.g. a compute of a graph with its named outputs, runs after
+    // the tasks posted before with any of its keys, and before the tasks posted after.
+    TEST(ComputeWorkerPoolTests, SharedKey) {
+        TaskLog log;
+        std::promise<void> release;
+        std::shared_future<void> releaseFuture = release.get_future().share();
+        {
+            ComputeWorkerPool pool(4);
+            pool.PostTask({1}, [&]() {
+                releaseFuture.wait();
+                log.Add(0);
+            });
+            pool.PostTask({1, 2}, [&]() { log.Add(1); });
+            pool.PostTask({2}, [&]() { log.Add(2); });
+            pool.PostTask({3}, [&]() { log.Add(3); });
+            pool.WaitForKey(3);
+            EXPECT_FALSE(pool.IsIdle(2));
+            release.set_value();
+        }
+        EXPECT_EQ(log.Get(), std::vector<int>({3, 0, 1, 2}));
+    }
+
+    // The keys of an asynchronous task stay busy until it completes on another thread, so a
+    // set of the named inputs posted during the compute runs after the compute.
+    TEST(ComputeWorkerPoolTests, SetDuringAsyncCompute) {
+        TaskLog log;
+        ComputeWorkerPool::Completion completion;
+        std::promise<void> posted;
+        {
+            ComputeWorkerPool pool(2);
+            pool.PostAsyncTask({1, 2}, [&](ComputeWorkerPool::Completion taskCompletion) {
+                completion = std::move(taskCompletion);
+                posted.set_value();
+            });
+            posted.get_future().wait();
+            pool.PostTask({2}, [&]() { log.Add(1); });
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            EXPECT_FALSE(pool.IsIdle(1));
+            EXPECT_TRUE(log.Get().empty());
+
+            std::thread backend([&]() {
+                log.Add(0);
+                completion();
+            });
+            pool.WaitForKey(2);
+            backend.join();
+            EXPECT_TRUE(pool.IsIdle(1));
+        }
+        EXPECT_EQ(log.Get(), std::vector<int>({0, 1}));
+    }
+
+    // The queued tasks run and the asynchronous tasks complete before the pool is destroyed.
+    TEST(ComputeWorkerPoolTests, ShutdownWithQueuedTasks) {
+        std::atomic<int> count = 0;
+        std::thread backend;
+        {
+            ComputeWorkerPool pool(1);
+            pool.PostAsyncTask({0}, [&](ComputeWorkerPool::Completion completion) {
+                backend = std::thread([&count, completion]() {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    count++;
+                    completion();
+                });
+            });
+            for (uint64_t i = 0; i < 20; ++i) {
+                pool.PostTask({i % 4}, [&count]() {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    count++;
+                });
+            }
+        }
+        EXPECT_EQ(count, 21);
+        backend.join();
+    }
+
+}}  // namespace webnn::wire::server::
@@ -0,0 +1,241 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common/Platform.h"
+#include "webnn/utils/RingBuffer.h"
+#include "webnn/utils/SharedMemory.h"
+
+#if defined(DAWN_PLATFORM_POSIX)
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
+
+namespace {
+
+    class RingBufferTests : public testing::Test {
+      protected:
+        // The blocks of the ring hold at most 120 bytes.
+        static constexpr size_t kCapacity = 256;
+
+        void SetUp() override {
+            const size_t size = utils::RingBuffer::GetRequiredSize(kCapacity);
+            mMemory.resize((size + sizeof(CacheLine) - 1) / sizeof(CacheLine));
+            mRing = std::make_unique<utils::RingBuffer>(mMemory.data(), size);
+            mRing->Initialize();
+        }
+
+        // Publishes a block of |size| bytes filled with |value|, returns the header of the
+        // block.
+        char* WriteBlock(size_t size, char value) {
+            size_t capacity;
+            char* block = mRing->BeginBlock(size, &capacity);
+            EXPECT_NE(block, nullptr);
+            EXPECT_GE(capacity, size);
+            memset(block, value, size);
+            mRing->EndBlock(size);
+            return block - sizeof(uint64_t);
+        }
+
+        // Acquires and releases the next block, checking its content.
+        void ReadBlock(size_t size, char value) {
+            size_t blockSize;
+            const volatile char* block = mRing->AcquireBlock(&blockSize);
+            ASSERT_NE(block, nullptr);
+            ASSERT_EQ(blockSize, size);
+            for (size_t i = 0; i < size; ++i) {
+                ASSERT_EQ(block[i], value);
+            }
+            mRing->ReleaseBlock(blockSize);
+        }
+
+        // The control block of the ring is aligned to the cache lines.
+        struct alignas(64) CacheLine {
+            char bytes[64];
+        };
+        std::vector<CacheLine> mMemory;
+        std::unique_ptr<utils::RingBuffer> mRing;
+    };
+
+    // The blocks that don't fit before the end of the ring start again at the beginning, the
+    // content survives the wrap-around.
+    TEST_F(RingBufferTests, WrapAround) {
+        EXPECT_EQ(mRing->GetMaximumBlockSize(), 120u);
+        for (char i = 0; i < 20; ++i) {
+            WriteBlock(100, i);
+            ReadBlock(100, i);
+        }
+        EXPECT_TRUE(mRing->IsEmpty());
+        size_t size;
+        EXPECT_EQ(mRing->AcquireBlock(&size), nullptr);
+        EXPECT_FALSE(mRing->IsClosed());
+    }
+
+    // The producer waits while the ring is full until the consumer releases a block.
+    TEST_F(RingBufferTests, FullRing) {
+        WriteBlock(120, 1);
+        WriteBlock(100, 2);
+        std::atomic<bool> written = false;
+        std::thread producer([&]() {
+            WriteBlock(100, 3);
+            written = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(written);
+        ReadBlock(120, 1);
+        producer.join();
+        EXPECT_TRUE(written);
+        ReadBlock(100, 2);
+        ReadBlock(100, 3);
+        EXPECT_TRUE(mRing->IsEmpty());
+    }
+
+    // Closing the full ring wakes up the waiting producer.
+    TEST_F(RingBufferTests, CloseFullRing) {
+        WriteBlock(120, 1);
+        WriteBlock(100, 2);
+        std::thread producer([&]() {
+            size_t capacity;
+            EXPECT_EQ(mRing->BeginBlock(100, &capacity), nullptr);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        mRing->Close();
+        producer.join();
+        // The published blocks can still be acquired.
+        ReadBlock(120, 1);
+    }
+
+    // The consumer waiting for a block sleeps until the producer publishes one.
+    TEST_F(RingBufferTests, WaitForBlock) {
+        std::atomic<bool> woken = false;
+        std::thread consumer([&]() {
+            mRing->WaitForBlock();
+            woken = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_FALSE(woken);
+        WriteBlock(16, 1);
+        consumer.join();
+        EXPECT_TRUE(woken);
+        ReadBlock(16, 1);
+    }
+
+    // A header larger than the rest of the ring closes it instead of reading out of bounds.
+    TEST_F(RingBufferTests, OversizedHeader) {
+        char* header = WriteBlock(16, 1);
+        const uint64_t size = kCapacity;
+        memcpy(header, &size, sizeof(size));
+        size_t blockSize;
+        EXPECT_EQ(mRing->AcquireBlock(&blockSize), nullptr);
+        EXPECT_TRUE(mRing->IsClosed());
+    }
+
+    // A header larger than the published bytes closes the ring instead of reading the block
+    // being written.
+    TEST_F(RingBufferTests, CorruptHeader) {
+        char* header = WriteBlock(16, 1);
+        const uint64_t size = 64;
+        memcpy(header, &size, sizeof(size));
+        size_t blockSize;
+        EXPECT_EQ(mRing->AcquireBlock(&blockSize), nullptr);
+        EXPECT_TRUE(mRing->IsClosed());
+        size_t capacity;
+        EXPECT_EQ(mRing->BeginBlock(16, &capacity), nullptr);
+    }
+
+#if defined(DAWN_PLATFORM_POSIX)
+    // Reads |blockCount| blocks whose size and content are derived from their index, returns
+    // false if a block is wrong or the ring is closed.
+    bool ConsumeBlocks(utils::RingBuffer* ring, uint32_t blockCount) {
+        for (uint32_t i = 0; i < blockCount; ++i) {
+            size_t size;
+            const volatile char* block;
+            while ((block = ring->AcquireBlock(&size)) == nullptr) {
+                if (ring->IsClosed()) {
+                    return false;
+                }
+                ring->WaitForBlock();
+            }
+            if (size != i % 200 + 1) {
+                return false;
+            }
+            for (size_t j = 0; j < size; ++j) {
+                if (block[j] != static_cast<char>(i)) {
+                    return false;
+                }
+            }
+            ring->ReleaseBlock(size);
+        }
+        return true;
+    }
+
+    // The producer and the consumer are two processes mapping the same region like the wire
+    // client and server. The ring is small so the producer waits for the consumer, and the
+    // producer pauses so the consumer sleeps until it's woken by the other process.
+    TEST(RingBufferProcessTests, TwoProcesses) {
+        constexpr size_t kCapacity = 1024;
+        constexpr uint32_t kBlockCount = 20000;
+        const size_t size = utils::RingBuffer::GetRequiredSize(kCapacity);
+        std::unique_ptr<utils::SharedMemory> memory = utils::SharedMemory::Create(size);
+        if (memory == nullptr) {
+            GTEST_SKIP() << "Shared memory isn't supported on the platform.";
+        }
+        utils::RingBuffer producer(memory->GetData(), size);
+        producer.Initialize();
+
+        const pid_t pid = fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            // The consumer maps the region again like the server process does with the
+            // descriptor it received. The child exits without running the test harness.
+            std::unique_ptr<utils::SharedMemory> mapping =
+                utils::SharedMemory::Map(memory->GetFd(), size);
+            if (mapping == nullptr) {
+                _exit(2);
+            }
+            utils::RingBuffer consumer(mapping->GetData(), size);
+            _exit(ConsumeBlocks(&consumer, kBlockCount) ? 0 : 1);
+        }
+
+        for (uint32_t i = 0; i < kBlockCount; ++i) {
+            if (i % 5000 == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+            const size_t blockSize = i % 200 + 1;
+            size_t capacity;
+            char* block = producer.BeginBlock(blockSize, &capacity);
+            if (block == nullptr) {
+                ADD_FAILURE() << "The consumer closed the ring at block " << i;
+                break;
+            }
+            memset(block, static_cast<char>(i), blockSize);
+            producer.EndBlock(blockSize);
+        }
+        int status = 0;
+        ASSERT_EQ(waitpid(pid, &status, 0), pid);
+        ASSERT_TRUE(WIFEXITED(status));
+        EXPECT_EQ(WEXITSTATUS(status), 0);
+        EXPECT_TRUE(producer.IsEmpty());
+    }
+#endif  // defined(DAWN_PLATFORM_POSIX)
+
+}  // anonymous namespace
@@ -0,0 +1,65 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/Platform.h"
+#include "webnn/utils/SharedMemory.h"
+
+#if defined(DAWN_PLATFORM_POSIX)
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
+namespace {
+
+#if defined(DAWN_PLATFORM_POSIX)
+    // The descriptor of a region is passed over a socket like the client process passes it to
+    // the server process, the region mapped from the received descriptor is the same memory.
+    TEST(SharedMemoryTests, PassFileDescriptor) {
+        const size_t size = 4096;
+        std::unique_ptr<utils::SharedMemory> memory = utils::SharedMemory::Create(size);
+        if (memory == nullptr) {
+            GTEST_SKIP() << "Shared memory isn't supported on the platform.";
+        }
+        int sockets[2];
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+        EXPECT_TRUE(utils::SendFileDescriptor(sockets[0], memory->GetFd()));
+        const int fd = utils::ReceiveFileDescriptor(sockets[1]);
+        close(sockets[0]);
+        close(sockets[1]);
+        ASSERT_GE(fd, 0);
+        std::unique_ptr<utils::SharedMemory> mapping = utils::SharedMemory::Map(fd, size);
+        close(fd);
+        ASSERT_NE(mapping, nullptr);
+
+        static_cast<char*>(memory->GetData())[0] = 1;
+        static_cast<char*>(mapping->GetData())[size - 1] = 2;
+        EXPECT_EQ(static_cast<char*>(mapping->GetData())[0], 1);
+        EXPECT_EQ(static_cast<char*>(memory->GetData())[size - 1], 2);
+    }
+
+    // A message without a descriptor is rejected.
+    TEST(SharedMemoryTests, ReceiveWithoutFileDescriptor) {
+        int sockets[2];
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+        const char data = 0;
+        ASSERT_EQ(write(sockets[0], &data, sizeof(data)), 1);
+        EXPECT_EQ(utils::ReceiveFileDescriptor(sockets[1]), -1);
+        close(sockets[0]);
+        close(sockets[1]);
+    }
+#endif  // defined(DAWN_PLATFORM_POSIX)
+
+}  // anonymous namespace
@@ -0,0 +1,63 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "webnn/native/GraphBuilder.h"
+#include "webnn/native/NamedOperands.h"
+#include "webnn/native/mlas/ContextMLAS.h"
+#include "webnn/native/mlas/GraphMLAS.h"
+
+namespace webnn::native::mlas { namespace {
+
+    using ::testing::Test;
+
+    class GraphMLASTests : public Test {
+      protected:
+        void SetUp() override {
+            mContext = AcquireRef(new Context());
+            mBuilder = AcquireRef(new GraphBuilderBase(mContext.Get()));
+        }
+
+        Ref<GraphBase> Build(const OperandBase* output) {
+            Ref<NamedOperandsBase> namedOperands = AcquireRef(new NamedOperandsBase());
+            namedOperands->Set("output", output);
+            return AcquireRef(mBuilder->Build(namedOperands.Get()));
+        }
+
+        Ref<Context> mContext;
+        Ref<GraphBuilderBase> mBuilder;
+    };
+
+    // Each intermediate of a chain is only alive from its producer to its consumer, so the
+    // arena holds two of them at a time instead of all of them.
+    TEST_F(GraphMLASTests, PeakMemoryOfChain) {
+        constexpr int32_t kSize = 1024;
+        constexpr size_t kChainLength = 8;
+        const int32_t dimensions[] = {1, kSize};
+        OperandDescriptor desc = {wnn::OperandType::Float32, dimensions, 2};
+        OperandBase* operand = mBuilder->Input("input", &desc);
+        for (size_t i = 0; i < kChainLength; ++i) {
+            operand = mBuilder->Relu(operand);
+        }
+        Ref<GraphBase> graph = Build(operand);
+        ASSERT_FALSE(graph->IsError());
+        const Graph* mlasGraph = static_cast<const Graph*>(graph.Get());
+        const size_t intermediateBytes = kSize * sizeof(float);
+        EXPECT_EQ(mlasGraph->GetIntermediateMemoryBytes(), kChainLength * intermediateBytes);
+        EXPECT_LT(mlasGraph->GetPeakMemoryBytes(), mlasGraph->GetIntermediateMemoryBytes());
+        EXPECT_EQ(mlasGraph->GetPeakMemoryBytes(), 2 * intermediateBytes);
+    }
+
+}}  // namespace webnn::native::mlas::
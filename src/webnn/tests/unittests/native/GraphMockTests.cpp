@@ -14,9 +14,12 @@
 
 #include <gtest/gtest.h>
 
+#include "mocks/ContextMock.h"
 #include "mocks/GraphMock.h"
+#include "webnn/native/GraphBuilder.h"
 #include "webnn/native/NamedInputs.h"
 #include "webnn/native/NamedOutputs.h"
+#include "webnn/native/ops/Constant.h"
 
 namespace webnn::native { namespace {
 
@@ -32,6 +35,31 @@ namespace webnn::native { namespace {
         EXPECT_TRUE(graphMock.AddConstant(nullptr).IsSuccess());
     }
 
+    // The constant adds the value handed over by the wire server in place instead of a copy,
+    // and releases it once the builder is destroyed.
+    TEST_F(GraphMockTests, AddConstantWithBuffer) {
+        ContextMock contextMock;
+        Ref<GraphBuilderBase> builder = AcquireRef(new GraphBuilderBase(&contextMock));
+        const int32_t dimensions[] = {4};
+        OperandDescriptor desc = {wnn::OperandType::Float32, dimensions, 1};
+        std::vector<char> data(8 + 4 * sizeof(float));
+        const char* buffer = data.data() + 8;
+        uint32_t releaseCount = 0;
+        OperandBase* operand = builder->Constant(
+            &desc, buffer, 4 * sizeof(float),
+            [](void* userdata) { ++*static_cast<uint32_t*>(userdata); }, &releaseCount);
+        ASSERT_NE(operand, nullptr);
+        const op::Constant* constant = static_cast<const op::Constant*>(operand->Operator());
+        EXPECT_EQ(constant->GetBuffer(), buffer);
+        EXPECT_EQ(constant->GetByteLength(), 4 * sizeof(float));
+        EXPECT_EQ(constant->GetByteOffset(), 0u);
+        EXPECT_CALL(graphMock, AddConstant(constant)).Times(1);
+        EXPECT_TRUE(constant->AddToGraph(&graphMock).IsSuccess());
+        EXPECT_EQ(releaseCount, 0u);
+        builder = nullptr;
+        EXPECT_EQ(releaseCount, 1u);
+    }
+
     TEST_F(GraphMockTests, Compile) {
         EXPECT_CALL(graphMock, CompileImpl).Times(1);
         EXPECT_TRUE(graphMock.Compile().IsSuccess());
@@ -0,0 +1,102 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "webnn/native/onednn/PrimitiveCacheDNNL.h"
+
+namespace webnn::native::onednn { namespace {
+
+    using ::testing::Test;
+
+    class PrimitiveCacheDNNLTests : public Test {
+      protected:
+        void SetUp() override {
+            ASSERT_EQ(dnnl_engine_create(&mEngine, dnnl_cpu, 0), dnnl_success);
+        }
+
+        void TearDown() override {
+            dnnl_engine_destroy(mEngine);
+        }
+
+        // Gets the relu primitive of a tensor of |size| elements, the sizes are keyed apart.
+        PrimitiveCache::Entry GetRelu(PrimitiveCache& cache, int64_t size) {
+            PrimitiveCache::Entry entry;
+            dnnl_memory_desc_t memoryDesc;
+            const dnnl_dims_t dims = {1, size};
+            EXPECT_EQ(dnnl_memory_desc_init_by_tag(&memoryDesc, 2, dims, dnnl_f32, dnnl_ab),
+                      dnnl_success);
+            dnnl_eltwise_desc_t reluDesc;
+            EXPECT_EQ(dnnl_eltwise_forward_desc_init(&reluDesc, dnnl_forward, dnnl_eltwise_relu,
+                                                     &memoryDesc, 0, 0),
+                      dnnl_success);
+            EXPECT_EQ(cache.GetOrCreate(&reluDesc, nullptr, mEngine, &entry), dnnl_success);
+            EXPECT_NE(entry.primitive, nullptr);
+            return entry;
+        }
+
+        dnnl_engine_t mEngine = nullptr;
+    };
+
+    // The identical operations share the primitive.
+    TEST_F(PrimitiveCacheDNNLTests, Hit) {
+        PrimitiveCache cache;
+        const PrimitiveCache::Entry entry = GetRelu(cache, 16);
+        EXPECT_EQ(GetRelu(cache, 16).primitive, entry.primitive);
+        EXPECT_EQ(cache.GetHitCount(), 1u);
+        EXPECT_EQ(cache.GetMissCount(), 1u);
+        EXPECT_EQ(cache.GetSize(), 1u);
+    }
+
+    TEST_F(PrimitiveCacheDNNLTests, Miss) {
+        PrimitiveCache cache;
+        const PrimitiveCache::Entry entry = GetRelu(cache, 16);
+        EXPECT_NE(GetRelu(cache, 32).primitive, entry.primitive);
+        EXPECT_EQ(cache.GetHitCount(), 0u);
+        EXPECT_EQ(cache.GetMissCount(), 2u);
+        EXPECT_EQ(cache.GetSize(), 2u);
+    }
+
+    // The least recently used entry is evicted, the evicted primitive stays alive in the graphs
+    // holding it.
+    TEST_F(PrimitiveCacheDNNLTests, LruEviction) {
+        PrimitiveCache cache(2);
+        EXPECT_EQ(cache.GetCapacity(), 2u);
+        const PrimitiveCache::Entry entry16 = GetRelu(cache, 16);
+        const PrimitiveCache::Entry entry32 = GetRelu(cache, 32);
+        GetRelu(cache, 16);
+        GetRelu(cache, 64);
+        EXPECT_EQ(cache.GetSize(), 2u);
+        EXPECT_EQ(GetRelu(cache, 16).primitive, entry16.primitive);
+        EXPECT_NE(GetRelu(cache, 32).primitive, entry32.primitive);
+        EXPECT_EQ(cache.GetHitCount(), 2u);
+        EXPECT_EQ(cache.GetMissCount(), 4u);
+    }
+
+    // Lowering the capacity evicts the entries over it, the capacity 0 disables the cache.
+    TEST_F(PrimitiveCacheDNNLTests, SetCapacity) {
+        PrimitiveCache cache;
+        GetRelu(cache, 16);
+        GetRelu(cache, 32);
+        cache.SetCapacity(1);
+        EXPECT_EQ(cache.GetSize(), 1u);
+        cache.SetCapacity(0);
+        EXPECT_EQ(cache.GetSize(), 0u);
+        GetRelu(cache, 16);
+        GetRelu(cache, 16);
+        EXPECT_EQ(cache.GetSize(), 0u);
+        EXPECT_EQ(cache.GetHitCount(), 0u);
+    }
+
+}}  // namespace webnn::native::onednn::
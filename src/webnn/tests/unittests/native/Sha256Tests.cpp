@@ -0,0 +1,48 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "webnn/native/Sha256.h"
+
+namespace webnn::native { namespace {
+
+    // The test vectors of FIPS 180-4.
+    TEST(Sha256Tests, TestVectors) {
+        EXPECT_EQ(Sha256Hex("", 0),
+                  "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+        EXPECT_EQ(Sha256Hex("abc", 3),
+                  "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+        const std::string message = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+        EXPECT_EQ(Sha256Hex(message.data(), message.size()),
+                  "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+        const std::string million(1000000, 'a');
+        EXPECT_EQ(Sha256Hex(million.data(), million.size()),
+                  "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+    }
+
+    // The padding takes one more block if the length doesn't fit the last block.
+    TEST(Sha256Tests, BlockBoundaries) {
+        const std::string message55(55, 'x'), message56(56, 'x'), message64(64, 'x');
+        EXPECT_EQ(Sha256Hex(message55.data(), message55.size()),
+                  "d5e285683cd4efc02d021a5c62014694958901005d6f71e89e0989fac77e4072");
+        EXPECT_EQ(Sha256Hex(message56.data(), message56.size()),
+                  "04c26261370ee7541549d16dee320c723e3fd14671e66a099afe0a377c16888e");
+        EXPECT_EQ(Sha256Hex(message64.data(), message64.size()),
+                  "7ce100971f64e7001e8fe5a51973ecdfe1ced42befe7ee8d5fd6219506b5393c");
+    }
+
+}}  // namespace webnn::native::
@@ -0,0 +1,203 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "webnn/native/Sha256.h"
+#include "webnn/native/xnnpack/WeightsCacheXNN.h"
+
+namespace webnn::native::xnnpack { namespace {
+
+    using ::testing::Test;
+
+    class WeightsCacheXNNTests : public Test {
+      protected:
+        void SetUp() override {
+            mFilePath = ::testing::TempDir() + "webnn_weights_cache_test.bin";
+            std::remove(mFilePath.c_str());
+        }
+
+        void TearDown() override {
+            std::remove(mFilePath.c_str());
+        }
+
+        // Packs the kernel like XNNPACK does on a miss, the packed weights are the kernel with
+        // the bytes flipped.
+        size_t Pack(WeightsCache& cache, const std::vector<char>& kernel) {
+            WeightsCache::LookUpKey key = {1, kernel.data(), nullptr};
+            size_t offset = cache.LookUp(key);
+            if (offset != SIZE_MAX) {
+                return offset;
+            }
+            char* packed = static_cast<char*>(cache.ReserveSpace(kernel.size()));
+            for (size_t i = 0; i < kernel.size(); ++i) {
+                packed[i] = static_cast<char>(~kernel[i]);
+            }
+            return cache.LookUpOrInsert(key, packed, kernel.size());
+        }
+
+        std::string mFilePath;
+        const WeightsCache::FileHeader mHeader = {"revision", "isa", "sha256"};
+    };
+
+    // The graphs hold their own copies of identical weights, the packed weights are shared.
+    TEST_F(WeightsCacheXNNTests, ReuseAcrossGraphs) {
+        WeightsCache cache;
+        const std::vector<char> kernel0 = {1, 2, 3, 4};
+        const std::vector<char> kernel1 = kernel0;
+        cache.RegisterBuffer(kernel0.data(), kernel0.size(), {kernel0.size()});
+        cache.RegisterBuffer(kernel1.data(), kernel1.size(), {kernel1.size()});
+        const size_t offset = Pack(cache, kernel0);
+        EXPECT_EQ(Pack(cache, kernel1), offset);
+        EXPECT_EQ(cache.GetSize(), 1u);
+        EXPECT_EQ(cache.GetHitCount(), 1u);
+        EXPECT_EQ(cache.GetMissCount(), 1u);
+        const char* packed = static_cast<const char*>(cache.OffsetToAddr(offset));
+        EXPECT_EQ(packed[0], static_cast<char>(~1));
+    }
+
+    // The weights of unregistered buffers are packed for the runtime but never shared.
+    TEST_F(WeightsCacheXNNTests, UnregisteredBuffer) {
+        WeightsCache cache;
+        const std::vector<char> kernel0 = {1, 2, 3, 4};
+        const std::vector<char> kernel1 = kernel0;
+        const size_t offset = Pack(cache, kernel0);
+        EXPECT_NE(Pack(cache, kernel1), offset);
+        EXPECT_EQ(cache.GetSize(), 2u);
+        EXPECT_EQ(cache.GetHitCount(), 0u);
+    }
+
+    // The weights with the same digest but another byte length or shape are packed separately.
+    TEST_F(WeightsCacheXNNTests, KeyIncludesSizeAndShape) {
+        WeightsCache cache("", mHeader,
+                           [](const void* data, size_t size) { return std::string("collision"); });
+        const std::vector<char> kernel0 = {1, 2, 3, 4};
+        const std::vector<char> kernel1 = {5, 6, 7, 8, 9, 10};
+        const std::vector<char> kernel2 = {11, 12, 13, 14};
+        cache.RegisterBuffer(kernel0.data(), kernel0.size(), {2, 2});
+        cache.RegisterBuffer(kernel1.data(), kernel1.size(), {2, 3});
+        cache.RegisterBuffer(kernel2.data(), kernel2.size(), {4, 1});
+        const size_t offset0 = Pack(cache, kernel0);
+        const size_t offset1 = Pack(cache, kernel1);
+        const size_t offset2 = Pack(cache, kernel2);
+        EXPECT_NE(offset0, offset1);
+        EXPECT_NE(offset0, offset2);
+        EXPECT_EQ(cache.GetSize(), 3u);
+        EXPECT_EQ(cache.GetHitCount(), 0u);
+        EXPECT_EQ(Pack(cache, kernel2), offset2);
+        EXPECT_EQ(cache.GetHitCount(), 1u);
+        const char* packed = static_cast<const char*>(cache.OffsetToAddr(offset1));
+        EXPECT_EQ(packed[0], static_cast<char>(~5));
+    }
+
+    // Only the packed weights are written to the file, not the content of the kernel.
+    TEST_F(WeightsCacheXNNTests, FileSize) {
+        const std::vector<char> kernel(1024, 1);
+        {
+            WeightsCache cache(mFilePath, mHeader, Sha256Hex);
+            cache.RegisterBuffer(kernel.data(), kernel.size(), {kernel.size()});
+            Pack(cache, kernel);
+            cache.Finalize();
+        }
+        std::ifstream file(mFilePath, std::ios::binary | std::ios::ate);
+        EXPECT_LT(static_cast<size_t>(file.tellg()), 2 * kernel.size());
+    }
+
+    TEST_F(WeightsCacheXNNTests, LoadFromFile) {
+        const std::vector<char> kernel = {1, 2, 3, 4};
+        {
+            WeightsCache cache(mFilePath, mHeader, Sha256Hex);
+            cache.RegisterBuffer(kernel.data(), kernel.size(), {kernel.size()});
+            Pack(cache, kernel);
+            cache.Finalize();
+        }
+        WeightsCache cache(mFilePath, mHeader, Sha256Hex);
+        EXPECT_EQ(cache.GetSize(), 1u);
+        cache.RegisterBuffer(kernel.data(), kernel.size(), {kernel.size()});
+        const size_t offset = Pack(cache, kernel);
+        EXPECT_EQ(cache.GetHitCount(), 1u);
+        const char* packed = static_cast<const char*>(cache.OffsetToAddr(offset));
+        for (size_t i = 0; i < kernel.size(); ++i) {
+            EXPECT_EQ(packed[i], static_cast<char>(~kernel[i]));
+        }
+    }
+
+    // The packed weights of another XNNPACK revision, processor or digest are not loaded and
+    // the file is overwritten by the new packed weights.
+    TEST_F(WeightsCacheXNNTests, StaleFile) {
+        const std::vector<char> kernel = {1, 2, 3, 4};
+        {
+            WeightsCache cache(mFilePath, mHeader, Sha256Hex);
+            cache.RegisterBuffer(kernel.data(), kernel.size(), {kernel.size()});
+            Pack(cache, kernel);
+            cache.Finalize();
+        }
+        for (auto header : {WeightsCache::FileHeader{"other", "isa", "sha256"},
+                            WeightsCache::FileHeader{"revision", "other", "sha256"},
+                            WeightsCache::FileHeader{"revision", "isa", "other"}}) {
+            WeightsCache cache(mFilePath, header, Sha256Hex);
+            EXPECT_EQ(cache.GetSize(), 0u);
+        }
+
+        const WeightsCache::FileHeader newHeader = {"new", "isa", "sha256"};
+        {
+            WeightsCache cache(mFilePath, newHeader, Sha256Hex);
+            cache.RegisterBuffer(kernel.data(), kernel.size(), {kernel.size()});
+            Pack(cache, kernel);
+            EXPECT_EQ(cache.GetMissCount(), 1u);
+            cache.Finalize();
+        }
+        EXPECT_EQ(WeightsCache(mFilePath, newHeader, Sha256Hex).GetSize(), 1u);
+        EXPECT_EQ(WeightsCache(mFilePath, mHeader, Sha256Hex).GetSize(), 0u);
+    }
+
+    // A truncated file or a corrupted length loads the complete entries only.
+    TEST_F(WeightsCacheXNNTests, CorruptedFile) {
+        const std::vector<char> kernel0 = {1, 2, 3, 4};
+        const std::vector<char> kernel1 = {5, 6, 7, 8};
+        {
+            WeightsCache cache(mFilePath, mHeader, Sha256Hex);
+            cache.RegisterBuffer(kernel0.data(), kernel0.size(), {kernel0.size()});
+            cache.RegisterBuffer(kernel1.data(), kernel1.size(), {kernel1.size()});
+            Pack(cache, kernel0);
+            Pack(cache, kernel1);
+            cache.Finalize();
+        }
+        std::vector<char> content;
+        {
+            std::ifstream file(mFilePath, std::ios::binary);
+            content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        {
+            std::ofstream file(mFilePath, std::ios::binary | std::ios::trunc);
+            file.write(content.data(), content.size() - 1);
+        }
+        EXPECT_EQ(WeightsCache(mFilePath, mHeader, Sha256Hex).GetSize(), 1u);
+
+        // The length of the revision in the header is set to the largest length.
+        memset(content.data() + 8, 0xff, sizeof(uint64_t));
+        {
+            std::ofstream file(mFilePath, std::ios::binary | std::ios::trunc);
+            file.write(content.data(), content.size());
+        }
+        EXPECT_EQ(WeightsCache(mFilePath, mHeader, Sha256Hex).GetSize(), 0u);
+    }
+
+}}  // namespace webnn::native::xnnpack::
@@ -50,3 +50,33 @@ TEST_F(GraphValidationTest, BuildGraphError) {
     wnn::NamedOperands namedOperands = wnn::CreateNamedOperands();
     DAWN_ASSERT(mBuilder.Build(namedOperands) == nullptr);
 }
+
+// Compute the bound buffer sets, the results are checked by the AddTests end2end tests.
+TEST_F(GraphValidationTest, ComputeBoundSuccess) {
+    wnn::NamedOperands namedOperands = wnn::CreateNamedOperands();
+    namedOperands.Set("output", mOutput);
+    wnn::Graph graph = mBuilder.Build(namedOperands);
+    std::vector<std::vector<float>> inputData(2, std::vector<float>(4, 1));
+    std::vector<std::vector<float>> outputData(2, std::vector<float>(4));
+    for (uint32_t i = 0; i < 2; ++i) {
+        wnn::Input input = {};
+        input.resource.arrayBufferView = {inputData[i].data(), inputData[i].size() * sizeof(float)};
+        wnn::NamedInputs namedInputs = wnn::CreateNamedInputs();
+        namedInputs.Set("input", &input);
+        wnn::Resource output = {};
+        output.arrayBufferView = {outputData[i].data(), outputData[i].size() * sizeof(float)};
+        wnn::NamedOutputs namedOutputs = wnn::CreateNamedOutputs();
+        namedOutputs.Set("output", &output);
+        graph.Bind(i, namedInputs, namedOutputs);
+    }
+    graph.ComputeBound(1);
+    graph.ComputeBound(0);
+}
+
+// Compute the buffer set which isn't bound.
+TEST_F(GraphValidationTest, ComputeBoundError) {
+    wnn::NamedOperands namedOperands = wnn::CreateNamedOperands();
+    namedOperands.Set("output", mOutput);
+    wnn::Graph graph = mBuilder.Build(namedOperands);
+    ASSERT_CONTEXT_ERROR(graph.ComputeBound(0));
+}
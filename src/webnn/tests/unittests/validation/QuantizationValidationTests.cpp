@@ -0,0 +1,153 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/tests/unittests/validation/ValidationTest.h"
+
+#include <memory>
+
+using namespace testing;
+
+class QuantizationValidationTest : public ValidationTest {};
+
+TEST_F(QuantizationValidationTest, QuantizationParams) {
+    std::vector<int32_t> shape = {2, 3};
+    wnn::OperandDescriptor int8Desc = {wnn::OperandType::Int8, shape.data(),
+                                       (uint32_t)shape.size()};
+    wnn::Operand a = mBuilder.Input("a", &int8Desc);
+    // success - per-tensor quantization.
+    {
+        std::vector<float> scales = {0.5};
+        std::vector<int32_t> zeroPoints = {1};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data(),
+                                          static_cast<uint32_t>(zeroPoints.size()),
+                                          zeroPoints.data()};
+        mBuilder.SetQuantizationParams(a, &params);
+    }
+    // success - per-channel quantization without zero points.
+    {
+        std::vector<float> scales = {0.5, 0.25, 0.125};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data()};
+        params.axis = 1;
+        mBuilder.SetQuantizationParams(a, &params);
+    }
+    // success - the bias of quantized conv2d or gemm is int32.
+    {
+        wnn::OperandDescriptor int32Desc = {wnn::OperandType::Int32, shape.data(),
+                                            (uint32_t)shape.size()};
+        wnn::Operand bias = mBuilder.Input("bias", &int32Desc);
+        std::vector<float> scales = {0.5, 0.25};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data()};
+        mBuilder.SetQuantizationParams(bias, &params);
+    }
+    // the float32 operand can't be quantized.
+    {
+        wnn::OperandDescriptor floatDesc = {wnn::OperandType::Float32, shape.data(),
+                                            (uint32_t)shape.size()};
+        wnn::Operand b = mBuilder.Input("b", &floatDesc);
+        std::vector<float> scales = {0.5};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data()};
+        ASSERT_CONTEXT_ERROR(mBuilder.SetQuantizationParams(b, &params));
+    }
+    // the scales are empty.
+    {
+        wnn::QuantizationParams params = {};
+        ASSERT_CONTEXT_ERROR(mBuilder.SetQuantizationParams(a, &params));
+    }
+    // the count of zero points is not equal to the count of scales.
+    {
+        std::vector<float> scales = {0.5, 0.25, 0.125};
+        std::vector<int32_t> zeroPoints = {0, 0};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data(),
+                                          static_cast<uint32_t>(zeroPoints.size()),
+                                          zeroPoints.data(), 1};
+        ASSERT_CONTEXT_ERROR(mBuilder.SetQuantizationParams(a, &params));
+    }
+    // the axis is out of range.
+    {
+        std::vector<float> scales = {0.5, 0.25, 0.125};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data()};
+        params.axis = 2;
+        ASSERT_CONTEXT_ERROR(mBuilder.SetQuantizationParams(a, &params));
+    }
+    // the count of scales is not equal to the size of axis.
+    {
+        std::vector<float> scales = {0.5, 0.25, 0.125};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data()};
+        params.axis = 0;
+        ASSERT_CONTEXT_ERROR(mBuilder.SetQuantizationParams(a, &params));
+    }
+    // the scale is not positive.
+    {
+        std::vector<float> scales = {0};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data()};
+        ASSERT_CONTEXT_ERROR(mBuilder.SetQuantizationParams(a, &params));
+    }
+    // the zero point is out of the range of int8.
+    {
+        std::vector<float> scales = {0.5};
+        std::vector<int32_t> zeroPoints = {128};
+        wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data(),
+                                          static_cast<uint32_t>(zeroPoints.size()),
+                                          zeroPoints.data()};
+        ASSERT_CONTEXT_ERROR(mBuilder.SetQuantizationParams(a, &params));
+    }
+}
+
+// The quantization params are set before the operands are consumed, since the conv2d validates
+// the types of its operands when it's created.
+TEST_F(QuantizationValidationTest, Conv2dWithQuantizedFilter) {
+    std::vector<int32_t> inputShape = {1, 1, 5, 5};
+    wnn::OperandDescriptor inputDesc = {wnn::OperandType::Float32, inputShape.data(),
+                                        (uint32_t)inputShape.size()};
+    wnn::Operand input = mBuilder.Input("input", &inputDesc);
+    std::vector<int32_t> filterShape = {1, 1, 3, 3};
+    wnn::OperandDescriptor filterDesc = {wnn::OperandType::Int8, filterShape.data(),
+                                         (uint32_t)filterShape.size()};
+    std::vector<int8_t> filterData(9, 1);
+    wnn::ArrayBufferView filterBuffer = {filterData.data(), filterData.size()};
+    std::vector<float> scales = {0.5};
+    wnn::QuantizationParams params = {static_cast<uint32_t>(scales.size()), scales.data()};
+    // success - the float32 input with the quantized int8 filter.
+    {
+        wnn::Operand filter = mBuilder.Constant(&filterDesc, &filterBuffer);
+        mBuilder.SetQuantizationParams(filter, &params);
+        wnn::Operand conv = mBuilder.Conv2d(input, filter);
+    }
+    // success - the quantized int8 input with the quantized int8 filter.
+    {
+        wnn::OperandDescriptor int8InputDesc = {wnn::OperandType::Int8, inputShape.data(),
+                                                (uint32_t)inputShape.size()};
+        wnn::Operand int8Input = mBuilder.Input("int8Input", &int8InputDesc);
+        mBuilder.SetQuantizationParams(int8Input, &params);
+        wnn::Operand filter = mBuilder.Constant(&filterDesc, &filterBuffer);
+        mBuilder.SetQuantizationParams(filter, &params);
+        wnn::Operand conv = mBuilder.Conv2d(int8Input, filter);
+    }
+    // the int8 filter without quantization params.
+    {
+        wnn::Operand filter = mBuilder.Constant(&filterDesc, &filterBuffer);
+        ASSERT_CONTEXT_ERROR(mBuilder.Conv2d(input, filter));
+    }
+    // the quantized int32 filter isn't an 8-bit filter.
+    {
+        wnn::OperandDescriptor int32FilterDesc = {wnn::OperandType::Int32, filterShape.data(),
+                                                  (uint32_t)filterShape.size()};
+        std::vector<int32_t> int32FilterData(9, 1);
+        wnn::ArrayBufferView int32FilterBuffer = {int32FilterData.data(),
+                                                  int32FilterData.size() * sizeof(int32_t)};
+        wnn::Operand filter = mBuilder.Constant(&int32FilterDesc, &int32FilterBuffer);
+        mBuilder.SetQuantizationParams(filter, &params);
+        ASSERT_CONTEXT_ERROR(mBuilder.Conv2d(input, filter));
+    }
+}
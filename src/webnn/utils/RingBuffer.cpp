@@ -0,0 +1,249 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/utils/RingBuffer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include "common/Assert.h"
+#include "common/Platform.h"
+
+#if defined(DAWN_PLATFORM_LINUX)
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace utils {
+
+    namespace {
+
+        // Each block starts with a header holding its size, the blocks are aligned so the
+        // header of the next block always fits before the end of the ring.
+        constexpr size_t kHeaderSize = sizeof(uint64_t);
+        constexpr size_t kBlockAlignment = sizeof(uint64_t);
+        // The header of the padding at the end of the ring when a block starts again at the
+        // beginning.
+        constexpr uint64_t kWrapHeader = UINT64_MAX;
+
+        size_t AlignBlockSize(size_t size) {
+            return (size + kBlockAlignment - 1) & ~(kBlockAlignment - 1);
+        }
+
+        constexpr uint32_t kSpinCount = 100;
+        constexpr uint32_t kYieldCount = 1000;
+
+        // Sleeps until the futex word no longer holds |value| or the word is woken. The word is
+        // in the shared region, so the futex isn't private to the process.
+        void FutexWait(std::atomic<uint32_t>* word, uint32_t value) {
+#if defined(DAWN_PLATFORM_LINUX)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, value, nullptr,
+                    nullptr, 0);
+#else
+            // There is no futex shared by processes, so the word is polled.
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+#endif
+        }
+
+        void FutexWake(std::atomic<uint32_t>* word) {
+#if defined(DAWN_PLATFORM_LINUX)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX, nullptr,
+                    nullptr, 0);
+#endif
+        }
+
+        // Waits until |ready| returns true, the other side signals the event once it changed
+        // the state checked by |ready|. Spins and yields first since the other side is usually
+        // busy on another core, then sleeps so an idle side doesn't burn a core.
+        template <typename Event, typename Ready>
+        void WaitForEvent(Event* event, Ready&& ready) {
+            for (uint32_t i = 0; i < kSpinCount + kYieldCount; ++i) {
+                if (ready()) {
+                    return;
+                }
+                if (i >= kSpinCount) {
+                    std::this_thread::yield();
+                }
+            }
+            while (true) {
+                // The waiter is counted before the sequence is read and the state is checked
+                // again, so the signal of a change after the check either sees the waiter or
+                // changes the sequence before the futex sleeps.
+                event->waiterCount.fetch_add(1, std::memory_order_seq_cst);
+                const uint32_t sequence = event->sequence.load(std::memory_order_seq_cst);
+                const bool isReady = ready();
+                if (!isReady) {
+                    FutexWait(&event->sequence, sequence);
+                }
+                event->waiterCount.fetch_sub(1, std::memory_order_seq_cst);
+                if (isReady) {
+                    return;
+                }
+            }
+        }
+
+        template <typename Event>
+        void SignalEvent(Event* event) {
+            event->sequence.fetch_add(1, std::memory_order_seq_cst);
+            if (event->waiterCount.load(std::memory_order_seq_cst) != 0) {
+                FutexWake(&event->sequence);
+            }
+        }
+
+    }  // anonymous namespace
+
+    // static
+    size_t RingBuffer::GetRequiredSize(size_t capacity) {
+        return sizeof(ControlBlock) + AlignBlockSize(capacity);
+    }
+
+    RingBuffer::RingBuffer(void* memory, size_t size)
+        : mControl(static_cast<ControlBlock*>(memory)),
+          mData(static_cast<char*>(memory) + sizeof(ControlBlock)),
+          mCapacity((size - sizeof(ControlBlock)) & ~(kBlockAlignment - 1)) {
+        DAWN_ASSERT(size > sizeof(ControlBlock) + 2 * kHeaderSize);
+        DAWN_ASSERT(reinterpret_cast<uintptr_t>(memory) % alignof(ControlBlock) == 0);
+    }
+
+    void RingBuffer::Initialize() {
+        new (mControl) ControlBlock();
+        mControl->writeOffset.store(0, std::memory_order_relaxed);
+        mControl->readOffset.store(0, std::memory_order_relaxed);
+        for (Event* event : {&mControl->published, &mControl->released}) {
+            event->sequence.store(0, std::memory_order_relaxed);
+            event->waiterCount.store(0, std::memory_order_relaxed);
+        }
+        mControl->closed.store(0, std::memory_order_release);
+    }
+
+    size_t RingBuffer::GetCapacity() const {
+        return mCapacity;
+    }
+
+    size_t RingBuffer::GetMaximumBlockSize() const {
+        // Keeps at least half of the ring for the blocks in flight.
+        return (mCapacity / 2 - kHeaderSize) & ~(kBlockAlignment - 1);
+    }
+
+    size_t RingBuffer::GetFreeSize(uint64_t writeOffset) const {
+        uint64_t readOffset = mControl->readOffset.load(std::memory_order_acquire);
+        return mCapacity - static_cast<size_t>(writeOffset - readOffset);
+    }
+
+    void RingBuffer::WriteHeader(uint64_t offset, uint64_t value) {
+        memcpy(mData + offset % mCapacity, &value, kHeaderSize);
+    }
+
+    char* RingBuffer::BeginBlock(size_t size, size_t* capacity) {
+        DAWN_ASSERT(size <= GetMaximumBlockSize());
+        size_t requiredSize = kHeaderSize + AlignBlockSize(size);
+        uint64_t writeOffset = mControl->writeOffset.load(std::memory_order_relaxed);
+
+        // Pads the end of the ring if the block doesn't fit before it.
+        size_t contiguousSize = mCapacity - writeOffset % mCapacity;
+        if (contiguousSize < requiredSize) {
+            WaitForEvent(&mControl->released, [&]() {
+                return GetFreeSize(writeOffset) >= contiguousSize || IsClosed();
+            });
+            if (IsClosed()) {
+                return nullptr;
+            }
+            WriteHeader(writeOffset, kWrapHeader);
+            writeOffset += contiguousSize;
+            mControl->writeOffset.store(writeOffset, std::memory_order_release);
+            contiguousSize = mCapacity;
+        }
+
+        size_t freeSize;
+        WaitForEvent(&mControl->released, [&]() {
+            freeSize = GetFreeSize(writeOffset);
+            return freeSize >= requiredSize || IsClosed();
+        });
+        if (IsClosed()) {
+            return nullptr;
+        }
+        mBlockOffset = writeOffset;
+        size_t availableSize = std::min(contiguousSize, freeSize) - kHeaderSize;
+        *capacity = std::min(availableSize & ~(kBlockAlignment - 1), GetMaximumBlockSize());
+        return mData + writeOffset % mCapacity + kHeaderSize;
+    }
+
+    void RingBuffer::EndBlock(size_t size) {
+        WriteHeader(mBlockOffset, size);
+        mControl->writeOffset.store(mBlockOffset + kHeaderSize + AlignBlockSize(size),
+                                    std::memory_order_release);
+        SignalEvent(&mControl->published);
+    }
+
+    bool RingBuffer::IsEmpty() const {
+        uint64_t writeOffset = mControl->writeOffset.load(std::memory_order_relaxed);
+        return mControl->readOffset.load(std::memory_order_acquire) == writeOffset;
+    }
+
+    const volatile char* RingBuffer::AcquireBlock(size_t* size) {
+        uint64_t readOffset = mControl->readOffset.load(std::memory_order_relaxed);
+        uint64_t writeOffset = mControl->writeOffset.load(std::memory_order_acquire);
+        while (readOffset != writeOffset) {
+            size_t position = readOffset % mCapacity;
+            uint64_t header;
+            memcpy(&header, mData + position, kHeaderSize);
+            if (header == kWrapHeader) {
+                readOffset += mCapacity - position;
+                mControl->readOffset.store(readOffset, std::memory_order_release);
+                SignalEvent(&mControl->released);
+                continue;
+            }
+            // The producer may be another process, so the header isn't trusted.
+            if (header > mCapacity - position - kHeaderSize ||
+                kHeaderSize + AlignBlockSize(header) > writeOffset - readOffset) {
+                Close();
+                return nullptr;
+            }
+            *size = static_cast<size_t>(header);
+            return mData + position + kHeaderSize;
+        }
+        return nullptr;
+    }
+
+    void RingBuffer::ReleaseBlock(size_t size) {
+        uint64_t readOffset = mControl->readOffset.load(std::memory_order_relaxed);
+        mControl->readOffset.store(readOffset + kHeaderSize + AlignBlockSize(size),
+                                   std::memory_order_release);
+        SignalEvent(&mControl->released);
+    }
+
+    void RingBuffer::WaitForBlock() {
+        uint64_t readOffset = mControl->readOffset.load(std::memory_order_relaxed);
+        WaitForEvent(&mControl->published, [&]() {
+            return mControl->writeOffset.load(std::memory_order_acquire) != readOffset ||
+                   IsClosed();
+        });
+    }
+
+    void RingBuffer::Close() {
+        mControl->closed.store(1, std::memory_order_release);
+        SignalEvent(&mControl->published);
+        SignalEvent(&mControl->released);
+    }
+
+    bool RingBuffer::IsClosed() const {
+        return mControl->closed.load(std::memory_order_acquire) != 0;
+    }
+
+}  // namespace utils
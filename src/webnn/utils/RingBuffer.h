@@ -0,0 +1,102 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_RING_BUFFER_H_
+#define UTILS_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+
+    // A lock-free single producer single consumer ring of variable sized blocks, placed in a
+    // memory region that may be shared by two processes. Each block is contiguous in memory,
+    // a block that doesn't fit before the end of the ring starts again at the beginning. The
+    // producer waits while the ring is full and the consumer releases the blocks it handled.
+    // A waiting side spins briefly, then sleeps on a futex in the region on Linux until the
+    // other side wakes it. Other platforms poll instead.
+    class RingBuffer {
+      public:
+        // Returns the size of the region for a ring of |capacity| bytes of blocks.
+        static size_t GetRequiredSize(size_t capacity);
+
+        // The region isn't owned, the ring is initialized by the process that created it.
+        RingBuffer(void* memory, size_t size);
+        void Initialize();
+
+        size_t GetCapacity() const;
+        // The largest block that always fits in the ring.
+        size_t GetMaximumBlockSize() const;
+
+        // Producer. Returns the space of a block of at least |size| bytes and sets the size
+        // that is available in |capacity|, waiting while the ring is full. The block is
+        // published by EndBlock with the size that is used. Returns nullptr if the ring is
+        // closed.
+        char* BeginBlock(size_t size, size_t* capacity);
+        void EndBlock(size_t size);
+
+        // Returns true if the consumer released all the published blocks.
+        bool IsEmpty() const;
+
+        // Consumer. Returns the next published block, or nullptr if there is none.
+        const volatile char* AcquireBlock(size_t* size);
+        void ReleaseBlock(size_t size);
+        // Waits until a block is published or the ring is closed.
+        void WaitForBlock();
+
+        // Closing wakes up the waiting producer and consumer, the published blocks can still
+        // be acquired.
+        void Close();
+        bool IsClosed() const;
+
+      private:
+        static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                      "The ring is shared by processes so the atomics must be lock-free.");
+
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+                      "The sequence of an event is the futex word.");
+
+        // The sequence is the futex the waiting side sleeps on, the other side increments it
+        // and only wakes the waiters with a system call if there are any.
+        struct Event {
+            std::atomic<uint32_t> sequence;
+            std::atomic<uint32_t> waiterCount;
+        };
+
+        // The offsets are the total bytes written and read, so the ring is empty when they are
+        // equal. Each offset is on its own cache line to avoid false sharing.
+        struct ControlBlock {
+            alignas(64) std::atomic<uint64_t> writeOffset;
+            alignas(64) std::atomic<uint64_t> readOffset;
+            alignas(64) std::atomic<uint32_t> closed;
+            // Signaled when a block is published or the ring is closed.
+            alignas(64) Event published;
+            // Signaled when blocks are released or the ring is closed.
+            alignas(64) Event released;
+        };
+
+        size_t GetFreeSize(uint64_t writeOffset) const;
+        void WriteHeader(uint64_t offset, uint64_t value);
+
+        ControlBlock* mControl;
+        char* mData;
+        size_t mCapacity;
+        // The offset of the block between BeginBlock and EndBlock.
+        uint64_t mBlockOffset = 0;
+    };
+
+}  // namespace utils
+
+#endif  // UTILS_RING_BUFFER_H_
@@ -0,0 +1,126 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/utils/RingBufferCommandBuffer.h"
+
+#include "common/Assert.h"
+
+namespace utils {
+
+    RingBufferCommandSerializer::RingBufferCommandSerializer(RingBuffer* ring) : mRing(ring) {
+    }
+
+    size_t RingBufferCommandSerializer::GetMaximumAllocationSize() const {
+        return mRing->GetMaximumBlockSize();
+    }
+
+    void* RingBufferCommandSerializer::GetCmdSpace(size_t size) {
+        if (size > GetMaximumAllocationSize()) {
+            return nullptr;
+        }
+        if (mBlock != nullptr && mBlockCapacity - mOffset < size) {
+            if (!Flush()) {
+                return nullptr;
+            }
+        }
+        if (mBlock == nullptr) {
+            mBlock = mRing->BeginBlock(size, &mBlockCapacity);
+            if (mBlock == nullptr) {
+                return nullptr;
+            }
+        }
+
+        char* result = mBlock + mOffset;
+        mOffset += size;
+        mSerializedByteCount += size;
+        return result;
+    }
+
+    bool RingBufferCommandSerializer::Flush() {
+        if (mBlock != nullptr) {
+            mRing->EndBlock(mOffset);
+            mBlock = nullptr;
+            mBlockCapacity = 0;
+            mOffset = 0;
+        }
+        return !mRing->IsClosed();
+    }
+
+    bool RingBufferCommandSerializer::IsHandled() const {
+        return mRing->IsEmpty();
+    }
+
+    uint64_t RingBufferCommandSerializer::GetSerializedByteCount() const {
+        return mSerializedByteCount;
+    }
+
+    RingBufferCommandReceiver::RingBufferCommandReceiver(
+        RingBuffer* ring,
+        webnn::wire::CommandHandler* handler,
+        std::function<bool()> flushResponses)
+        : mRing(ring), mHandler(handler), mFlushResponses(std::move(flushResponses)) {
+    }
+
+    RingBufferCommandReceiver::~RingBufferCommandReceiver() {
+        Stop();
+    }
+
+    bool RingBufferCommandReceiver::ProcessCommands() {
+        size_t size;
+        while (const volatile char* block = mRing->AcquireBlock(&size)) {
+            bool success = mHandler->HandleCommands(block, size) != nullptr;
+            if (mFlushResponses) {
+                success = mFlushResponses() && success;
+            }
+            mRing->ReleaseBlock(size);
+            if (!success) {
+                mRing->Close();
+                return false;
+            }
+        }
+        return !mRing->IsClosed();
+    }
+
+    bool RingBufferCommandReceiver::ProcessCommandsUntil(const std::function<bool()>& done) {
+        while (true) {
+            bool finished = done();
+            if (!ProcessCommands()) {
+                return false;
+            }
+            if (finished) {
+                return true;
+            }
+            // |done| usually depends on the other side, so it's polled instead of waiting for a
+            // block.
+            std::this_thread::yield();
+        }
+    }
+
+    void RingBufferCommandReceiver::Start() {
+        DAWN_ASSERT(!mThread.joinable());
+        mThread = std::thread([this]() {
+            while (ProcessCommands()) {
+                mRing->WaitForBlock();
+            }
+        });
+    }
+
+    void RingBufferCommandReceiver::Stop() {
+        if (mThread.joinable()) {
+            mRing->Close();
+            mThread.join();
+        }
+    }
+
+}  // namespace utils
@@ -0,0 +1,83 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_RING_BUFFER_COMMAND_BUFFER_H_
+#define UTILS_RING_BUFFER_COMMAND_BUFFER_H_
+
+#include <functional>
+#include <thread>
+
+#include "webnn/utils/RingBuffer.h"
+#include "webnn/wire/Wire.h"
+
+namespace utils {
+
+    // Serializes the commands into the blocks of a ring, Flush publishes the block to the
+    // receiver and GetCmdSpace waits while the ring is full. Unlike TerribleCommandBuffer the
+    // commands are handled asynchronously by the receiver, which may be on another thread or
+    // in another process sharing the memory of the ring.
+    class RingBufferCommandSerializer : public webnn::wire::CommandSerializer {
+      public:
+        explicit RingBufferCommandSerializer(RingBuffer* ring);
+
+        size_t GetMaximumAllocationSize() const override;
+
+        void* GetCmdSpace(size_t size) override;
+        bool Flush() override;
+
+        // Returns true once the receiver handled all the flushed blocks.
+        bool IsHandled() const;
+        // The bytes of all the commands serialized so far.
+        uint64_t GetSerializedByteCount() const;
+
+      private:
+        RingBuffer* mRing;
+        char* mBlock = nullptr;
+        size_t mBlockCapacity = 0;
+        size_t mOffset = 0;
+        uint64_t mSerializedByteCount = 0;
+    };
+
+    // Hands the blocks of a ring to the command handler, either on the calling thread with
+    // ProcessCommands or on its own thread after Start. The responses are flushed before a
+    // block is released, so they are published once the producer sees its block handled.
+    class RingBufferCommandReceiver {
+      public:
+        RingBufferCommandReceiver(RingBuffer* ring,
+                                  webnn::wire::CommandHandler* handler,
+                                  std::function<bool()> flushResponses = nullptr);
+        ~RingBufferCommandReceiver();
+
+        // Handles the published blocks. Returns false if the handler fails or the ring is
+        // closed.
+        bool ProcessCommands();
+        // Handles the blocks until |done| returns true, the blocks published before |done|
+        // returns true are handled too.
+        bool ProcessCommandsUntil(const std::function<bool()>& done);
+
+        // The handler is then only called on the thread of the receiver, Stop closes the ring
+        // and joins the thread.
+        void Start();
+        void Stop();
+
+      private:
+        RingBuffer* mRing;
+        webnn::wire::CommandHandler* mHandler;
+        std::function<bool()> mFlushResponses;
+        std::thread mThread;
+    };
+
+}  // namespace utils
+
+#endif  // UTILS_RING_BUFFER_COMMAND_BUFFER_H_
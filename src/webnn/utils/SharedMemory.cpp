@@ -0,0 +1,163 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/utils/SharedMemory.h"
+
+#include "common/Platform.h"
+
+#if defined(DAWN_PLATFORM_POSIX)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#    include <atomic>
+#    include <cstring>
+#    include <string>
+#endif
+
+namespace utils {
+
+#if defined(DAWN_PLATFORM_POSIX)
+    namespace {
+
+        int CreateSharedMemoryFd() {
+#    if defined(DAWN_PLATFORM_LINUX)
+            return memfd_create("webnn-shared-memory", MFD_CLOEXEC);
+#    else
+            // The name is unlinked at once, so the region only lives through the descriptors.
+            static std::atomic<uint32_t> sCount(0);
+            std::string name = "/webnn-shared-memory-" + std::to_string(getpid()) + "-" +
+                               std::to_string(sCount++);
+            int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd >= 0) {
+                shm_unlink(name.c_str());
+            }
+            return fd;
+#    endif
+        }
+
+    }  // anonymous namespace
+
+    // static
+    std::unique_ptr<SharedMemory> SharedMemory::Create(size_t size) {
+        int fd = CreateSharedMemoryFd();
+        if (fd < 0) {
+            return nullptr;
+        }
+        if (ftruncate(fd, size) != 0) {
+            close(fd);
+            return nullptr;
+        }
+        std::unique_ptr<SharedMemory> sharedMemory = Map(fd, size);
+        close(fd);
+        return sharedMemory;
+    }
+
+    // static
+    std::unique_ptr<SharedMemory> SharedMemory::Map(int fd, size_t size) {
+        int duplicatedFd = dup(fd);
+        if (duplicatedFd < 0) {
+            return nullptr;
+        }
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, duplicatedFd, 0);
+        if (data == MAP_FAILED) {
+            close(duplicatedFd);
+            return nullptr;
+        }
+        return std::unique_ptr<SharedMemory>(new SharedMemory(duplicatedFd, data, size));
+    }
+
+    SharedMemory::~SharedMemory() {
+        munmap(mData, mSize);
+        close(mFd);
+    }
+
+    bool SendFileDescriptor(int socket, int fd) {
+        // At least one byte of data is sent with the ancillary data.
+        char data = 0;
+        iovec io = {&data, sizeof(data)};
+        char control[CMSG_SPACE(sizeof(int))] = {};
+        msghdr message = {};
+        message.msg_iov = &io;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        cmsghdr* header = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SCM_RIGHTS;
+        header->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(header), &fd, sizeof(int));
+        return sendmsg(socket, &message, 0) == sizeof(data);
+    }
+
+    int ReceiveFileDescriptor(int socket) {
+        char data;
+        iovec io = {&data, sizeof(data)};
+        char control[CMSG_SPACE(sizeof(int))] = {};
+        msghdr message = {};
+        message.msg_iov = &io;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        if (recvmsg(socket, &message, 0) != sizeof(data)) {
+            return -1;
+        }
+        cmsghdr* header = CMSG_FIRSTHDR(&message);
+        if (header == nullptr || header->cmsg_level != SOL_SOCKET ||
+            header->cmsg_type != SCM_RIGHTS || header->cmsg_len != CMSG_LEN(sizeof(int))) {
+            return -1;
+        }
+        int fd;
+        memcpy(&fd, CMSG_DATA(header), sizeof(int));
+        return fd;
+    }
+#else
+    // static
+    std::unique_ptr<SharedMemory> SharedMemory::Create(size_t size) {
+        return nullptr;
+    }
+
+    // static
+    std::unique_ptr<SharedMemory> SharedMemory::Map(int fd, size_t size) {
+        return nullptr;
+    }
+
+    SharedMemory::~SharedMemory() = default;
+
+    bool SendFileDescriptor(int socket, int fd) {
+        return false;
+    }
+
+    int ReceiveFileDescriptor(int socket) {
+        return -1;
+    }
+#endif  // defined(DAWN_PLATFORM_POSIX)
+
+    SharedMemory::SharedMemory(int fd, void* data, size_t size)
+        : mFd(fd), mData(data), mSize(size) {
+    }
+
+    void* SharedMemory::GetData() const {
+        return mData;
+    }
+
+    size_t SharedMemory::GetSize() const {
+        return mSize;
+    }
+
+    int SharedMemory::GetFd() const {
+        return mFd;
+    }
+
+}  // namespace utils
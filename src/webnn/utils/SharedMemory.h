@@ -0,0 +1,53 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_SHARED_MEMORY_H_
+#define UTILS_SHARED_MEMORY_H_
+
+#include <cstddef>
+#include <memory>
+
+namespace utils {
+
+    // An anonymous shared memory region, created with memfd on Linux and shm on other POSIX
+    // platforms. The file descriptor is passed to the other process which maps the region
+    // again, the wire client and server then register their mappings with the same id.
+    class SharedMemory {
+      public:
+        // Returns nullptr if shared memory isn't supported on the platform.
+        static std::unique_ptr<SharedMemory> Create(size_t size);
+        // Maps the region of the file descriptor, the descriptor is duplicated.
+        static std::unique_ptr<SharedMemory> Map(int fd, size_t size);
+        ~SharedMemory();
+
+        void* GetData() const;
+        size_t GetSize() const;
+        int GetFd() const;
+
+      private:
+        SharedMemory(int fd, void* data, size_t size);
+
+        int mFd;
+        void* mData;
+        size_t mSize;
+    };
+
+    // Passes the file descriptor of a region over a connected Unix domain socket. The received
+    // descriptor is owned by the caller, -1 is returned on failure.
+    bool SendFileDescriptor(int socket, int fd);
+    int ReceiveFileDescriptor(int socket);
+
+}  // namespace utils
+
+#endif  // UTILS_SHARED_MEMORY_H_
@@ -49,6 +49,7 @@ namespace utils {
         }
 
         mOffset += size;
+        mSerializedByteCount += size;
         return result;
     }
 
@@ -58,4 +59,8 @@ namespace utils {
         return success;
     }
 
+    uint64_t TerribleCommandBuffer::GetSerializedByteCount() const {
+        return mSerializedByteCount;
+    }
+
 }  // namespace utils
@@ -31,9 +31,13 @@ namespace utils {
         void* GetCmdSpace(size_t size) override;
         bool Flush() override;
 
+        // The bytes of all the commands serialized so far.
+        uint64_t GetSerializedByteCount() const;
+
       private:
         webnn::wire::CommandHandler* mHandler = nullptr;
         size_t mOffset = 0;
+        uint64_t mSerializedByteCount = 0;
         char mBuffer[1000000];
     };
 
@@ -43,9 +43,12 @@ namespace webnn::wire {
             if (mChunkedCommandRemainingSize == 0) {
                 // Once the chunked command is complete, pass the data to the command handler
                 // implemenation.
-                auto chunkedCommandData = std::move(mChunkedCommandData);
-                if (HandleCommandsImpl(chunkedCommandData.get(), mChunkedCommandPutOffset) ==
-                    nullptr) {
+                mHandlingChunkedCommandData = std::move(mChunkedCommandData);
+                mHandlingChunkedCommandSize = mChunkedCommandPutOffset;
+                const volatile char* result =
+                    HandleCommandsImpl(mHandlingChunkedCommandData.get(), mChunkedCommandPutOffset);
+                mHandlingChunkedCommandData.reset();
+                if (result == nullptr) {
                     // |HandleCommandsImpl| returns nullptr on error. Forward any errors
                     // out.
                     return nullptr;
@@ -56,6 +59,21 @@ namespace webnn::wire {
         return HandleCommandsImpl(commands, size);
     }
 
+    std::unique_ptr<char[]> ChunkedCommandHandler::AcquireChunkedCommandData(
+        const volatile void* data,
+        size_t size) {
+        if (!mHandlingChunkedCommandData) {
+            return nullptr;
+        }
+        uintptr_t begin = reinterpret_cast<uintptr_t>(mHandlingChunkedCommandData.get());
+        uintptr_t address = reinterpret_cast<uintptr_t>(data);
+        if (address < begin || address - begin > mHandlingChunkedCommandSize ||
+            size > mHandlingChunkedCommandSize - (address - begin)) {
+            return nullptr;
+        }
+        return std::move(mHandlingChunkedCommandData);
+    }
+
     ChunkedCommandHandler::ChunkedCommandsResult ChunkedCommandHandler::BeginChunkedCommandData(
         const volatile char* commands,
         size_t commandSize,
@@ -24,6 +24,10 @@
 
 namespace webnn::wire {
 
+    // The chunks of a command larger than a chunk are reassembled in a buffer of the command
+    // before it's handled, since the generated deserializer reads the command contiguous. So the
+    // payload streamed after such a command is copied once into that buffer, it isn't placed
+    // into its destination, e.g. the storage of the named input, as the chunks arrive.
     class ChunkedCommandHandler : public CommandHandler {
       public:
         const volatile char* HandleCommands(const volatile char* commands, size_t size) override;
@@ -53,6 +57,11 @@ namespace webnn::wire {
             return ChunkedCommandsResult::Passthrough;
         }
 
+        // Takes the ownership of the data of the chunked command being handled if the range is
+        // inside it, so the handler can keep a large payload instead of copying it. Returns
+        // nullptr otherwise.
+        std::unique_ptr<char[]> AcquireChunkedCommandData(const volatile void* data, size_t size);
+
       private:
         virtual const volatile char* HandleCommandsImpl(const volatile char* commands,
                                                         size_t size) = 0;
@@ -64,6 +73,9 @@ namespace webnn::wire {
         size_t mChunkedCommandRemainingSize = 0;
         size_t mChunkedCommandPutOffset = 0;
         std::unique_ptr<char[]> mChunkedCommandData;
+        // The data of the completed chunked command while it's handled.
+        std::unique_ptr<char[]> mHandlingChunkedCommandData;
+        size_t mHandlingChunkedCommandSize = 0;
     };
 
 }  // namespace webnn::wire
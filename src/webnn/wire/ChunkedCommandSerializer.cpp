@@ -14,10 +14,14 @@
 
 #include "webnn/wire/ChunkedCommandSerializer.h"
 
+#include <cstdlib>
+
 namespace webnn::wire {
 
     ChunkedCommandSerializer::ChunkedCommandSerializer(CommandSerializer* serializer)
-        : mSerializer(serializer), mMaxAllocationSize(serializer->GetMaximumAllocationSize()) {
+        : mSerializer(serializer),
+          mMaxAllocationSize(serializer->GetMaximumAllocationSize()),
+          mStagePayloads(std::getenv("WEBNN_WIRE_STAGE_PAYLOADS") != nullptr) {
     }
 
     void ChunkedCommandSerializer::SerializeChunkedCommand(const char* allocatedBuffer,
@@ -28,6 +28,12 @@ namespace webnn::wire {
 
     class ChunkedCommandSerializer {
       public:
+        // A piece of the payload following a command.
+        struct Payload {
+            const void* data;
+            size_t size;
+        };
+
         ChunkedCommandSerializer(CommandSerializer* serializer);
 
         template <typename Cmd>
@@ -65,6 +71,56 @@ namespace webnn::wire {
                 extraSize, std::forward<ExtraSizeSerializeFn>(SerializeExtraSize));
         }
 
+        // Serializes the command followed by the payload of its skip_serialize member. The payload
+        // is copied from its source into the command space directly, and is split across
+        // successive chunks if it doesn't fit in one.
+        template <typename Cmd>
+        void SerializeCommandWithPayload(const Cmd& cmd, const void* payload, size_t payloadSize) {
+            const Payload payloads[] = {{payload, payloadSize}};
+            SerializeCommandWithPayloadImpl(
+                cmd,
+                [](const Cmd& cmd, size_t requiredSize, char* allocatedBuffer) {
+                    cmd.Serialize(requiredSize, allocatedBuffer);
+                },
+                payloads, 1);
+        }
+
+        template <typename Cmd>
+        void SerializeCommandWithPayload(const Cmd& cmd,
+                                         const ObjectIdProvider& objectIdProvider,
+                                         const void* payload,
+                                         size_t payloadSize) {
+            const Payload payloads[] = {{payload, payloadSize}};
+            SerializeCommandWithPayloads(cmd, objectIdProvider, payloads, 1);
+        }
+
+        // Same as above, the pieces of the payload are gathered from their sources one after
+        // another.
+        template <typename Cmd>
+        void SerializeCommandWithPayloads(const Cmd& cmd,
+                                          const ObjectIdProvider& objectIdProvider,
+                                          const Payload* payloads,
+                                          size_t payloadCount) {
+            SerializeCommandWithPayloadImpl(
+                cmd,
+                [&objectIdProvider](const Cmd& cmd, size_t requiredSize, char* allocatedBuffer) {
+                    cmd.Serialize(requiredSize, allocatedBuffer, objectIdProvider);
+                },
+                payloads, payloadCount);
+        }
+
+        // The space of the underlying serializer, e.g. to serialize the commands coalesced by
+        // the client in place. The space is no larger than the maximum allocation size.
+        void* GetCmdSpace(size_t size) {
+            return mSerializer->GetCmdSpace(size);
+        }
+        bool Flush() {
+            return mSerializer->Flush();
+        }
+        size_t GetMaximumAllocationSize() const {
+            return mMaxAllocationSize;
+        }
+
       private:
         template <typename Cmd, typename SerializeCmdFn, typename ExtraSizeSerializeFn>
         void SerializeCommandImpl(const Cmd& cmd,
@@ -92,10 +148,62 @@ namespace webnn::wire {
             SerializeChunkedCommand(cmdSpace.get(), requiredSize);
         }
 
+        template <typename Cmd, typename SerializeCmdFn>
+        void SerializeCommandWithPayloadImpl(const Cmd& cmd,
+                                             SerializeCmdFn&& SerializeCmd,
+                                             const Payload* payloads,
+                                             size_t payloadCount) {
+            size_t commandSize = cmd.GetRequiredSize();
+            size_t payloadSize = 0;
+            for (size_t i = 0; i < payloadCount; ++i) {
+                payloadSize += payloads[i].size;
+            }
+            if (commandSize > mMaxAllocationSize || mStagePayloads) {
+                // The command itself doesn't fit in a chunk, so it's assembled in full first.
+                SerializeCommandImpl(cmd, std::forward<SerializeCmdFn>(SerializeCmd), payloadSize,
+                                     [payloads, payloadCount](char* buffer) {
+                                         for (size_t i = 0; i < payloadCount; ++i) {
+                                             if (payloads[i].size > 0) {
+                                                 memcpy(buffer, payloads[i].data,
+                                                        payloads[i].size);
+                                                 buffer += payloads[i].size;
+                                             }
+                                         }
+                                     });
+                return;
+            }
+
+            // The first chunk holds the command and the head of the payload, the rest of the
+            // payload is streamed into the following chunks without an intermediate copy.
+            size_t requiredSize = commandSize + payloadSize;
+            size_t chunkSize = std::min(requiredSize, mMaxAllocationSize);
+            char* allocatedBuffer = static_cast<char*>(mSerializer->GetCmdSpace(chunkSize));
+            if (allocatedBuffer == nullptr) {
+                return;
+            }
+            SerializeCmd(cmd, requiredSize, allocatedBuffer);
+            char* head = allocatedBuffer + commandSize;
+            size_t headSize = chunkSize - commandSize;
+            for (size_t i = 0; i < payloadCount; ++i) {
+                const char* data = static_cast<const char*>(payloads[i].data);
+                size_t size = std::min(headSize, payloads[i].size);
+                if (size > 0) {
+                    memcpy(head, data, size);
+                    head += size;
+                    headSize -= size;
+                }
+                SerializeChunkedCommand(data + size, payloads[i].size - size);
+            }
+        }
+
         void SerializeChunkedCommand(const char* allocatedBuffer, size_t remainingSize);
 
         CommandSerializer* mSerializer;
         size_t mMaxAllocationSize;
+        // Set by the WEBNN_WIRE_STAGE_PAYLOADS environment variable, the payloads are assembled
+        // with their command in a full size buffer like before they were streamed. The perf
+        // tests use it to compare the throughputs of both paths.
+        bool mStagePayloads;
     };
 
 }  // namespace webnn::wire
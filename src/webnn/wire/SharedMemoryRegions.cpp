@@ -0,0 +1,62 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/wire/SharedMemoryRegions.h"
+
+namespace webnn::wire {
+
+    bool SharedMemoryRegions::Register(uint32_t id, void* data, size_t size) {
+        if (id == 0 || data == nullptr || size == 0) {
+            return false;
+        }
+        return mRegions.insert({id, {static_cast<uint8_t*>(data), size}}).second;
+    }
+
+    bool SharedMemoryRegions::Unregister(uint32_t id) {
+        return mRegions.erase(id) != 0;
+    }
+
+    bool SharedMemoryRegions::Find(const void* data,
+                                   size_t byteLength,
+                                   uint32_t* id,
+                                   uint64_t* offset) const {
+        const uint8_t* begin = static_cast<const uint8_t*>(data);
+        for (auto& [regionId, region] : mRegions) {
+            if (begin < region.data || begin >= region.data + region.size) {
+                continue;
+            }
+            size_t regionOffset = begin - region.data;
+            if (byteLength > region.size - regionOffset) {
+                return false;
+            }
+            *id = regionId;
+            *offset = regionOffset;
+            return true;
+        }
+        return false;
+    }
+
+    void* SharedMemoryRegions::GetPointer(uint32_t id, uint64_t offset, size_t byteLength) const {
+        auto iter = mRegions.find(id);
+        if (iter == mRegions.end()) {
+            return nullptr;
+        }
+        const Region& region = iter->second;
+        if (offset > region.size || byteLength > region.size - offset) {
+            return nullptr;
+        }
+        return region.data + offset;
+    }
+
+}  // namespace webnn::wire
@@ -0,0 +1,50 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_WIRE_SHAREDMEMORYREGIONS_H_
+#define WEBNN_WIRE_SHAREDMEMORYREGIONS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace webnn::wire {
+
+    // The shared memory regions mapped by the client and the server. A tensor inside a region
+    // is referenced in the commands by the id of the region and the offset in the region, so
+    // its data is never copied through the command stream. The embedder maps the same memory
+    // in both processes and registers it with the same id on both sides, the id 0 is reserved
+    // for the tensors that aren't in shared memory.
+    class SharedMemoryRegions {
+      public:
+        bool Register(uint32_t id, void* data, size_t size);
+        bool Unregister(uint32_t id);
+
+        // Finds the region containing the range, used by the client to reference a tensor.
+        bool Find(const void* data, size_t byteLength, uint32_t* id, uint64_t* offset) const;
+        // Returns the address of the range in the region, used by the server to resolve a
+        // reference. Returns nullptr if the range isn't inside the region.
+        void* GetPointer(uint32_t id, uint64_t offset, size_t byteLength) const;
+
+      private:
+        struct Region {
+            uint8_t* data;
+            size_t size;
+        };
+        std::map<uint32_t, Region> mRegions;
+    };
+
+}  // namespace webnn::wire
+
+#endif  // WEBNN_WIRE_SHAREDMEMORYREGIONS_H_
@@ -49,8 +49,24 @@ namespace webnn::wire {
         return mImpl->ReserveNamedOutputs();
     }
 
+    bool WireClient::RegisterSharedMemory(uint32_t id, void* data, size_t size) {
+        return mImpl->RegisterSharedMemory(id, data, size);
+    }
+
+    void WireClient::UnregisterSharedMemory(uint32_t id) {
+        mImpl->UnregisterSharedMemory(id);
+    }
+
+    bool WireClient::Flush() {
+        return mImpl->Flush();
+    }
+
     void WireClient::Disconnect() {
         mImpl->Disconnect();
     }
 
+    DeserializeAllocatorStats WireClient::GetDeserializeAllocatorStats() const {
+        return mImpl->GetDeserializeAllocatorStats();
+    }
+
 }  // namespace webnn::wire
@@ -15,46 +15,121 @@
 #include "webnn/wire/WireDeserializeAllocator.h"
 
 #include <algorithm>
+#include <cstdlib>
+#include <limits>
 
 namespace webnn::wire {
+    namespace {
+        // The deserialized structures hold 64-bit members and pointers.
+        constexpr size_t kAlignment = 8;
+
+        // Returns the smallest size class whose blocks fit the size, or the class count if the
+        // size is larger than the largest blocks.
+        size_t GetSizeClass(size_t size, size_t minBlockSizeLog2, size_t sizeClassCount) {
+            for (size_t sizeClass = 0; sizeClass < sizeClassCount; ++sizeClass) {
+                if (size <= (size_t(1) << (sizeClass + minBlockSizeLog2))) {
+                    return sizeClass;
+                }
+            }
+            return sizeClassCount;
+        }
+    }  // anonymous namespace
+
     WireDeserializeAllocator::WireDeserializeAllocator() {
-        Reset();
+        // The initial buffer is the inline buffer so that some allocations can be skipped
+        mCurrentBuffer = mStaticBuffer;
+        mRemainingSize = sizeof(mStaticBuffer);
+        mStats.capacity = sizeof(mStaticBuffer);
     }
 
     WireDeserializeAllocator::~WireDeserializeAllocator() {
-        Reset();
+        for (auto& block : mUsedBlocks) {
+            free(block.data);
+        }
+        for (auto& freeBlocks : mFreeBlocks) {
+            for (auto& block : freeBlocks) {
+                free(block.data);
+            }
+        }
     }
 
     void* WireDeserializeAllocator::GetSpace(size_t size) {
-        // Return space in the current buffer if possible first.
-        if (mRemainingSize >= size) {
-            char* buffer = mCurrentBuffer;
-            mCurrentBuffer += size;
-            mRemainingSize -= size;
-            return buffer;
+        if (size > std::numeric_limits<size_t>::max() - kAlignment) {
+            return nullptr;
         }
+        size_t alignedSize = (size + kAlignment - 1) & ~(kAlignment - 1);
+        mStats.spaceCount++;
 
-        // Otherwise allocate a new buffer and try again.
-        size_t allocationSize = std::max(size, size_t(2048));
-        char* allocation = static_cast<char*>(malloc(allocationSize));
-        if (allocation == nullptr) {
+        // Return space in the current buffer if possible first, otherwise continue in a new
+        // block. The rest of the current buffer is left unused until the arena is rewound.
+        if (mRemainingSize < alignedSize && !AcquireBlock(alignedSize)) {
             return nullptr;
         }
+        char* buffer = mCurrentBuffer;
+        mCurrentBuffer += alignedSize;
+        mRemainingSize -= alignedSize;
+        mUsedSize += alignedSize;
+        return buffer;
+    }
 
-        mAllocations.push_back(allocation);
-        mCurrentBuffer = allocation;
-        mRemainingSize = allocationSize;
-        return GetSpace(size);
+    bool WireDeserializeAllocator::AcquireBlock(size_t size) {
+        // The block is at least as large as the space used so far, so a large command grows the
+        // arena geometrically instead of with many small blocks.
+        size_t blockSize = std::max(size, mUsedSize);
+        size_t sizeClass = GetSizeClass(blockSize, kMinBlockSizeLog2, kSizeClassCount);
+        Block block;
+        if (sizeClass < kSizeClassCount && !mFreeBlocks[sizeClass].empty()) {
+            block = mFreeBlocks[sizeClass].back();
+            mFreeBlocks[sizeClass].pop_back();
+        } else {
+            if (sizeClass < kSizeClassCount) {
+                blockSize = size_t(1) << (sizeClass + kMinBlockSizeLog2);
+            } else {
+                // The spaces larger than the largest blocks are only needed by the command.
+                blockSize = size;
+            }
+            block = {static_cast<char*>(malloc(blockSize)), blockSize, sizeClass};
+            if (block.data == nullptr) {
+                return false;
+            }
+            mStats.systemAllocationCount++;
+            mStats.capacity += blockSize;
+        }
+
+        mUsedBlocks.push_back(block);
+        mCurrentBuffer = block.data;
+        mRemainingSize = block.size;
+        return true;
     }
 
     void WireDeserializeAllocator::Reset() {
-        for (auto allocation : mAllocations) {
-            free(allocation);
+        mStats.commandCount++;
+        Rewind();
+    }
+
+    void WireDeserializeAllocator::ResetBatchedCommand() {
+        mStats.batchedCommandCount++;
+        Rewind();
+    }
+
+    void WireDeserializeAllocator::Rewind() {
+        mStats.highWaterSize = std::max(mStats.highWaterSize, mUsedSize);
+        for (auto& block : mUsedBlocks) {
+            if (block.sizeClass < kSizeClassCount) {
+                mFreeBlocks[block.sizeClass].push_back(block);
+            } else {
+                free(block.data);
+                mStats.capacity -= block.size;
+            }
         }
-        mAllocations.clear();
+        mUsedBlocks.clear();
+        mUsedSize = 0;
 
-        // The initial buffer is the inline buffer so that some allocations can be skipped
         mCurrentBuffer = mStaticBuffer;
         mRemainingSize = sizeof(mStaticBuffer);
     }
+
+    DeserializeAllocatorStats WireDeserializeAllocator::GetStats() const {
+        return mStats;
+    }
 }  // namespace webnn::wire
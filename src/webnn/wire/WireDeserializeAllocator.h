@@ -15,14 +15,19 @@
 #ifndef WEBNN_WIRE_WIREDESERIALIZEALLOCATOR_H_
 #define WEBNN_WIRE_WIREDESERIALIZEALLOCATOR_H_
 
+#include "webnn/wire/Wire.h"
 #include "webnn/wire/WireCmd_autogen.h"
 
+#include <array>
 #include <vector>
 
 namespace webnn::wire {
-    // A really really simple implementation of the DeserializeAllocator. It's main feature
-    // is that it has some inline storage so as to avoid allocations for the majority of
-    // commands.
+    // The deserialized data of a command only lives until the command is handled, so the space
+    // is bump allocated from an arena which is rewound by Reset after each command. The arena
+    // starts with some inline storage which is enough for the majority of commands, then grows
+    // with blocks of power of two size classes. The blocks are kept across the commands, so
+    // once the arena has grown to the size the commands need, deserializing them doesn't
+    // allocate from the system any more.
     class WireDeserializeAllocator : public DeserializeAllocator {
       public:
         WireDeserializeAllocator();
@@ -30,13 +35,35 @@ namespace webnn::wire {
 
         void* GetSpace(size_t size) override;
 
+        // Rewinds the arena after a received command, or after a command of a graph builder
+        // batch.
         void Reset();
+        void ResetBatchedCommand();
+
+        DeserializeAllocatorStats GetStats() const;
 
       private:
+        // The blocks are 4 KiB to 64 MiB, larger spaces are allocated for the command only.
+        static constexpr size_t kMinBlockSizeLog2 = 12;
+        static constexpr size_t kSizeClassCount = 15;
+
+        struct Block {
+            char* data;
+            size_t size;
+            size_t sizeClass;
+        };
+
+        bool AcquireBlock(size_t size);
+        void Rewind();
+
         size_t mRemainingSize = 0;
         char* mCurrentBuffer = nullptr;
-        char mStaticBuffer[2048];
-        std::vector<char*> mAllocations;
+        // The space used by the current command.
+        size_t mUsedSize = 0;
+        alignas(8) char mStaticBuffer[2048];
+        std::vector<Block> mUsedBlocks;
+        std::array<std::vector<Block>, kSizeClassCount> mFreeBlocks;
+        DeserializeAllocatorStats mStats;
     };
 }  // namespace webnn::wire
 
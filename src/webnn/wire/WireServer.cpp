@@ -18,7 +18,11 @@
 namespace webnn::wire {
 
     WireServer::WireServer(const WireServerDescriptor& descriptor)
-        : mImpl(new server::Server(*descriptor.procs, descriptor.serializer)) {
+        : mImpl(new server::Server(*descriptor.procs,
+                                   descriptor.serializer,
+                                   descriptor.computeThreadCount,
+                                   descriptor.constantWithBuffer,
+                                   descriptor.namedInputsSetWithoutCopy)) {
     }
 
     WireServer::~WireServer() {
@@ -63,4 +67,24 @@ namespace webnn::wire {
         return mImpl->InjectNamedOutputs(namedOutputs, id, generation);
     }
 
+    bool WireServer::RegisterSharedMemory(uint32_t id, void* data, size_t size) {
+        return mImpl->RegisterSharedMemory(id, data, size);
+    }
+
+    void WireServer::UnregisterSharedMemory(uint32_t id) {
+        mImpl->UnregisterSharedMemory(id);
+    }
+
+    bool WireServer::Flush() {
+        return mImpl->Flush();
+    }
+
+    bool WireServer::HasPendingComputes() const {
+        return mImpl->HasPendingComputes();
+    }
+
+    DeserializeAllocatorStats WireServer::GetDeserializeAllocatorStats() const {
+        return mImpl->GetDeserializeAllocatorStats();
+    }
+
 }  // namespace webnn::wire
@@ -17,6 +17,8 @@
 
 #include "common/Compiler.h"
 
+#include <algorithm>
+
 namespace webnn::wire::client {
 
     namespace {
@@ -65,6 +67,67 @@ namespace webnn::wire::client {
         }
     }
 
+    bool Client::CanBatchGraphBuilderCommand(size_t size) const {
+        // The command and the header of its batch fit in one space of the serializer.
+        return GraphBuilderBatchCmd().GetRequiredSize() + size <=
+               mSerializer.GetMaximumAllocationSize();
+    }
+
+    char* Client::GetGraphBuilderBatchSpace(size_t size) {
+        if (mGraphBuilderBatch != nullptr &&
+            mGraphBuilderBatchCapacity - mGraphBuilderBatchSize < size) {
+            FlushGraphBuilderBatch();
+        }
+        if (mGraphBuilderBatch == nullptr) {
+            // The header is serialized when the batch is closed, once the size of the batched
+            // commands is known.
+            size_t headerSize = GraphBuilderBatchCmd().GetRequiredSize();
+            size_t capacity = std::max(
+                size, std::min(kGraphBuilderBatchSize,
+                               mSerializer.GetMaximumAllocationSize() - headerSize));
+            mGraphBuilderBatch = static_cast<char*>(mSerializer.GetCmdSpace(headerSize + capacity));
+            if (mGraphBuilderBatch == nullptr) {
+                return nullptr;
+            }
+            mGraphBuilderBatchCapacity = capacity;
+            mGraphBuilderBatchSize = 0;
+        }
+        char* allocatedBuffer = mGraphBuilderBatch + GraphBuilderBatchCmd().GetRequiredSize() +
+                                mGraphBuilderBatchSize;
+        mGraphBuilderBatchSize += size;
+        return allocatedBuffer;
+    }
+
+    void Client::FlushGraphBuilderBatch() {
+        if (mGraphBuilderBatch == nullptr) {
+            return;
+        }
+        GraphBuilderBatchCmd cmd = {};
+        cmd.bufferLength = mGraphBuilderBatchSize;
+        cmd.paddingLength = mGraphBuilderBatchCapacity - mGraphBuilderBatchSize;
+        cmd.Serialize(cmd.GetRequiredSize() + mGraphBuilderBatchCapacity, mGraphBuilderBatch,
+                      *this);
+        mGraphBuilderBatch = nullptr;
+        mGraphBuilderBatchCapacity = 0;
+        mGraphBuilderBatchSize = 0;
+    }
+
+    bool Client::Flush() {
+        FlushGraphBuilderBatch();
+        return mSerializer.Flush();
+    }
+
+    uint32_t Client::SerializeConstantData(const void* data, size_t size) {
+        GraphBuilderConstantDataCmd cmd = {};
+        cmd.payloadId = mNextConstantDataId++;
+        cmd.bufferLength = size;
+        cmd.buffer = static_cast<const uint8_t*>(data);
+        // The data is only kept by the server until the batched command uses it, it's sent after
+        // the pending batch and the command referencing it goes in the next batch.
+        SerializeCommandWithPayload(cmd, cmd.buffer, cmd.bufferLength);
+        return cmd.payloadId;
+    }
+
     ReservedInstance Client::ReserveInstance() {
         auto* allocation = InstanceAllocator().New(this);
 
@@ -117,9 +180,30 @@ namespace webnn::wire::client {
         return result;
     }
 
+    bool Client::RegisterSharedMemory(uint32_t id, void* data, size_t size) {
+        return mSharedMemoryRegions.Register(id, data, size);
+    }
+
+    void Client::UnregisterSharedMemory(uint32_t id) {
+        // The batched constants may reference the region.
+        FlushGraphBuilderBatch();
+        mSharedMemoryRegions.Unregister(id);
+    }
+
+    bool Client::FindSharedMemory(const void* data,
+                                  size_t byteLength,
+                                  uint32_t* id,
+                                  uint64_t* offset) const {
+        return mSharedMemoryRegions.Find(data, byteLength, id, offset);
+    }
+
     void Client::Disconnect() {
         mDisconnected = true;
         mSerializer = ChunkedCommandSerializer(NoopCommandSerializer::GetInstance());
+        // The space of the batch belongs to the serializer replaced above.
+        mGraphBuilderBatch = nullptr;
+        mGraphBuilderBatchCapacity = 0;
+        mGraphBuilderBatchSize = 0;
         for (auto& objectList : mObjects) {
             LinkNode<ObjectBase>* object = objectList.head();
             while (object != objectList.end()) {
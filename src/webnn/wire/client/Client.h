@@ -21,11 +21,14 @@
 
 #include "common/LinkedList.h"
 #include "webnn/wire/ChunkedCommandSerializer.h"
+#include "webnn/wire/SharedMemoryRegions.h"
 #include "webnn/wire/WireClient.h"
 #include "webnn/wire/WireCmd_autogen.h"
 #include "webnn/wire/WireDeserializeAllocator.h"
 #include "webnn/wire/client/ClientBase_autogen.h"
 
+#include <cstring>
+
 namespace webnn::wire::client {
 
     class Client : public ClientBase {
@@ -43,8 +46,17 @@ namespace webnn::wire::client {
         ReservedNamedOperands ReserveNamedOperands();
         ReservedNamedOutputs ReserveNamedOutputs();
 
+        bool RegisterSharedMemory(uint32_t id, void* data, size_t size);
+        void UnregisterSharedMemory(uint32_t id);
+        // Returns true if the range is in a registered shared memory region.
+        bool FindSharedMemory(const void* data,
+                              size_t byteLength,
+                              uint32_t* id,
+                              uint64_t* offset) const;
+
         template <typename Cmd>
         void SerializeCommand(const Cmd& cmd) {
+            FlushGraphBuilderBatch();
             mSerializer.SerializeCommand(cmd, *this);
         }
 
@@ -52,12 +64,68 @@ namespace webnn::wire::client {
         void SerializeCommand(const Cmd& cmd,
                               size_t extraSize,
                               ExtraSizeSerializeFn&& SerializeExtraSize) {
+            FlushGraphBuilderBatch();
             mSerializer.SerializeCommand(cmd, *this, extraSize, SerializeExtraSize);
         }
 
+        template <typename Cmd>
+        void SerializeCommandWithPayload(const Cmd& cmd, const void* payload, size_t payloadSize) {
+            FlushGraphBuilderBatch();
+            mSerializer.SerializeCommandWithPayload(cmd, *this, payload, payloadSize);
+        }
+
+        template <typename Cmd>
+        void SerializeCommandWithPayloads(const Cmd& cmd,
+                                          const ChunkedCommandSerializer::Payload* payloads,
+                                          size_t payloadCount) {
+            FlushGraphBuilderBatch();
+            mSerializer.SerializeCommandWithPayloads(cmd, *this, payloads, payloadCount);
+        }
+
+        // The commands of the graph builders are coalesced into a GraphBuilderBatchCmd, which is
+        // closed before any other command so the commands stay in order. The batch is serialized
+        // in place into the space reserved from the serializer rather than copied there.
+        template <typename Cmd>
+        void SerializeGraphBuilderCommand(const Cmd& cmd) {
+            SerializeGraphBuilderCommandWithPayload(cmd, nullptr, 0);
+        }
+
+        // The payload of the skip_serialize member follows the command in the batch.
+        template <typename Cmd>
+        void SerializeGraphBuilderCommandWithPayload(const Cmd& cmd,
+                                                     const void* payload,
+                                                     size_t payloadSize) {
+            size_t commandSize = cmd.GetRequiredSize();
+            size_t requiredSize = commandSize + payloadSize;
+            if (!CanBatchGraphBuilderCommand(requiredSize)) {
+                SerializeCommandWithPayload(cmd, payload, payloadSize);
+                return;
+            }
+            char* allocatedBuffer = GetGraphBuilderBatchSpace(requiredSize);
+            if (allocatedBuffer == nullptr) {
+                return;
+            }
+            cmd.Serialize(requiredSize, allocatedBuffer, *this);
+            if (payloadSize > 0) {
+                memcpy(allocatedBuffer + commandSize, payload, payloadSize);
+            }
+        }
+
+        // Sends the data of a constant too large to be batched, the batched constant command
+        // references the data by the returned id.
+        uint32_t SerializeConstantData(const void* data, size_t size);
+        // Closes the batch, the batched commands are sent when the serializer is flushed.
+        void FlushGraphBuilderBatch();
+        // Closes the batch and flushes the serializer.
+        bool Flush();
+
         void Disconnect();
         bool IsDisconnected() const;
 
+        DeserializeAllocatorStats GetDeserializeAllocatorStats() const {
+            return mAllocator.GetStats();
+        }
+
         template <typename T>
         void TrackObject(T* object) {
             mObjects[ObjectTypeToTypeEnum<T>::value].Append(object);
@@ -65,11 +133,23 @@ namespace webnn::wire::client {
 
       private:
         void DestroyAllObjects();
+        bool CanBatchGraphBuilderCommand(size_t size) const;
+        char* GetGraphBuilderBatchSpace(size_t size);
 
 #include "webnn/wire/client/ClientPrototypes_autogen.inc"
 
         ChunkedCommandSerializer mSerializer;
+        // The space reserved for a batch unless a command needs more, a large model is sent in
+        // a few batches. The unused tail of the space is sent as the padding of the batch.
+        static constexpr size_t kGraphBuilderBatchSize = 64 * 1024;
+        // The batch being serialized in the space of the serializer, with the size of the
+        // space following the command and the size of the batched commands in it.
+        char* mGraphBuilderBatch = nullptr;
+        size_t mGraphBuilderBatchCapacity = 0;
+        size_t mGraphBuilderBatchSize = 0;
+        uint32_t mNextConstantDataId = 1;
         WireDeserializeAllocator mAllocator;
+        SharedMemoryRegions mSharedMemoryRegions;
 
         PerObjectType<LinkedList<ObjectBase>> mObjects;
         bool mDisconnected = false;
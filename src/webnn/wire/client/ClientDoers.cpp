@@ -40,7 +40,23 @@ namespace webnn::wire::client {
                                              uint64_t requestSerial,
                                              WNNErrorType type,
                                              const char* message) {
+        if (graph == nullptr) {
+            // The graph might have been released, its callbacks were called then.
+            return true;
+        }
         return graph->OnComputeAsyncCallback(requestSerial, type, message);
     }
 
+    bool Client::DoGraphComputeBoundResult(Graph* graph,
+                                           uint32_t index,
+                                           uint32_t outputIndex,
+                                           uint8_t const* buffer,
+                                           size_t byteLength) {
+        if (graph == nullptr) {
+            // The graph might have been released so this isn't an error.
+            return true;
+        }
+        return graph->OnComputeBoundResult(index, outputIndex, buffer, byteLength);
+    }
+
 }  // namespace webnn::wire::client
@@ -20,6 +20,20 @@
 
 namespace webnn::wire::client {
 
+    Graph::~Graph() {
+        // The results of the running computes can't be returned to the released graph.
+        ClearComputeAsyncRequests(WNNErrorType_Unknown,
+                                  "Graph destroyed before the compute completed");
+    }
+
+    void Graph::ClearComputeAsyncRequests(WNNErrorType type, const char* message) {
+        std::map<uint64_t, ComputeAsyncRequest> requests;
+        std::swap(requests, mComputeAsyncRequests);
+        for (auto& [serial, request] : requests) {
+            request.callback(type, message, request.userdata);
+        }
+    }
+
     void Graph::Compute(WNNNamedInputs inputs, WNNNamedOutputs outputs) {
         NamedInputs* namedInputs = FromAPI(inputs);
         NamedOutputs* namedOutputs = FromAPI(outputs);
@@ -58,6 +72,80 @@ namespace webnn::wire::client {
         client->SerializeCommand(cmd);
     }
 
+    void Graph::Bind(uint32_t index, WNNNamedInputs inputs, WNNNamedOutputs outputs) {
+        NamedInputs* namedInputs = FromAPI(inputs);
+        NamedOutputs* namedOutputs = FromAPI(outputs);
+
+        GraphBindCmd cmd;
+        cmd.graphId = this->id;
+        cmd.index = index;
+        cmd.inputsId = namedInputs->id;
+        cmd.outputsId = namedOutputs->id;
+        client->SerializeCommand(cmd);
+
+        // The slots are sent in the order of the names, the data of the inputs are sent in the
+        // same order by the computes and the results are returned by the output index.
+        Binding binding;
+        for (auto& record : namedInputs->GetRecords()) {
+            GraphBindInputCmd inputCmd = {};
+            inputCmd.graphId = this->id;
+            inputCmd.index = index;
+            inputCmd.name = record.first.c_str();
+            inputCmd.byteLength = record.second.byteLength;
+            inputCmd.sharedMemoryId = record.second.sharedMemoryId;
+            inputCmd.sharedMemoryOffset = record.second.sharedMemoryOffset;
+            inputCmd.dimensions = record.second.dimensions.data();
+            inputCmd.dimensionsCount = static_cast<uint32_t>(record.second.dimensions.size());
+            client->SerializeCommand(inputCmd);
+            if (record.second.sharedMemoryId == 0) {
+                binding.inputs.push_back({record.second.data, record.second.byteLength});
+            }
+        }
+        for (auto& output : namedOutputs->GetOutputs()) {
+            GraphBindOutputCmd outputCmd = {};
+            outputCmd.graphId = this->id;
+            outputCmd.index = index;
+            outputCmd.name = output.first.c_str();
+            client->SerializeCommand(outputCmd);
+            binding.outputs.push_back(output.second);
+        }
+        mBindings[index] = std::move(binding);
+    }
+
+    void Graph::ComputeBound(uint32_t index) {
+        GraphComputeBoundCmd cmd = {};
+        cmd.graphId = this->id;
+        cmd.index = index;
+
+        // The index that isn't bound is sent too, the error is reported by the server.
+        auto binding = mBindings.find(index);
+        if (binding == mBindings.end()) {
+            client->SerializeCommand(cmd);
+            return;
+        }
+        for (auto& input : binding->second.inputs) {
+            cmd.bufferLength += input.size;
+        }
+        client->SerializeCommandWithPayloads(cmd, binding->second.inputs.data(),
+                                             binding->second.inputs.size());
+    }
+
+    bool Graph::OnComputeBoundResult(uint32_t index,
+                                     uint32_t outputIndex,
+                                     const uint8_t* buffer,
+                                     size_t byteLength) {
+        auto binding = mBindings.find(index);
+        if (binding == mBindings.end() || outputIndex >= binding->second.outputs.size()) {
+            return false;
+        }
+        const WNNArrayBufferView& output = binding->second.outputs[outputIndex];
+        if (buffer == nullptr || byteLength > output.byteLength) {
+            return false;
+        }
+        memcpy(static_cast<uint8_t*>(output.buffer) + output.byteOffset, buffer, byteLength);
+        return true;
+    }
+
     bool Graph::OnComputeAsyncCallback(uint64_t requestSerial,
                                        WNNErrorType type,
                                        const char* message) {
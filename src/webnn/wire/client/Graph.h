@@ -17,16 +17,19 @@
 
 #include <webnn/webnn.h>
 
+#include "webnn/wire/ChunkedCommandSerializer.h"
 #include "webnn/wire/WireClient.h"
 #include "webnn/wire/client/ObjectBase.h"
 
 #include <map>
+#include <vector>
 
 namespace webnn::wire::client {
 
     class Graph final : public ObjectBase {
       public:
         using ObjectBase::ObjectBase;
+        ~Graph();
 
         void Compute(WNNNamedInputs inputs, WNNNamedOutputs outputs);
         void ComputeAsync(WNNNamedInputs inputs,
@@ -35,7 +38,24 @@ namespace webnn::wire::client {
                           void* userdata);
         bool OnComputeAsyncCallback(uint64_t requestSerial, WNNErrorType type, const char* message);
 
+        // The inputs and outputs are bound on the server once, then each compute of the index
+        // only sends the data of the inputs which aren't in shared memory.
+        void Bind(uint32_t index, WNNNamedInputs inputs, WNNNamedOutputs outputs);
+        void ComputeBound(uint32_t index);
+        bool OnComputeBoundResult(uint32_t index,
+                                  uint32_t outputIndex,
+                                  const uint8_t* buffer,
+                                  size_t byteLength);
+
       private:
+        void ClearComputeAsyncRequests(WNNErrorType type, const char* message);
+
+        struct Binding {
+            std::vector<ChunkedCommandSerializer::Payload> inputs;
+            std::vector<WNNArrayBufferView> outputs;
+        };
+        std::map<uint32_t, Binding> mBindings;
+
         struct ComputeAsyncRequest {
             WNNComputeAsyncCallback callback = nullptr;
             void* userdata = nullptr;
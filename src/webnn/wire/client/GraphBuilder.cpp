@@ -22,18 +22,29 @@ namespace webnn::wire::client {
 
     WNNOperand GraphBuilder::Constant(WNNOperandDescriptor const* desc,
                                       WNNArrayBufferView const* value) {
-        GraphBuilderConstantInternalCmd cmd;
+        GraphBuilderConstantInternalCmd cmd = {};
         cmd.graphBuilderId = this->id;
         cmd.desc = desc;
-        cmd.buffer = static_cast<const uint8_t*>(value->buffer);
         cmd.byteLength = value->byteLength;
-        cmd.byteOffset = value->byteOffset;
 
-        // Create the Operand and send the building constant command.
+        // Create the Operand and batch the building constant command with the other commands
+        // of the builder. The weights in shared memory are referenced, the small weights follow
+        // the command in the batch and the large ones are sent ahead of the batch.
         auto* allocation = client->OperandAllocator().New(client);
         Operand* operand = allocation->object.get();
         cmd.result = ObjectHandle{operand->id, allocation->generation};
-        client->SerializeCommand(cmd);
+        const uint8_t* data = static_cast<const uint8_t*>(value->buffer) + value->byteOffset;
+        if (client->FindSharedMemory(data, value->byteLength, &cmd.sharedMemoryId,
+                                     &cmd.sharedMemoryOffset)) {
+            client->SerializeGraphBuilderCommand(cmd);
+        } else if (value->byteLength <= kMaxBatchedConstantSize) {
+            cmd.buffer = data;
+            cmd.bufferLength = value->byteLength;
+            client->SerializeGraphBuilderCommandWithPayload(cmd, cmd.buffer, cmd.bufferLength);
+        } else {
+            cmd.payloadId = client->SerializeConstantData(data, value->byteLength);
+            client->SerializeGraphBuilderCommand(cmd);
+        }
 
         return ToAPI(operand);
     }
@@ -81,7 +92,7 @@ namespace webnn::wire::client {
         cmd.hiddenSize = hiddenSize;
         cmd.options = options;
 
-        client->SerializeCommand(cmd);
+        client->SerializeGraphBuilderCommand(cmd);
 
         return ToAPI(operandArray);
     }
@@ -105,7 +116,7 @@ namespace webnn::wire::client {
         cmd.splitsCount = splitsCount;
         cmd.options = options;
 
-        client->SerializeCommand(cmd);
+        client->SerializeGraphBuilderCommand(cmd);
 
         return ToAPI(operandArray);
     }
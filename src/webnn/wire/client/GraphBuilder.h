@@ -41,6 +41,10 @@ namespace webnn::wire::client {
                               uint32_t const* splits,
                               uint32_t splitsCount,
                               WNNSplitOptions const* options);
+
+      private:
+        // The larger constants would flush the batch of the builder too often.
+        static constexpr size_t kMaxBatchedConstantSize = 64 * 1024;
     };
 
 }  // namespace webnn::wire::client
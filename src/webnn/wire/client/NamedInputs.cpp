@@ -26,17 +26,36 @@ namespace webnn::wire::client {
         // Input type is ArrayBufferView
         WNNArrayBufferView arrayBufferView = input->resource.arrayBufferView;
         if (arrayBufferView.buffer != nullptr) {
-            cmd.buffer = static_cast<const uint8_t*>(arrayBufferView.buffer);
             cmd.byteLength = arrayBufferView.byteLength;
-            cmd.byteOffset = arrayBufferView.byteOffset;
+            // The input in shared memory is referenced, otherwise it's streamed after the command.
+            const uint8_t* data =
+                static_cast<const uint8_t*>(arrayBufferView.buffer) + arrayBufferView.byteOffset;
+            if (!client->FindSharedMemory(data, arrayBufferView.byteLength, &cmd.sharedMemoryId,
+                                          &cmd.sharedMemoryOffset)) {
+                cmd.buffer = data;
+                cmd.bufferLength = arrayBufferView.byteLength;
+            }
+
+            Record& record = mRecords[std::string(name)];
+            record.data = data;
+            record.byteLength = arrayBufferView.byteLength;
+            record.sharedMemoryId = cmd.sharedMemoryId;
+            record.sharedMemoryOffset = cmd.sharedMemoryOffset;
+            record.dimensions.assign(input->dimensions,
+                                     input->dimensions + input->dimensionsCount);
         } else {
+            mRecords.erase(std::string(name));
             cmd.gpuBufferId = input->resource.gpuBufferView.id;
             cmd.gpuBufferGeneration = input->resource.gpuBufferView.generation;
         }
         cmd.dimensions = input->dimensions;
         cmd.dimensionsCount = input->dimensionsCount;
 
-        client->SerializeCommand(cmd);
+        client->SerializeCommandWithPayload(cmd, cmd.buffer, cmd.bufferLength);
+    }
+
+    const std::map<std::string, NamedInputs::Record>& NamedInputs::GetRecords() const {
+        return mRecords;
     }
 
 }  // namespace webnn::wire::client
@@ -21,6 +21,8 @@
 #include "webnn/wire/client/ObjectBase.h"
 
 #include <map>
+#include <string>
+#include <vector>
 
 namespace webnn::wire::client {
 
@@ -29,6 +31,20 @@ namespace webnn::wire::client {
         using ObjectBase::ObjectBase;
 
         void Set(char const* name, WNNInput const* input);
+
+        // The array buffer input which is bound to a graph by its location, the data is read
+        // from there by every compute of the graph.
+        struct Record {
+            const uint8_t* data = nullptr;
+            size_t byteLength = 0;
+            uint32_t sharedMemoryId = 0;
+            uint64_t sharedMemoryOffset = 0;
+            std::vector<int32_t> dimensions;
+        };
+        const std::map<std::string, Record>& GetRecords() const;
+
+      private:
+        std::map<std::string, Record> mRecords;
     };
 
 }  // namespace webnn::wire::client
@@ -30,9 +30,19 @@ namespace webnn::wire::client {
             cmd.byteLength = arrayBufferView.byteLength;
             cmd.byteOffset = arrayBufferView.byteOffset;
 
-            // Save the WNNArrayBufferView in order to be copied after computing from server.
-            mNamedOutputMap.insert(std::make_pair(std::string(name), arrayBufferView));
+            // The output in shared memory is written by the server directly, otherwise save the
+            // WNNArrayBufferView in order to be copied after computing from server.
+            const uint8_t* data =
+                static_cast<const uint8_t*>(arrayBufferView.buffer) + arrayBufferView.byteOffset;
+            if (client->FindSharedMemory(data, arrayBufferView.byteLength, &cmd.sharedMemoryId,
+                                         &cmd.sharedMemoryOffset)) {
+                cmd.byteOffset = 0;
+                mNamedOutputMap.erase(std::string(name));
+            } else {
+                mNamedOutputMap[std::string(name)] = arrayBufferView;
+            }
         } else {
+            mNamedOutputMap.erase(std::string(name));
             cmd.gpuBufferId = resource->gpuBufferView.id;
             cmd.gpuBufferGeneration = resource->gpuBufferView.generation;
         }
@@ -40,6 +50,10 @@ namespace webnn::wire::client {
         client->SerializeCommand(cmd);
     }
 
+    const std::map<std::string, WNNArrayBufferView>& NamedOutputs::GetOutputs() const {
+        return mNamedOutputMap;
+    }
+
     void NamedOutputs::Get(char const* name, WNNArrayBufferView const* resource) {
         UNREACHABLE();
     }
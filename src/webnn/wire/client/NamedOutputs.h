@@ -35,6 +35,8 @@ namespace webnn::wire::client {
                           uint8_t const* buffer,
                           size_t byteLength,
                           size_t byteOffset);
+        // The outputs returned by the server, the outputs in shared memory are written in place.
+        const std::map<std::string, WNNArrayBufferView>& GetOutputs() const;
 
       private:
         std::map<std::string, WNNArrayBufferView> mNamedOutputMap;
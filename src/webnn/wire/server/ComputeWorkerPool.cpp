@@ -0,0 +1,134 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "webnn/wire/server/ComputeWorkerPool.h"
+
+#include <algorithm>
+
+#include "common/Assert.h"
+
+namespace webnn::wire::server {
+
+    ComputeWorkerPool::ComputeWorkerPool(uint32_t threadCount) {
+        ASSERT(threadCount > 0);
+        for (uint32_t i = 0; i < threadCount; ++i) {
+            mThreads.emplace_back([this]() { RunWorker(); });
+        }
+    }
+
+    ComputeWorkerPool::~ComputeWorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopping = true;
+        }
+        mTaskCondition.notify_all();
+        for (std::thread& thread : mThreads) {
+            thread.join();
+        }
+        ASSERT(mKeyTasks.empty());
+    }
+
+    void ComputeWorkerPool::PostTask(std::vector<uint64_t> keys, std::function<void()> task) {
+        PostAsyncTask(std::move(keys), [task = std::move(task)](Completion completion) {
+            task();
+            completion();
+        });
+    }
+
+    void ComputeWorkerPool::PostAsyncTask(std::vector<uint64_t> keys,
+                                          std::function<void(Completion)> task) {
+        // A key is queued once even if the task uses the object twice.
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        auto posted = std::make_shared<Task>();
+        posted->keys = std::move(keys);
+        posted->run = std::move(task);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            for (uint64_t key : posted->keys) {
+                mKeyTasks[key].push_back(posted);
+            }
+            QueueIfReady(posted);
+        }
+        mTaskCondition.notify_one();
+    }
+
+    bool ComputeWorkerPool::IsIdle(uint64_t key) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mKeyTasks.find(key) == mKeyTasks.end();
+    }
+
+    void ComputeWorkerPool::WaitForKey(uint64_t key) {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mIdleCondition.wait(lock,
+                            [this, key]() { return mKeyTasks.find(key) == mKeyTasks.end(); });
+    }
+
+    void ComputeWorkerPool::QueueIfReady(const std::shared_ptr<Task>& task) {
+        if (task->ready) {
+            return;
+        }
+        for (uint64_t key : task->keys) {
+            if (mKeyTasks[key].front() != task) {
+                return;
+            }
+        }
+        task->ready = true;
+        mReadyTasks.push_back(task);
+    }
+
+    void ComputeWorkerPool::CompleteTask(const std::shared_ptr<Task>& task) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (uint64_t key : task->keys) {
+            auto keyTasks = mKeyTasks.find(key);
+            ASSERT(keyTasks != mKeyTasks.end() && keyTasks->second.front() == task);
+            keyTasks->second.pop_front();
+            if (keyTasks->second.empty()) {
+                mKeyTasks.erase(keyTasks);
+            }
+        }
+        // The next tasks of the keys may be waiting for this task only.
+        for (uint64_t key : task->keys) {
+            auto keyTasks = mKeyTasks.find(key);
+            if (keyTasks != mKeyTasks.end()) {
+                QueueIfReady(keyTasks->second.front());
+            }
+        }
+        // The stopping workers also wait for the asynchronous tasks to complete. The pool may
+        // be destroyed once the last task completes, so the lock is held while notifying.
+        mTaskCondition.notify_all();
+        mIdleCondition.notify_all();
+    }
+
+    void ComputeWorkerPool::RunWorker() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true) {
+            mTaskCondition.wait(lock, [this]() {
+                return !mReadyTasks.empty() || (mStopping && mKeyTasks.empty());
+            });
+            // The pending tasks still run when stopping, a task completing makes the next
+            // tasks of its keys ready.
+            if (mReadyTasks.empty()) {
+                return;
+            }
+            std::shared_ptr<Task> task = std::move(mReadyTasks.front());
+            mReadyTasks.pop_front();
+
+            lock.unlock();
+            task->run([this, task]() { CompleteTask(task); });
+            lock.lock();
+        }
+    }
+
+}  // namespace webnn::wire::server
@@ -0,0 +1,76 @@
+// Copyright 2022 The WebNN-native Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WEBNN_WIRE_SERVER_COMPUTEWORKERPOOL_H_
+#define WEBNN_WIRE_SERVER_COMPUTEWORKERPOOL_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace webnn::wire::server {
+
+    // Runs the computes of the server on a fixed number of threads. A task is posted with the
+    // keys of the objects it uses, e.g. the graph and its named inputs and outputs. The tasks
+    // sharing a key run one after another in the order they are posted, the tasks without a
+    // common key run concurrently.
+    class ComputeWorkerPool {
+      public:
+        explicit ComputeWorkerPool(uint32_t threadCount);
+        // Runs the posted tasks and waits for the asynchronous tasks to complete before joining
+        // the threads.
+        ~ComputeWorkerPool();
+
+        void PostTask(std::vector<uint64_t> keys, std::function<void()> task);
+        // The keys of an asynchronous task stay busy after it returns until the completion
+        // passed to it is called, possibly on another thread.
+        using Completion = std::function<void()>;
+        void PostAsyncTask(std::vector<uint64_t> keys, std::function<void(Completion)> task);
+        // Returns true if no task posted with the key is queued or running.
+        bool IsIdle(uint64_t key);
+        // Waits until the tasks posted with the key have completed.
+        void WaitForKey(uint64_t key);
+
+      private:
+        struct Task {
+            std::vector<uint64_t> keys;
+            std::function<void(Completion)> run;
+            bool ready = false;
+        };
+
+        // Queues the task if it's the first task of all its keys.
+        void QueueIfReady(const std::shared_ptr<Task>& task);
+        void CompleteTask(const std::shared_ptr<Task>& task);
+        void RunWorker();
+
+        std::mutex mMutex;
+        std::condition_variable mTaskCondition;
+        std::condition_variable mIdleCondition;
+        // The tasks of each key in the order they are posted, the first task is running or
+        // queued to run. The keys without tasks are removed.
+        std::unordered_map<uint64_t, std::deque<std::shared_ptr<Task>>> mKeyTasks;
+        std::deque<std::shared_ptr<Task>> mReadyTasks;
+        bool mStopping = false;
+        std::vector<std::thread> mThreads;
+    };
+
+}  // namespace webnn::wire::server
+
+#endif  // WEBNN_WIRE_SERVER_COMPUTEWORKERPOOL_H_
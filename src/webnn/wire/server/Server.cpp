@@ -18,11 +18,30 @@
 
 namespace webnn::wire::server {
 
-    Server::Server(const WebnnProcTable& procs, CommandSerializer* serializer)
-        : mSerializer(serializer), mProcs(procs), mIsAlive(std::make_shared<bool>(true)) {
+    Server::Server(const WebnnProcTable& procs,
+                   CommandSerializer* serializer,
+                   uint32_t computeThreadCount,
+                   ConstantWithBufferProc constantWithBuffer,
+                   NamedInputsSetWithoutCopyProc namedInputsSetWithoutCopy)
+        : mCommandSerializer(serializer),
+          mSerializer(serializer),
+          mProcs(procs),
+          mConstantWithBuffer(constantWithBuffer),
+          mNamedInputsSetWithoutCopy(namedInputsSetWithoutCopy),
+          mPendingComputeCount(0),
+          mIsAlive(std::make_shared<bool>(true)) {
+        if (computeThreadCount > 0) {
+            mComputePool = std::make_unique<ComputeWorkerPool>(computeThreadCount);
+        }
     }
 
     Server::~Server() {
+        // Complete the computes before the objects are destroyed.
+        mComputePool.reset();
+        for (auto& binding : mGraphBindings) {
+            ReleaseGraphBinding(binding.second);
+        }
+        mGraphBindings.clear();
         // Un-set the error and lost callbacks since we cannot forward them
         // after the server has been destroyed.
         for (WNNContext context : ContextObjects().GetAllHandles()) {
@@ -158,6 +177,23 @@ namespace webnn::wire::server {
         return true;
     }
 
+    bool Server::RegisterSharedMemory(uint32_t id, void* data, size_t size) {
+        return mSharedMemoryRegions.Register(id, data, size);
+    }
+
+    void Server::UnregisterSharedMemory(uint32_t id) {
+        mSharedMemoryRegions.Unregister(id);
+    }
+
+    bool Server::Flush() {
+        std::lock_guard<std::mutex> lock(mSerializerMutex);
+        return mCommandSerializer->Flush();
+    }
+
+    bool Server::HasPendingComputes() const {
+        return mPendingComputeCount.load() > 0;
+    }
+
     bool Server::DoCreateGraphBuilder(ObjectId contextId, ObjectHandle result) {
         auto* context = ContextObjects().Get(contextId);
         if (context == nullptr) {
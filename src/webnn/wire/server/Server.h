@@ -17,9 +17,17 @@
 #define WEBNN_WIRE_SERVER_SERVER_H_
 
 #include "webnn/wire/ChunkedCommandSerializer.h"
+#include "webnn/wire/SharedMemoryRegions.h"
+#include "webnn/wire/server/ComputeWorkerPool.h"
 #include "webnn/wire/server/ServerBase_autogen.h"
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #if defined(WEBNN_ENABLE_GPU_BUFFER)
 #    include <dawn/wire/WireServer.h>
@@ -98,17 +106,54 @@ namespace webnn::wire::server {
         uint64_t requestSerial;
     };
 
+    // The state of a compute that may complete off the command handling thread. The native
+    // objects are referenced until the compute completes, so the client may release them
+    // meanwhile.
+    struct ComputeRequest {
+        WNNGraph graph;
+        WNNNamedInputs namedInputs;
+        WNNNamedOutputs namedOutputs;
+        ObjectHandle namedOutputsHandle;
+        std::vector<std::string> outputNames;
+    };
+
+    // The inputs and outputs bound to an index of a graph. The inputs are set again from the data
+    // of each compute, the named inputs reuse their storage for the sets.
+    struct GraphBinding {
+        struct Input {
+            std::string name;
+            size_t byteLength;
+            uint32_t sharedMemoryId;
+            uint64_t sharedMemoryOffset;
+            std::vector<int32_t> dimensions;
+        };
+
+        uint32_t graphGeneration;
+        ObjectId inputsId;
+        ObjectId outputsId;
+        WNNNamedInputs namedInputs;
+        WNNNamedOutputs namedOutputs;
+        std::vector<Input> inputs;
+        std::vector<std::string> outputNames;
+    };
+
     struct ComputeAsyncUserdata : CallbackUserdata {
         using CallbackUserdata::CallbackUserdata;
 
         ObjectHandle graph;
         uint64_t requestSerial;
-        ObjectId namedOutputsObjectID;
+        ComputeRequest request;
+        // Called once the compute completes if it's posted to the compute pool.
+        ComputeWorkerPool::Completion completion;
     };
 
     class Server : public ServerBase {
       public:
-        Server(const WebnnProcTable& procs, CommandSerializer* serializer);
+        Server(const WebnnProcTable& procs,
+               CommandSerializer* serializer,
+               uint32_t computeThreadCount = 0,
+               ConstantWithBufferProc constantWithBuffer = nullptr,
+               NamedInputsSetWithoutCopyProc namedInputsSetWithoutCopy = nullptr);
         ~Server() override;
 
         // ChunkedCommandHandler implementation
@@ -128,6 +173,15 @@ namespace webnn::wire::server {
         bool InjectNamedOperands(WNNNamedOperands namedOperands, uint32_t id, uint32_t generation);
         bool InjectNamedOutputs(WNNNamedOutputs namedOutputs, uint32_t id, uint32_t generation);
 
+        bool RegisterSharedMemory(uint32_t id, void* data, size_t size);
+        void UnregisterSharedMemory(uint32_t id);
+
+        bool Flush();
+        bool HasPendingComputes() const;
+        DeserializeAllocatorStats GetDeserializeAllocatorStats() const {
+            return mAllocator.GetStats();
+        }
+
         template <typename T,
                   typename Enable = std::enable_if<std::is_base_of<CallbackUserdata, T>::value>>
         std::unique_ptr<T> MakeUserdata() {
@@ -135,8 +189,11 @@ namespace webnn::wire::server {
         }
 
       private:
+        // The commands are serialized by the compute workers and the callbacks of the backends
+        // too, so the serializer is guarded.
         template <typename Cmd>
         void SerializeCommand(const Cmd& cmd) {
+            std::lock_guard<std::mutex> lock(mSerializerMutex);
             mSerializer.SerializeCommand(cmd);
         }
 
@@ -144,10 +201,19 @@ namespace webnn::wire::server {
         void SerializeCommand(const Cmd& cmd,
                               size_t extraSize,
                               ExtraSizeSerializeFn&& SerializeExtraSize) {
+            std::lock_guard<std::mutex> lock(mSerializerMutex);
             mSerializer.SerializeCommand(cmd, extraSize, SerializeExtraSize);
         }
 
+        template <typename Cmd>
+        void SerializeCommandWithPayload(const Cmd& cmd, const void* payload, size_t payloadSize) {
+            std::lock_guard<std::mutex> lock(mSerializerMutex);
+            mSerializer.SerializeCommandWithPayload(cmd, payload, payloadSize);
+        }
+
         void ClearContextCallbacks(WNNContext context);
+        // Handles the commands coalesced in GraphBuilderBatchCmd in one pass.
+        bool HandleGraphBuilderBatch(const volatile char* commands, size_t size);
 
 #if defined(WEBNN_ENABLE_GPU_BUFFER)
         WGPUDevice GetWGPUDevice(uint32_t id, uint32_t generation);
@@ -165,8 +231,13 @@ namespace webnn::wire::server {
 #include "webnn/wire/server/ServerPrototypes_autogen.inc"
 
         WireDeserializeAllocator mAllocator;
+        CommandSerializer* mCommandSerializer;
         ChunkedCommandSerializer mSerializer;
+        std::mutex mSerializerMutex;
         WebnnProcTable mProcs;
+        ConstantWithBufferProc mConstantWithBuffer;
+        NamedInputsSetWithoutCopyProc mNamedInputsSetWithoutCopy;
+        SharedMemoryRegions mSharedMemoryRegions;
 
 #if defined(WEBNN_ENABLE_GPU_BUFFER)
         dawn::wire::WireServer* mDawnWireServer;
@@ -174,7 +245,53 @@ namespace webnn::wire::server {
         // Save the output names in server because char** type isn't supported in webnn.json to get
         // name.
         std::map<ObjectId, std::vector<std::string>> mOutputNamesMap;
-        bool SerializeComputeResult(ObjectId outputsId);
+        bool PrepareComputeRequest(ObjectId graphId,
+                                   ObjectId inputsId,
+                                   ObjectId outputsId,
+                                   ComputeRequest* request);
+        void ReleaseComputeRequest(const ComputeRequest& request);
+        bool SerializeComputeResult(const ComputeRequest& request);
+
+        // The graphs are computed by the workers if the compute threads are enabled. A compute
+        // is posted with the keys of its graph, named inputs and named outputs, so the computes
+        // sharing any of them run in the order of the commands. The sets of the named inputs
+        // and outputs used by a compute are posted with their key instead of waiting, the
+        // command handling thread never waits for a worker which may wait for the client to
+        // read the results while the client waits for the commands to be handled.
+        static uint64_t GetComputeKey(ObjectType type, ObjectId id);
+        void PostCompute(ObjectId graphId,
+                         ObjectId inputsId,
+                         ObjectId outputsId,
+                         std::function<void()> task);
+        // The objects of the compute are used until the completion is called.
+        void PostAsyncCompute(ObjectId graphId,
+                              ObjectId inputsId,
+                              ObjectId outputsId,
+                              std::function<void(ComputeWorkerPool::Completion)> task);
+        void CompleteCompute();
+        std::unique_ptr<ComputeWorkerPool> mComputePool;
+        std::atomic<uint32_t> mPendingComputeCount;
+
+        GraphBinding* GetGraphBinding(ObjectId graphId, uint32_t index);
+        void ReleaseGraphBinding(const GraphBinding& binding);
+        bool GetBoundInputs(const GraphBinding& binding,
+                            const uint8_t* buffer,
+                            size_t bufferLength,
+                            std::vector<WNNInput>* values);
+        void SetBoundInputs(const GraphBinding& binding, const std::vector<WNNInput>& values);
+        void SerializeComputeBoundResult(ObjectHandle graph,
+                                         uint32_t index,
+                                         const GraphBinding& binding);
+        std::map<std::pair<ObjectId, uint32_t>, GraphBinding> mGraphBindings;
+
+        // The data of the large constants is kept from its GraphBuilderConstantDataCmd until the
+        // batched command of the constant references it.
+        struct ConstantPayload {
+            std::unique_ptr<char[]> data;
+            const uint8_t* buffer = nullptr;
+            size_t size = 0;
+        };
+        std::map<uint32_t, ConstantPayload> mConstantPayloads;
 
         std::shared_ptr<bool> mIsAlive;
     };
@@ -18,68 +18,363 @@
 
 namespace webnn::wire::server {
 
-    bool Server::SerializeComputeResult(ObjectId outputsId) {
+    bool Server::PrepareComputeRequest(ObjectId graphId,
+                                       ObjectId inputsId,
+                                       ObjectId outputsId,
+                                       ComputeRequest* request) {
+        auto* graph = GraphObjects().Get(graphId);
+        auto* namedInputs = NamedInputsObjects().Get(inputsId);
         auto* namedOutputs = NamedOutputsObjects().Get(outputsId);
-        if (mOutputNamesMap.find(outputsId) == mOutputNamesMap.end()) {
+        if (graph == nullptr || namedInputs == nullptr || namedOutputs == nullptr) {
             return false;
         }
-        for (auto& name : mOutputNamesMap[outputsId]) {
+
+        request->graph = graph->handle;
+        request->namedInputs = namedInputs->handle;
+        request->namedOutputs = namedOutputs->handle;
+        request->namedOutputsHandle = ObjectHandle{outputsId, namedOutputs->generation};
+        // Reset the mOutputNamesMap which host in the server.
+        auto outputNames = mOutputNamesMap.find(outputsId);
+        if (outputNames != mOutputNamesMap.end()) {
+            request->outputNames = std::move(outputNames->second);
+            mOutputNamesMap.erase(outputNames);
+        }
+        mProcs.graphReference(request->graph);
+        mProcs.namedInputsReference(request->namedInputs);
+        mProcs.namedOutputsReference(request->namedOutputs);
+        return true;
+    }
+
+    void Server::ReleaseComputeRequest(const ComputeRequest& request) {
+        mProcs.graphRelease(request.graph);
+        mProcs.namedInputsRelease(request.namedInputs);
+        mProcs.namedOutputsRelease(request.namedOutputs);
+    }
+
+    bool Server::SerializeComputeResult(const ComputeRequest& request) {
+        for (auto& name : request.outputNames) {
             WNNArrayBufferView arrayBuffer = {};
-            mProcs.namedOutputsGet(namedOutputs->handle, name.data(), &arrayBuffer);
+            mProcs.namedOutputsGet(request.namedOutputs, name.data(), &arrayBuffer);
             if (arrayBuffer.buffer == nullptr) {
                 return false;
             }
 
             // Return the result.
             ReturnGraphComputeResultCmd cmd;
-            cmd.namedOutputs = ObjectHandle{outputsId, namedOutputs->generation};
+            cmd.namedOutputs = request.namedOutputsHandle;
             cmd.name = name.data();
             cmd.buffer = static_cast<uint8_t*>(arrayBuffer.buffer);
             cmd.byteLength = arrayBuffer.byteLength;
             cmd.byteOffset = arrayBuffer.byteOffset;
-            SerializeCommand(cmd);
+            SerializeCommandWithPayload(cmd, cmd.buffer, cmd.byteLength);
         }
-        // Reset the mOutputNamesMap which host in the server.
-        mOutputNamesMap.erase(outputsId);
         return true;
     }
 
+    // static
+    uint64_t Server::GetComputeKey(ObjectType type, ObjectId id) {
+        return (static_cast<uint64_t>(type) << 32) | id;
+    }
+
+    void Server::PostCompute(ObjectId graphId,
+                             ObjectId inputsId,
+                             ObjectId outputsId,
+                             std::function<void()> task) {
+        PostAsyncCompute(graphId, inputsId, outputsId,
+                         [task = std::move(task)](ComputeWorkerPool::Completion completion) {
+                             task();
+                             completion();
+                         });
+    }
+
+    void Server::PostAsyncCompute(ObjectId graphId,
+                                  ObjectId inputsId,
+                                  ObjectId outputsId,
+                                  std::function<void(ComputeWorkerPool::Completion)> task) {
+        ASSERT(mComputePool != nullptr);
+        mPendingComputeCount++;
+        mComputePool->PostAsyncTask({GetComputeKey(ObjectType::Graph, graphId),
+                                     GetComputeKey(ObjectType::NamedInputs, inputsId),
+                                     GetComputeKey(ObjectType::NamedOutputs, outputsId)},
+                                    std::move(task));
+    }
+
+    void Server::CompleteCompute() {
+        // The command handling thread may be idle, so the results are flushed by the worker.
+        // The compute is pending until then, so the results are published once no compute is
+        // pending.
+        Flush();
+        mPendingComputeCount--;
+    }
+
     bool Server::DoGraphCompute(ObjectId graphId, ObjectId inputsId, ObjectId outputsId) {
-        auto* graph = GraphObjects().Get(graphId);
-        auto* namedInputs = NamedInputsObjects().Get(inputsId);
-        auto* namedOutputs = NamedOutputsObjects().Get(outputsId);
-        if (graph == nullptr || namedInputs == nullptr || namedOutputs == nullptr) {
+#if !defined(WEBNN_ENABLE_GPU_BUFFER)
+        if (mOutputNamesMap.find(outputsId) == mOutputNamesMap.end()) {
+            return false;
+        }
+#endif
+        ComputeRequest request;
+        if (!PrepareComputeRequest(graphId, inputsId, outputsId, &request)) {
             return false;
         }
 
-        mProcs.graphCompute(graph->handle, namedInputs->handle, namedOutputs->handle);
+        if (mComputePool == nullptr) {
+            mProcs.graphCompute(request.graph, request.namedInputs, request.namedOutputs);
+            bool success = SerializeComputeResult(request);
+            ReleaseComputeRequest(request);
+            return success;
+        }
 
-#if defined(WEBNN_ENABLE_GPU_BUFFER)
+        // A missing result can't fail the command any more, the error of the compute is
+        // reported by the context instead.
+        PostCompute(graphId, inputsId, outputsId, [this, request]() {
+            mProcs.graphCompute(request.graph, request.namedInputs, request.namedOutputs);
+            SerializeComputeResult(request);
+            ReleaseComputeRequest(request);
+            CompleteCompute();
+        });
         return true;
-#else
-        return SerializeComputeResult(outputsId);
-#endif
     }
 
     bool Server::DoGraphComputeAsync(ObjectId graphId,
                                      uint64_t requestSerial,
                                      ObjectId inputsId,
                                      ObjectId outputsId) {
+        ComputeRequest request;
+        if (!PrepareComputeRequest(graphId, inputsId, outputsId, &request)) {
+            return false;
+        }
+
+        auto userdata = MakeUserdata<ComputeAsyncUserdata>();
+        userdata->requestSerial = requestSerial;
+        userdata->graph = ObjectHandle{graphId, GraphObjects().Get(graphId)->generation};
+        userdata->request = request;
+
+        if (mComputePool == nullptr) {
+            mProcs.graphComputeAsync(request.graph, request.namedInputs, request.namedOutputs,
+                                     ForwardToServer<&Server::OnGraphComputeAsyncCallback>,
+                                     userdata.release());
+            return true;
+        }
+
+        // The graph and the named inputs and outputs stay busy until the callback, the compute
+        // may still run on the threads of the backend once graphComputeAsync returns.
+        PostAsyncCompute(graphId, inputsId, outputsId,
+                         [this, request, userdata = userdata.release()](
+                             ComputeWorkerPool::Completion completion) {
+                             userdata->completion = std::move(completion);
+                             mProcs.graphComputeAsync(
+                                 request.graph, request.namedInputs, request.namedOutputs,
+                                 ForwardToServer<&Server::OnGraphComputeAsyncCallback>,
+                                 userdata);
+                         });
+        return true;
+    }
+
+    GraphBinding* Server::GetGraphBinding(ObjectId graphId, uint32_t index) {
+        auto* graph = GraphObjects().Get(graphId);
+        auto binding = mGraphBindings.find({graphId, index});
+        if (graph == nullptr || binding == mGraphBindings.end()) {
+            return nullptr;
+        }
+        // The binding of a released graph whose id is reused is stale.
+        if (binding->second.graphGeneration != graph->generation) {
+            if (mComputePool != nullptr) {
+                mComputePool->WaitForKey(GetComputeKey(ObjectType::Graph, graphId));
+            }
+            ReleaseGraphBinding(binding->second);
+            mGraphBindings.erase(binding);
+            return nullptr;
+        }
+        return &binding->second;
+    }
+
+    void Server::ReleaseGraphBinding(const GraphBinding& binding) {
+        mProcs.namedInputsRelease(binding.namedInputs);
+        mProcs.namedOutputsRelease(binding.namedOutputs);
+    }
+
+    bool Server::GetBoundInputs(const GraphBinding& binding,
+                                const uint8_t* buffer,
+                                size_t bufferLength,
+                                std::vector<WNNInput>* values) {
+        size_t offset = 0;
+        for (auto& input : binding.inputs) {
+            WNNInput value = {};
+            if (input.sharedMemoryId != 0) {
+                value.resource.arrayBufferView.buffer = mSharedMemoryRegions.GetPointer(
+                    input.sharedMemoryId, input.sharedMemoryOffset, input.byteLength);
+                if (value.resource.arrayBufferView.buffer == nullptr) {
+                    return false;
+                }
+            } else {
+                if (bufferLength - offset < input.byteLength) {
+                    return false;
+                }
+                value.resource.arrayBufferView.buffer =
+                    const_cast<void*>(static_cast<const void*>(buffer + offset));
+                offset += input.byteLength;
+            }
+            value.resource.arrayBufferView.byteLength = input.byteLength;
+            value.dimensions = input.dimensions.data();
+            value.dimensionsCount = static_cast<uint32_t>(input.dimensions.size());
+            values->push_back(value);
+        }
+        // All the data of the command must belong to the inputs.
+        return offset == bufferLength;
+    }
+
+    void Server::SetBoundInputs(const GraphBinding& binding, const std::vector<WNNInput>& values) {
+        for (size_t i = 0; i < values.size(); ++i) {
+            mProcs.namedInputsSet(binding.namedInputs, binding.inputs[i].name.data(), &values[i]);
+        }
+    }
+
+    void Server::SerializeComputeBoundResult(ObjectHandle graph,
+                                             uint32_t index,
+                                             const GraphBinding& binding) {
+        for (size_t i = 0; i < binding.outputNames.size(); ++i) {
+            WNNArrayBufferView arrayBuffer = {};
+            mProcs.namedOutputsGet(binding.namedOutputs, binding.outputNames[i].data(),
+                                   &arrayBuffer);
+            if (arrayBuffer.buffer == nullptr) {
+                continue;
+            }
+
+            ReturnGraphComputeBoundResultCmd cmd = {};
+            cmd.graph = graph;
+            cmd.index = index;
+            cmd.outputIndex = static_cast<uint32_t>(i);
+            cmd.buffer = static_cast<uint8_t*>(arrayBuffer.buffer) + arrayBuffer.byteOffset;
+            cmd.byteLength = arrayBuffer.byteLength;
+            SerializeCommandWithPayload(cmd, cmd.buffer, cmd.byteLength);
+        }
+    }
+
+    bool Server::DoGraphBind(ObjectId graphId,
+                             uint32_t index,
+                             ObjectId inputsId,
+                             ObjectId outputsId) {
         auto* graph = GraphObjects().Get(graphId);
         auto* namedInputs = NamedInputsObjects().Get(inputsId);
         auto* namedOutputs = NamedOutputsObjects().Get(outputsId);
         if (graph == nullptr || namedInputs == nullptr || namedOutputs == nullptr) {
             return false;
         }
+        // The previous binding of the index may be used by the computes of the graph.
+        if (mComputePool != nullptr) {
+            mComputePool->WaitForKey(GetComputeKey(ObjectType::Graph, graphId));
+        }
+        mProcs.graphBind(graph->handle, index, namedInputs->handle, namedOutputs->handle);
 
-        auto userdata = MakeUserdata<ComputeAsyncUserdata>();
-        userdata->requestSerial = requestSerial;
-        userdata->graph = ObjectHandle{graphId, graph->generation};
-        userdata->namedOutputsObjectID = outputsId;
+        GraphBinding binding = {};
+        binding.graphGeneration = graph->generation;
+        binding.inputsId = inputsId;
+        binding.outputsId = outputsId;
+        binding.namedInputs = namedInputs->handle;
+        binding.namedOutputs = namedOutputs->handle;
+        mProcs.namedInputsReference(binding.namedInputs);
+        mProcs.namedOutputsReference(binding.namedOutputs);
 
-        mProcs.graphComputeAsync(graph->handle, namedInputs->handle, namedOutputs->handle,
-                                 ForwardToServer<&Server::OnGraphComputeAsyncCallback>,
-                                 userdata.release());
+        auto previous = mGraphBindings.find({graphId, index});
+        if (previous != mGraphBindings.end()) {
+            ReleaseGraphBinding(previous->second);
+            previous->second = std::move(binding);
+        } else {
+            mGraphBindings.emplace(std::make_pair(graphId, index), std::move(binding));
+        }
+        return true;
+    }
+
+    bool Server::DoGraphBindInput(ObjectId graphId,
+                                  uint32_t index,
+                                  char const* name,
+                                  size_t byteLength,
+                                  uint32_t sharedMemoryId,
+                                  uint64_t sharedMemoryOffset,
+                                  int32_t const* dimensions,
+                                  uint32_t dimensionsCount) {
+        GraphBinding* binding = GetGraphBinding(graphId, index);
+        if (binding == nullptr) {
+            return false;
+        }
+        if (mComputePool != nullptr) {
+            mComputePool->WaitForKey(GetComputeKey(ObjectType::Graph, graphId));
+        }
+        GraphBinding::Input input = {};
+        input.name = name;
+        input.byteLength = byteLength;
+        input.sharedMemoryId = sharedMemoryId;
+        input.sharedMemoryOffset = sharedMemoryOffset;
+        if (dimensions != nullptr) {
+            input.dimensions.assign(dimensions, dimensions + dimensionsCount);
+        }
+        binding->inputs.push_back(std::move(input));
+        return true;
+    }
+
+    bool Server::DoGraphBindOutput(ObjectId graphId, uint32_t index, char const* name) {
+        GraphBinding* binding = GetGraphBinding(graphId, index);
+        if (binding == nullptr) {
+            return false;
+        }
+        if (mComputePool != nullptr) {
+            mComputePool->WaitForKey(GetComputeKey(ObjectType::Graph, graphId));
+        }
+        binding->outputNames.push_back(std::string(name));
+        return true;
+    }
+
+    bool Server::DoGraphComputeBound(ObjectId graphId,
+                                     uint32_t index,
+                                     size_t bufferLength,
+                                     uint8_t const* buffer) {
+        auto* graph = GraphObjects().Get(graphId);
+        if (graph == nullptr) {
+            return false;
+        }
+        GraphBinding* binding = GetGraphBinding(graphId, index);
+        if (binding == nullptr) {
+            // The error of the index which isn't bound is reported by the context.
+            mProcs.graphComputeBound(graph->handle, index);
+            return true;
+        }
+        // The named inputs of the binding may be used by a compute, then the data is copied
+        // and the inputs are set by the task instead of waiting for the compute.
+        std::shared_ptr<std::vector<uint8_t>> data;
+        if (mComputePool != nullptr &&
+            !mComputePool->IsIdle(GetComputeKey(ObjectType::NamedInputs, binding->inputsId))) {
+            data = std::make_shared<std::vector<uint8_t>>(buffer, buffer + bufferLength);
+            buffer = data->data();
+        }
+        std::vector<WNNInput> values;
+        if (!GetBoundInputs(*binding, buffer, bufferLength, &values)) {
+            return false;
+        }
+        if (data == nullptr) {
+            SetBoundInputs(*binding, values);
+        }
+
+        WNNGraph graphHandle = graph->handle;
+        ObjectHandle handle = ObjectHandle{graphId, graph->generation};
+        if (mComputePool == nullptr) {
+            mProcs.graphComputeBound(graphHandle, index);
+            SerializeComputeBoundResult(handle, index, *binding);
+            return true;
+        }
+
+        // The binding isn't changed until the computes of the graph complete.
+        mProcs.graphReference(graphHandle);
+        PostCompute(graphId, binding->inputsId, binding->outputsId,
+                    [this, graphHandle, handle, index, binding, data, values]() {
+                        if (data != nullptr) {
+                            SetBoundInputs(*binding, values);
+                        }
+                        mProcs.graphComputeBound(graphHandle, index);
+                        SerializeComputeBoundResult(handle, index, *binding);
+                        mProcs.graphRelease(graphHandle);
+                        CompleteCompute();
+                    });
         return true;
     }
 
@@ -87,7 +382,7 @@ namespace webnn::wire::server {
                                              WNNErrorType type,
                                              const char* message) {
         if (type == WNNErrorType_NoError) {
-            SerializeComputeResult(userdata->namedOutputsObjectID);
+            SerializeComputeResult(userdata->request);
         }
         ReturnGraphComputeAsyncCallbackCmd cmd;
         cmd.graph = userdata->graph;
@@ -96,6 +391,11 @@ namespace webnn::wire::server {
         cmd.message = message;
 
         SerializeCommand(cmd);
+        ReleaseComputeRequest(userdata->request);
+        if (mComputePool != nullptr) {
+            CompleteCompute();
+            userdata->completion();
+        }
     }
 
 }  // namespace webnn::wire::server
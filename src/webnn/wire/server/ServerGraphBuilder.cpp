@@ -15,18 +15,81 @@
 
 #include "webnn/wire/server/Server.h"
 
+#include "common/Alloc.h"
+
+#include <cstring>
+
 namespace webnn::wire::server {
 
+    // The client serializes the batch in place into the space it reserved, the padding is the
+    // unused tail of the space.
+    bool Server::DoGraphBuilderBatch(size_t bufferLength,
+                                     uint8_t const* buffer,
+                                     size_t paddingLength,
+                                     uint8_t const* padding) {
+        return HandleGraphBuilderBatch(reinterpret_cast<const volatile char*>(buffer),
+                                       bufferLength);
+    }
+
+    bool Server::DoGraphBuilderConstantData(uint32_t payloadId,
+                                            size_t bufferLength,
+                                            uint8_t const* buffer) {
+        if (payloadId == 0 || mConstantPayloads.find(payloadId) != mConstantPayloads.end()) {
+            return false;
+        }
+        // A value streamed in chunks was assembled in a buffer of its own, which is kept
+        // instead of being copied again.
+        ConstantPayload payload;
+        payload.buffer = buffer;
+        payload.size = bufferLength;
+        payload.data = AcquireChunkedCommandData(buffer, bufferLength);
+        if (payload.data == nullptr) {
+            payload.data.reset(AllocNoThrow<char>(bufferLength));
+            if (payload.data == nullptr) {
+                return false;
+            }
+            memcpy(payload.data.get(), buffer, bufferLength);
+            payload.buffer = reinterpret_cast<const uint8_t*>(payload.data.get());
+        }
+        mConstantPayloads[payloadId] = std::move(payload);
+        return true;
+    }
+
     bool Server::DoGraphBuilderConstantInternal(ObjectId graphBuilderId,
                                                 WNNOperandDescriptor const* desc,
-                                                uint8_t const* buffer,
                                                 size_t byteLength,
                                                 size_t byteOffset,
+                                                uint32_t sharedMemoryId,
+                                                uint64_t sharedMemoryOffset,
+                                                uint32_t payloadId,
+                                                size_t bufferLength,
+                                                uint8_t const* buffer,
                                                 ObjectHandle result) {
         auto* graphBuilder = GraphBuilderObjects().Get(graphBuilderId);
         if (graphBuilder == nullptr) {
             return false;
         }
+        // The data of a large constant was sent ahead of the batch of the command.
+        ConstantPayload payload;
+        if (sharedMemoryId != 0) {
+            buffer = static_cast<uint8_t*>(
+                mSharedMemoryRegions.GetPointer(sharedMemoryId, sharedMemoryOffset, byteLength));
+            byteOffset = 0;
+            if (buffer == nullptr) {
+                return false;
+            }
+        } else if (payloadId != 0) {
+            auto iter = mConstantPayloads.find(payloadId);
+            if (iter == mConstantPayloads.end() || iter->second.size != byteLength) {
+                return false;
+            }
+            payload = std::move(iter->second);
+            mConstantPayloads.erase(iter);
+            buffer = payload.buffer;
+            byteOffset = 0;
+        } else if (bufferLength != byteLength) {
+            return false;
+        }
 
         // Create and register the operand object.
         auto* resultData = OperandObjects().Allocate(result.id);
@@ -44,6 +107,16 @@ namespace webnn::wire::server {
         value.buffer = const_cast<void*>(static_cast<const void*>(buffer));
         value.byteLength = byteLength;
         value.byteOffset = byteOffset;
+        // The data sent ahead is owned by the server, which hands it over to the graph builder
+        // instead of it being copied again. Only these payloads are handed over, the payloads
+        // batched with their commands are copied by the graph builder.
+        if (payload.data != nullptr && mConstantWithBuffer != nullptr) {
+            resultData->handle = mConstantWithBuffer(
+                graphBuilder->handle, desc, buffer, byteLength,
+                [](void* userdata) { delete[] static_cast<char*>(userdata); },
+                payload.data.release());
+            return true;
+        }
         resultData->handle = mProcs.graphBuilderConstant(graphBuilder->handle, desc, &value);
         return true;
     }
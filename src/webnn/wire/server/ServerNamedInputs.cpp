@@ -15,28 +15,51 @@
 
 #include "webnn/wire/server/Server.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace webnn::wire::server {
 
     bool Server::DoNamedInputsSet(ObjectId namedInputsId,
                                   char const* name,
-                                  uint8_t const* buffer,
                                   size_t byteLength,
                                   size_t byteOffset,
                                   uint32_t gpuBufferId,
                                   uint32_t gpuBufferGeneration,
+                                  uint32_t sharedMemoryId,
+                                  uint64_t sharedMemoryOffset,
                                   int32_t const* dimensions,
-                                  uint32_t dimensionsCount) {
+                                  uint32_t dimensionsCount,
+                                  size_t bufferLength,
+                                  uint8_t const* buffer) {
         auto* namedInputs = NamedInputsObjects().Get(namedInputsId);
         if (namedInputs == nullptr) {
             return false;
         }
+        // The named inputs used by a compute are set once the compute completes, the data of
+        // the command is copied meanwhile.
+        std::shared_ptr<std::vector<uint8_t>> bufferCopy;
+        if (mComputePool != nullptr &&
+            !mComputePool->IsIdle(GetComputeKey(ObjectType::NamedInputs, namedInputsId))) {
+            bufferCopy = std::make_shared<std::vector<uint8_t>>(buffer, buffer + bufferLength);
+            buffer = bufferCopy->data();
+        }
 
         // The type of output data is ArrayBufferView
         WNNInput input = {};
-        if (buffer != nullptr) {
+        if (sharedMemoryId != 0) {
+            void* data = mSharedMemoryRegions.GetPointer(sharedMemoryId, sharedMemoryOffset,
+                                                         byteLength);
+            if (data == nullptr) {
+                return false;
+            }
+            input.resource.arrayBufferView.buffer = data;
+            input.resource.arrayBufferView.byteLength = byteLength;
+        } else if (bufferLength != 0) {
             WNNArrayBufferView value = {};
             value.buffer = const_cast<void*>(static_cast<const void*>(buffer));
-            value.byteLength = byteLength;
+            value.byteLength = bufferLength;
             value.byteOffset = byteOffset;
             input.resource.arrayBufferView = value;
         } else {
@@ -48,9 +71,30 @@ namespace webnn::wire::server {
             input.resource.gpuBufferView = value;
 #endif
         }
-        input.dimensions = dimensions;
         input.dimensionsCount = dimensionsCount;
-        mProcs.namedInputsSet(namedInputs->handle, name, &input);
+        // The inputs in shared memory are set in place, the client doesn't write them until the
+        // computes using them are done.
+        NamedInputsSetWithoutCopyProc namedInputsSet = mProcs.namedInputsSet;
+        if (sharedMemoryId != 0 && mNamedInputsSetWithoutCopy != nullptr) {
+            namedInputsSet = mNamedInputsSetWithoutCopy;
+        }
+        if (bufferCopy == nullptr) {
+            input.dimensions = dimensions;
+            namedInputsSet(namedInputs->handle, name, &input);
+            return true;
+        }
+
+        WNNNamedInputs handle = namedInputs->handle;
+        mProcs.namedInputsReference(handle);
+        mComputePool->PostTask(
+            {GetComputeKey(ObjectType::NamedInputs, namedInputsId)},
+            [this, handle, name = std::string(name), input, bufferCopy, namedInputsSet,
+             dimensions = std::vector<int32_t>(dimensions, dimensions + dimensionsCount)]() {
+                WNNInput value = input;
+                value.dimensions = dimensions.data();
+                namedInputsSet(handle, name.data(), &value);
+                mProcs.namedInputsRelease(handle);
+            });
         return true;
     }
 
@@ -15,6 +15,8 @@
 
 #include "webnn/wire/server/Server.h"
 
+#include <string>
+
 namespace webnn::wire::server {
 
     bool Server::DoNamedOutputsSet(ObjectId namedOutputsId,
@@ -22,12 +24,13 @@ namespace webnn::wire::server {
                                    size_t byteLength,
                                    size_t byteOffset,
                                    uint32_t gpuBufferId,
-                                   uint32_t gpuBufferGeneration) {
+                                   uint32_t gpuBufferGeneration,
+                                   uint32_t sharedMemoryId,
+                                   uint64_t sharedMemoryOffset) {
         auto* namedOutputs = NamedOutputsObjects().Get(namedOutputsId);
         if (namedOutputs == nullptr) {
             return false;
         }
-
         WNNResource resource = {};
         if (gpuBufferId != 0) {
 #if defined(WEBNN_ENABLE_GPU_BUFFER)
@@ -35,6 +38,17 @@ namespace webnn::wire::server {
             resource.gpuBufferView.id = gpuBufferId;
             resource.gpuBufferView.generation = gpuBufferGeneration;
 #endif
+        } else if (sharedMemoryId != 0) {
+            // The result is written to the shared memory directly, so it isn't returned.
+            void* data = mSharedMemoryRegions.GetPointer(sharedMemoryId, sharedMemoryOffset,
+                                                         byteLength);
+            if (data == nullptr) {
+                return false;
+            }
+            resource.arrayBufferView.buffer = data;
+            resource.arrayBufferView.byteLength = byteLength;
+            // Keep the entry of the named outputs even if all outputs are in shared memory.
+            mOutputNamesMap.insert({namedOutputsId, {}});
         } else {
             resource.arrayBufferView.byteLength = byteLength;
             resource.arrayBufferView.byteOffset = byteOffset;
@@ -50,8 +64,20 @@ namespace webnn::wire::server {
                 outputNames.push_back(std::string(name));
             }
         }
-        mProcs.namedOutputsSet(namedOutputs->handle, name, &resource);
+        // The named outputs used by a compute are set once the compute completes.
+        if (mComputePool == nullptr ||
+            mComputePool->IsIdle(GetComputeKey(ObjectType::NamedOutputs, namedOutputsId))) {
+            mProcs.namedOutputsSet(namedOutputs->handle, name, &resource);
+            return true;
+        }
 
+        WNNNamedOutputs handle = namedOutputs->handle;
+        mProcs.namedOutputsReference(handle);
+        mComputePool->PostTask({GetComputeKey(ObjectType::NamedOutputs, namedOutputsId)},
+                               [this, handle, name = std::string(name), resource]() {
+                                   mProcs.namedOutputsSet(handle, name.data(), &resource);
+                                   mProcs.namedOutputsRelease(handle);
+                               });
         return true;
     }
 